@@ -0,0 +1,281 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of class celma::common::AdaptiveWait.
+
+
+#pragma once
+
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include "celma/common/detail/futex.hpp"
+
+
+namespace celma::common {
+
+
+/// Statistics of an AdaptiveWait object: How many waits ended in which phase,
+/// and how much time was spent in each phase.
+///
+/// @since  1.47.0, 18.10.2026
+struct WaitStatistics
+{
+   /// Number of calls to AdaptiveWait::wait().
+   uint64_t                  mNumWaits = 0;
+   /// Number of waits that ended while spinning.
+   uint64_t                  mNumSpinDone = 0;
+   /// Number of waits that ended while yielding.
+   uint64_t                  mNumYieldDone = 0;
+   /// Number of waits that ended after parking.
+   uint64_t                  mNumParkDone = 0;
+   /// Number of times a thread blocked on the futex.
+   uint64_t                  mNumParks = 0;
+   /// Total time spent spinning.
+   std::chrono::nanoseconds  mSpinTime{ 0};
+   /// Total time spent yielding.
+   std::chrono::nanoseconds  mYieldTime{ 0};
+   /// Total time spent parked.
+   std::chrono::nanoseconds  mParkTime{ 0};
+
+}; // WaitStatistics
+
+
+/// Wait strategy for consumers of queues and flags: Waits until a condition
+/// becomes true, first spinning with the \c pause instruction for a
+/// calibrated number of iterations, then calling \c sched_yield() a few times,
+/// and finally blocking ("parking") on a futex.<br>
+/// A producer calls notifyOne() or notifyAll() after it made the condition
+/// true, which wakes a parked consumer immediately. When no consumer is
+/// parked, a notification costs only a memory fence and an atomic load.<br>
+/// Unlike SleepOnError, a consumer neither burns a core while the producer is
+/// idle, nor does it add the latency of a sleep when work arrives.<br>
+/// Usage:
+/// @code
+///   // consumer
+///   wait_strategy.wait( [ &]() { return !queue.empty(); });
+///   // producer
+///   queue.push( item);
+///   wait_strategy.notifyOne();
+/// @endcode
+///
+/// @since  1.47.0, 18.10.2026
+class AdaptiveWait
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  spin_time   How long to spin before yielding, converted into
+   ///                         a number of \c pause iterations.
+   /// @param[in]  num_yields  How often to call \c sched_yield() before
+   ///                         parking.
+   /// @since  1.47.0, 18.10.2026
+   explicit AdaptiveWait( std::chrono::nanoseconds spin_time
+                             = std::chrono::microseconds( 5),
+                          int num_yields = 16);
+
+   AdaptiveWait( const AdaptiveWait&) = delete;
+   ~AdaptiveWait() = default;
+   AdaptiveWait& operator =( const AdaptiveWait&) = delete;
+
+   /// Waits until the predicate returns \c true.
+   ///
+   /// @tparam  P  The type of the predicate.
+   /// @param[in]  pred  Returns \c true when the wait should end. Is called
+   ///                   repeatedly, also after a notification.
+   /// @since  1.47.0, 18.10.2026
+   template< typename P> void wait( P pred);
+
+   /// Wakes one parked thread, if any. Must be called after the condition of
+   /// the waiting thread was changed.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void notifyOne() noexcept;
+
+   /// Wakes all parked threads. Must be called after the condition of the
+   /// waiting threads was changed.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void notifyAll() noexcept;
+
+   /// Returns the statistics.
+   ///
+   /// @return  The current statistics.
+   /// @since  1.47.0, 18.10.2026
+   WaitStatistics statistics() const noexcept;
+
+   /// Resets the statistics.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void resetStatistics() noexcept;
+
+   /// Returns the number of \c pause iterations used for spinning.
+   ///
+   /// @return  The number of spin iterations.
+   /// @since  1.47.0, 18.10.2026
+   uint32_t spinIterations() const noexcept
+   {
+      return mSpinIterations;
+   } // AdaptiveWait::spinIterations
+
+   /// Returns how many \c pause instructions are executed per microsecond.
+   /// Measured once, on the first call.
+   ///
+   /// @return  The number of \c pause instructions per microsecond, at least 1.
+   /// @since  1.47.0, 18.10.2026
+   static uint32_t pausesPerMicrosecond() noexcept;
+
+private:
+   using Clock = std::chrono::steady_clock;
+
+   /// Statistics of one phase.
+   struct PhaseStat
+   {
+      /// Number of waits that ended in this phase.
+      std::atomic< uint64_t>  mNumDone{ 0};
+      /// Time spent in this phase, in nanoseconds.
+      std::atomic< uint64_t>  mNanos{ 0};
+   };
+
+   /// Adds the time spent in a phase to its statistics.
+   ///
+   /// @param[in]  stat         The statistics of the phase.
+   /// @param[in]  phase_start  When the phase started.
+   /// @param[in]  done         Set if the wait ended in this phase.
+   /// @return  The current time, i.e. the start of the next phase.
+   /// @since  1.47.0, 18.10.2026
+   static Clock::time_point endPhase( PhaseStat& stat,
+                                      Clock::time_point phase_start,
+                                      bool done) noexcept;
+
+   /// Blocks the calling thread until the predicate returns \c true,
+   /// waking up on notifications.
+   ///
+   /// @tparam  P  The type of the predicate.
+   /// @param[in]  pred  The predicate to check.
+   /// @since  1.47.0, 18.10.2026
+   template< typename P> void park( P& pred);
+
+   /// Number of \c pause iterations before yielding.
+   const uint32_t          mSpinIterations;
+   /// Number of \c sched_yield() calls before parking.
+   const int               mNumYields;
+   /// Incremented for each notification, used as futex.
+   std::atomic< uint32_t>  mEpoch{ 0};
+   /// Number of parked threads.
+   std::atomic< uint32_t>  mNumParked{ 0};
+   /// Number of calls to wait().
+   std::atomic< uint64_t>  mNumWaits{ 0};
+   /// Number of futex waits.
+   std::atomic< uint64_t>  mNumParks{ 0};
+   /// Statistics of the spin phase.
+   PhaseStat               mSpinStat;
+   /// Statistics of the yield phase.
+   PhaseStat               mYieldStat;
+   /// Statistics of the park phase.
+   PhaseStat               mParkStat;
+
+}; // AdaptiveWait
+
+
+// inlined methods
+// ===============
+
+
+template< typename P> void AdaptiveWait::wait( P pred)
+{
+
+   auto  phase_start = Clock::now();
+
+
+   mNumWaits.fetch_add( 1, std::memory_order_relaxed);
+
+   for (uint32_t i = 0; i < mSpinIterations; ++i)
+   {
+      if (pred())
+      {
+         endPhase( mSpinStat, phase_start, true);
+         return;
+      } // end if
+      detail::cpuRelax();
+   } // end for
+
+   phase_start = endPhase( mSpinStat, phase_start, false);
+
+   for (int i = 0; i < mNumYields; ++i)
+   {
+      if (pred())
+      {
+         endPhase( mYieldStat, phase_start, true);
+         return;
+      } // end if
+      std::this_thread::yield();
+   } // end for
+
+   phase_start = endPhase( mYieldStat, phase_start, false);
+
+   park( pred);
+   endPhase( mParkStat, phase_start, true);
+
+} // AdaptiveWait::wait
+
+
+template< typename P> void AdaptiveWait::park( P& pred)
+{
+
+   for (;;)
+   {
+      mNumParked.fetch_add( 1, std::memory_order_seq_cst);
+      std::atomic_thread_fence( std::memory_order_seq_cst);
+
+      // the predicate must be checked after registering as parked, a
+      // notification sent before would otherwise be lost
+      const uint32_t  epoch = mEpoch.load( std::memory_order_seq_cst);
+      if (pred())
+      {
+         mNumParked.fetch_sub( 1, std::memory_order_relaxed);
+         return;
+      } // end if
+
+      mNumParks.fetch_add( 1, std::memory_order_relaxed);
+      detail::futexWait( mEpoch, epoch);
+      mNumParked.fetch_sub( 1, std::memory_order_relaxed);
+
+      if (pred())
+         return;
+   } // end for
+
+} // AdaptiveWait::park
+
+
+inline void AdaptiveWait::notifyOne() noexcept
+{
+
+   std::atomic_thread_fence( std::memory_order_seq_cst);
+
+   if (mNumParked.load( std::memory_order_seq_cst) > 0)
+   {
+      mEpoch.fetch_add( 1, std::memory_order_seq_cst);
+      detail::futexWake( mEpoch, 1);
+   } // end if
+
+} // AdaptiveWait::notifyOne
+
+
+} // namespace celma::common
+
+
+// =====  END OF adaptive_wait.hpp  =====
@@ -0,0 +1,377 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of template class celma::common::AsyncWriteBuffer<>.
+
+
+#pragma once
+
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include "celma/common/detail/aligned_buffer.hpp"
+#include "celma/common/managed_thread.hpp"
+#include "celma/common/write_buffer.hpp"
+
+
+namespace celma::common {
+
+
+/// Like WriteBuffer, collects data in a buffer before it is written to the
+/// destination, but uses multiple buffers and writes the data on a background
+/// thread:<br>
+/// When the current buffer is full, it is handed over to the flusher thread,
+/// and the following data is appended into the next buffer. Only when all
+/// buffers are waiting to be written, append() must wait. This wait time is
+/// reported to the policy through \c stalled().<br>
+/// writeData() is called from the flusher thread, always with the buffers in
+/// the order in which they were filled. The buffers are aligned for direct
+/// I/O.<br>
+/// If writeData() throws an exception, the following buffers are discarded,
+/// and the exception is re-thrown from the next call to append(), flush() or
+/// drain().<br>
+/// The functions append(), flush() and drain() must all be called from the
+/// same thread.<br>
+/// Since writeData() is called from another thread, the derived class must
+/// call drain() in its destructor, data that is not yet written when the
+/// destructor of this class runs is discarded.
+///
+/// @tparam  N
+///    The size of each buffer.
+/// @tparam  P
+///    The statistics policy to use by this class.<br>
+///    Default = EmptyWritePolicy, a policy that counts nothing.<br>
+///    \c appended() and \c stalled() are called from the thread that appends
+///    the data, \c flushed() from the flusher thread. So, read the statistics
+///    only after calling drain().
+/// @tparam  B
+///    The number of buffers to use, must be at least 2.
+/// @since  1.47.0, 18.10.2026
+template< size_t N, typename P = EmptyWritePolicy, size_t B = 2>
+   class AsyncWriteBuffer: public P
+{
+public:
+   static_assert( N > 0, "buffer size must be greater than 0");
+   static_assert( B >= 2, "at least 2 buffers are needed");
+
+   /// Constructor, allocates the buffers and starts the flusher thread.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   AsyncWriteBuffer();
+
+   // No copying or moving.
+   AsyncWriteBuffer( const AsyncWriteBuffer&) = delete;
+   AsyncWriteBuffer( AsyncWriteBuffer&&) = delete;
+
+   /// Destructor, stops the flusher thread.<br>
+   /// To make sure that all data is written to the destination, call drain()
+   /// from the destructor of the derived class.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   virtual ~AsyncWriteBuffer();
+
+   // No assignment.
+   AsyncWriteBuffer& operator =( const AsyncWriteBuffer&) = delete;
+   AsyncWriteBuffer& operator =( AsyncWriteBuffer&&) = delete;
+
+   /// Appends data to the current buffer.<br>
+   /// When the buffer is full, it is handed over to the flusher thread, and
+   /// the remaining data is appended to the next buffer. Data blocks that are
+   /// larger than a buffer are split up.<br>
+   /// Waits if all buffers are waiting to be written.<br>
+   /// The function fails if a NULL pointer is passed, or if writing a
+   /// previous buffer failed.<br>
+   /// Does nothing when a length of 0 is passed.
+   ///
+   /// @tparam  T
+   ///    The type of the pointer to the data.
+   /// @param[in]  data
+   ///    Pointer to the data to append to the buffer.
+   /// @param[in]  len
+   ///    The length of the data block.
+   /// @since  1.47.0, 18.10.2026
+   template< typename T> void append( const T* const data, size_t len) noexcept( false);
+
+   /// Hands the current buffer over to the flusher thread, does not wait
+   /// until the data is written.<br>
+   /// Does nothing if the current buffer is empty.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void flush() noexcept( false);
+
+   /// Hands the current buffer over to the flusher thread and waits until
+   /// all buffers are written to the destination.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void drain() noexcept( false);
+
+   /// Returns the amount of data currently stored in the current buffer.
+   ///
+   /// @return  Amount of data currently stored in the current buffer.
+   /// @since  1.47.0, 18.10.2026
+   size_t buffered() const;
+
+protected:
+   /// Called from the flusher thread to actually write data to the
+   /// destination.<br>
+   /// The function must always write all data, ev. using a loop. If writing
+   /// all data is impossible, throw an exception.
+   ///
+   /// @param[in]  data
+   ///    Pointer to the beginning of the data block to write.
+   /// @param[in]  len
+   ///    Length of the data block to write.
+   /// @since  1.47.0, 18.10.2026
+   virtual void writeData( const unsigned char* const data, size_t len) const = 0;
+
+private:
+   /// Waits until the current buffer is not used by the flusher thread
+   /// anymore.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void acquireBuffer();
+
+   /// Hands the current buffer over to the flusher thread and switches to the
+   /// next buffer.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void handOver();
+
+   /// Re-throws the exception from writeData(), if any.<br>
+   /// Must be called with the mutex locked.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void checkError();
+
+   /// The function of the flusher thread: Waits for buffers to write.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void flusherLoop();
+
+   /// The memory of all buffers.
+   detail::AlignedBuffer              mpBuffers;
+   /// The length of the data in each buffer handed over to the flusher.
+   size_t                             mLengths[ B] = {};
+   /// Index of the buffer that data is appended to.
+   size_t                             mProducerIdx = 0;
+   /// Write position to append data in the current buffer.
+   size_t                             mWritePos = 0;
+   /// Index of the next buffer to write by the flusher thread.
+   size_t                             mFlusherIdx = 0;
+   /// Protects the following members.
+   std::mutex                         mMutex;
+   /// Used to wake up the flusher thread.
+   std::condition_variable            mFlusherCond;
+   /// Used to wake up the producer waiting for a buffer.
+   std::condition_variable            mProducerCond;
+   /// Number of buffers handed over to, and not yet written by, the flusher.
+   size_t                             mNumQueued = 0;
+   /// Set when the flusher thread should stop.
+   bool                               mStop = false;
+   /// Exception thrown by writeData(), not yet reported.
+   std::exception_ptr                 mError;
+   /// The flusher thread, must be the last member so it is stopped before the
+   /// other members are destroyed.
+   ManagedThread                      mFlusher;
+
+}; // AsyncWriteBuffer< N, P, B>
+
+
+// inlined methods
+// ===============
+
+
+template< size_t N, typename P, size_t B>
+   AsyncWriteBuffer< N, P, B>::AsyncWriteBuffer():
+      mpBuffers( detail::makeAlignedBuffer( N * B)),
+      mFlusher( [this]() { flusherLoop(); })
+{
+} // AsyncWriteBuffer< N, P, B>::AsyncWriteBuffer
+
+
+template< size_t N, typename P, size_t B>
+   AsyncWriteBuffer< N, P, B>::~AsyncWriteBuffer()
+{
+   {
+      std::lock_guard< std::mutex>  lock( mMutex);
+      mStop = true;
+   } // end scope
+   mFlusherCond.notify_one();
+   // the flusher thread is joined when mFlusher is destroyed
+} // AsyncWriteBuffer< N, P, B>::~AsyncWriteBuffer
+
+
+template< size_t N, typename P, size_t B>
+   template< typename T>
+      void AsyncWriteBuffer< N, P, B>::append( const T* const data, size_t len)
+         noexcept( false)
+{
+   if (len == 0)
+      return;
+   if (data == nullptr)
+      throw std::runtime_error( "NULL pointer passed to append()");
+
+   P::appended( len);
+
+   auto  src = reinterpret_cast< const unsigned char*>( data);
+
+   while (len > 0)
+   {
+      if (mWritePos == 0)
+         acquireBuffer();
+
+      const size_t  chunk = std::min( len, N - mWritePos);
+
+      ::memcpy( &mpBuffers[ mProducerIdx * N + mWritePos], src, chunk);
+      mWritePos += chunk;
+      src       += chunk;
+      len       -= chunk;
+
+      if (mWritePos == N)
+         handOver();
+   } // end while
+} // AsyncWriteBuffer< N, P, B>::append
+
+
+template< size_t N, typename P, size_t B>
+   void AsyncWriteBuffer< N, P, B>::flush()
+{
+   if (mWritePos > 0)
+   {
+      handOver();
+   } else
+   {
+      std::lock_guard< std::mutex>  lock( mMutex);
+      checkError();
+   } // end if
+} // AsyncWriteBuffer< N, P, B>::flush
+
+
+template< size_t N, typename P, size_t B>
+   void AsyncWriteBuffer< N, P, B>::drain()
+{
+   flush();
+
+   std::unique_lock< std::mutex>  lock( mMutex);
+   mProducerCond.wait( lock, [this]() { return mNumQueued == 0; });
+   checkError();
+} // AsyncWriteBuffer< N, P, B>::drain
+
+
+template< size_t N, typename P, size_t B>
+   size_t AsyncWriteBuffer< N, P, B>::buffered() const
+{
+   return mWritePos;
+} // AsyncWriteBuffer< N, P, B>::buffered
+
+
+template< size_t N, typename P, size_t B>
+   void AsyncWriteBuffer< N, P, B>::acquireBuffer()
+{
+   std::unique_lock< std::mutex>  lock( mMutex);
+
+   // the current buffer is free as long as not all buffers are queued
+   if (mNumQueued == B)
+   {
+      const auto  start = std::chrono::steady_clock::now();
+      mProducerCond.wait( lock, [this]() { return mNumQueued < B; });
+      P::stalled( std::chrono::steady_clock::now() - start);
+   } // end if
+
+   checkError();
+} // AsyncWriteBuffer< N, P, B>::acquireBuffer
+
+
+template< size_t N, typename P, size_t B>
+   void AsyncWriteBuffer< N, P, B>::handOver()
+{
+   mLengths[ mProducerIdx] = mWritePos;
+
+   {
+      std::lock_guard< std::mutex>  lock( mMutex);
+      ++mNumQueued;
+   } // end scope
+   mFlusherCond.notify_one();
+
+   mProducerIdx = (mProducerIdx + 1) % B;
+   mWritePos    = 0;
+} // AsyncWriteBuffer< N, P, B>::handOver
+
+
+template< size_t N, typename P, size_t B>
+   void AsyncWriteBuffer< N, P, B>::checkError()
+{
+   if (mError)
+   {
+      auto  error = mError;
+      mError = nullptr;
+      std::rethrow_exception( error);
+   } // end if
+} // AsyncWriteBuffer< N, P, B>::checkError
+
+
+template< size_t N, typename P, size_t B>
+   void AsyncWriteBuffer< N, P, B>::flusherLoop()
+{
+   for (;;)
+   {
+      bool  discard = false;
+
+      {
+         std::unique_lock< std::mutex>  lock( mMutex);
+         mFlusherCond.wait( lock, [this]() { return mStop || (mNumQueued > 0); });
+         if (mStop)
+            return;
+         // skip the following buffers until the error was reported
+         discard = static_cast< bool>( mError);
+      } // end scope
+
+      const size_t  len = mLengths[ mFlusherIdx];
+
+      if (!discard)
+      {
+         try
+         {
+            writeData( &mpBuffers[ mFlusherIdx * N], len);
+            P::flushed( len);
+         } catch (...)
+         {
+            std::lock_guard< std::mutex>  lock( mMutex);
+            mError = std::current_exception();
+         } // end try
+      } // end if
+
+      mFlusherIdx = (mFlusherIdx + 1) % B;
+
+      {
+         std::lock_guard< std::mutex>  lock( mMutex);
+         --mNumQueued;
+      } // end scope
+      mProducerCond.notify_one();
+   } // end for
+} // AsyncWriteBuffer< N, P, B>::flusherLoop
+
+
+} // namespace celma::common
+
+
+// =====  END OF async_write_buffer.hpp  =====
+
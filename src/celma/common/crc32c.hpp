@@ -0,0 +1,46 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of function celma::common::crc32c().
+
+
+#pragma once
+
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace celma::common {
+
+
+/// Computes the CRC32C (Castagnoli) checksum of a data block.<br>
+/// Uses the \c crc32 instruction of SSE4.2 when the CPU supports it, a
+/// table-driven implementation otherwise.<br>
+/// To compute the checksum over multiple data blocks, pass the result of the
+/// previous call as \a crc.
+///
+/// @param[in]  data  Pointer to the data.
+/// @param[in]  len   The length of the data.
+/// @param[in]  crc   The checksum of the preceding data, 0 to start.
+/// @return  The checksum of the data.
+/// @since  1.47.0, 18.10.2026
+uint32_t crc32c( const void* data, size_t len, uint32_t crc = 0) noexcept;
+
+
+} // namespace celma::common
+
+
+// =====  END OF crc32c.hpp  =====
+
@@ -0,0 +1,321 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of classes celma::common::CsvReader,
+/// celma::common::CsvTable and celma::common::CsvStringColumn.
+
+
+#pragma once
+
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+
+namespace celma::common {
+
+
+/// The types of the columns in a delimited file.
+///
+/// @since  1.47.0, 18.10.2026
+enum class CsvColumnType
+{
+   int64,     //!< Integer values, stored as \c int64_t.
+   float64,   //!< Floating point values, stored as \c double.
+   string,    //!< Strings, stored in a CsvStringColumn.
+   ignore     //!< The column is not stored.
+};
+
+
+/// Definition of a column in a delimited file.
+///
+/// @since  1.47.0, 18.10.2026
+struct CsvColumnDef
+{
+   /// The name of the column, used to access the column data.
+   std::string    name;
+   /// The type of the column.
+   CsvColumnType  type;
+
+}; // CsvColumnDef
+
+
+/// The schema of a delimited file: The definitions of all columns in the
+/// order in which they appear in the file.
+using CsvSchema = std::vector< CsvColumnDef>;
+
+
+// Class CsvStringColumn
+// =====================
+
+
+/// Column with string values: All strings are stored one after the other in
+/// one buffer, i.e. no allocation per value.
+///
+/// @since  1.47.0, 18.10.2026
+class CsvStringColumn
+{
+public:
+   /// Appends a value.
+   ///
+   /// @param[in]  value  The value to append.
+   /// @since  1.47.0, 18.10.2026
+   void push_back( std::string_view value);
+
+   /// Appends all values of another column.
+   ///
+   /// @param[in]  other  The column to copy the values from.
+   /// @since  1.47.0, 18.10.2026
+   void append( const CsvStringColumn& other);
+
+   /// Returns a value.
+   ///
+   /// @param[in]  idx  The index of the value to return.
+   /// @return  The value, remains valid until the column is modified.
+   /// @since  1.47.0, 18.10.2026
+   std::string_view operator []( size_t idx) const;
+
+   /// Returns the number of values.
+   ///
+   /// @return  The number of values in the column.
+   /// @since  1.47.0, 18.10.2026
+   size_t size() const noexcept
+   {
+      return mEnds.size();
+   } // CsvStringColumn::size
+
+   /// Reserves memory for the given number of values and characters.
+   ///
+   /// @param[in]  num_values  The expected number of values.
+   /// @param[in]  num_chars   The expected total length of all values.
+   /// @since  1.47.0, 18.10.2026
+   void reserve( size_t num_values, size_t num_chars);
+
+private:
+   /// The characters of all values.
+   std::string            mData;
+   /// End offset of each value in the buffer.
+   std::vector< size_t>  mEnds;
+
+}; // CsvStringColumn
+
+
+// Class CsvTable
+// ==============
+
+
+/// Column-oriented storage for the data read from a delimited file.
+///
+/// @since  1.47.0, 18.10.2026
+class CsvTable
+{
+public:
+   /// Default constructor, creates a table without columns.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   CsvTable() = default;
+
+   /// Constructor, creates the (empty) columns for the given schema.
+   ///
+   /// @param[in]  schema  The definitions of the columns.
+   /// @since  1.47.0, 18.10.2026
+   explicit CsvTable( const CsvSchema& schema);
+
+   /// Returns the number of rows.
+   ///
+   /// @return  The number of rows stored in the table.
+   /// @since  1.47.0, 18.10.2026
+   size_t numRows() const noexcept
+   {
+      return mNumRows;
+   } // CsvTable::numRows
+
+   /// Returns the index of a column.
+   ///
+   /// @param[in]  name  The name of the column.
+   /// @return  The index of the column.
+   /// @throw  std::invalid_argument if there is no column with this name.
+   /// @since  1.47.0, 18.10.2026
+   size_t columnIndex( std::string_view name) const noexcept( false);
+
+   /// Returns the values of an integer column.
+   ///
+   /// @param[in]  name  The name of the column.
+   /// @return  The values of the column.
+   /// @throw  std::invalid_argument for an unknown column name or if the
+   ///         column has a different type.
+   /// @since  1.47.0, 18.10.2026
+   const std::vector< int64_t>& int64Column( std::string_view name) const
+      noexcept( false);
+
+   /// Returns the values of a floating point column.
+   ///
+   /// @param[in]  name  The name of the column.
+   /// @return  The values of the column.
+   /// @throw  std::invalid_argument for an unknown column name or if the
+   ///         column has a different type.
+   /// @since  1.47.0, 18.10.2026
+   const std::vector< double>& float64Column( std::string_view name) const
+      noexcept( false);
+
+   /// Returns the values of a string column.
+   ///
+   /// @param[in]  name  The name of the column.
+   /// @return  The values of the column.
+   /// @throw  std::invalid_argument for an unknown column name or if the
+   ///         column has a different type.
+   /// @since  1.47.0, 18.10.2026
+   const CsvStringColumn& stringColumn( std::string_view name) const
+      noexcept( false);
+
+   /// Appends all rows of another table with the same schema.
+   ///
+   /// @param[in]  other  The table to copy the rows from.
+   /// @since  1.47.0, 18.10.2026
+   void append( const CsvTable& other);
+
+private:
+   friend class CsvReader;
+
+   /// Storage of one column, \c std::monostate for ignored columns.
+   using Column = std::variant< std::monostate, std::vector< int64_t>,
+                                std::vector< double>, CsvStringColumn>;
+
+   /// Returns the column with the given name and type.
+   ///
+   /// @tparam  T  The type of the column storage.
+   /// @param[in]  name  The name of the column.
+   /// @return  The column.
+   /// @throw  std::invalid_argument for an unknown column name or if the
+   ///         column has a different type.
+   /// @since  1.47.0, 18.10.2026
+   template< typename T> const T& column( std::string_view name) const
+      noexcept( false);
+
+   /// The names of the columns.
+   std::vector< std::string>  mNames;
+   /// The data of the columns.
+   std::vector< Column>       mColumns;
+   /// The number of rows.
+   size_t                     mNumRows = 0;
+
+}; // CsvTable
+
+
+// Class CsvReader
+// ===============
+
+
+/// Reads a delimited (CSV) file into a CsvTable.<br>
+/// Uses a memory-mapped TextFile, StringViewTokenizer for lines without quotes
+/// and \c std::from_chars() to convert numbers, so no memory is allocated per
+/// field.<br>
+/// Fields may be quoted, a quote in a quoted field must be doubled. A quoted
+/// field may not contain a newline. Empty lines are ignored, a carriage return
+/// at the end of a line is removed.
+///
+/// @since  1.47.0, 18.10.2026
+class CsvReader
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  schema      The definitions of the columns in the file.
+   /// @param[in]  delimiter   The field delimiter.
+   /// @param[in]  has_header  Set if the first line contains the column
+   ///                         names and should be skipped.
+   /// @param[in]  quote       The quote character.
+   /// @throw  std::invalid_argument if the schema is empty, or if delimiter
+   ///         and quote character are the same.
+   /// @since  1.47.0, 18.10.2026
+   explicit CsvReader( CsvSchema schema, char delimiter = ',',
+                       bool has_header = false, char quote = '"')
+      noexcept( false);
+
+   /// Reads a file.
+   ///
+   /// @param[in]  fname
+   ///    The (path and) name of the file to read.
+   /// @param[in]  num_threads
+   ///    The number of threads to use: 1 reads the file sequentially, 0 uses
+   ///    one thread per processor. The rows are stored in the order of the
+   ///    file in any case.
+   /// @return  The data read from the file.
+   /// @throw  std::runtime_error if the file could not be read or contains
+   ///         invalid data.
+   /// @since  1.47.0, 18.10.2026
+   CsvTable readFile( const std::string& fname, size_t num_threads = 1) const
+      noexcept( false);
+
+   /// Parses one line and adds its values to the table.<br>
+   /// If the line contains invalid data, the columns of the table may contain
+   /// different numbers of values afterwards.
+   ///
+   /// @param[in]   line   The line to parse.
+   /// @param[out]  table  The table to add the values to.
+   /// @throw  std::runtime_error if the line contains invalid data.
+   /// @since  1.47.0, 18.10.2026
+   void parseLine( std::string_view line, CsvTable& table) const
+      noexcept( false);
+
+   /// Returns the schema.
+   ///
+   /// @return  The column definitions.
+   /// @since  1.47.0, 18.10.2026
+   const CsvSchema& schema() const noexcept
+   {
+      return mSchema;
+   } // CsvReader::schema
+
+private:
+   /// Stores a field value in a column.
+   ///
+   /// @param[in]  table    The table to store the value in.
+   /// @param[in]  col_idx  The index of the column.
+   /// @param[in]  value    The value to store.
+   /// @throw  std::runtime_error if the value cannot be converted.
+   /// @since  1.47.0, 18.10.2026
+   void storeValue( CsvTable& table, size_t col_idx,
+                    std::string_view value) const noexcept( false);
+
+   /// Parses a line that contains quotes.
+   ///
+   /// @param[in]   line   The line to parse.
+   /// @param[out]  table  The table to add the values to.
+   /// @return  The number of fields found in the line.
+   /// @throw  std::runtime_error if the line contains invalid data.
+   /// @since  1.47.0, 18.10.2026
+   size_t parseQuotedLine( std::string_view line, CsvTable& table) const
+      noexcept( false);
+
+   /// The definitions of the columns.
+   const CsvSchema  mSchema;
+   /// The field delimiter.
+   const char       mDelimiter;
+   /// Set if the first line must be skipped.
+   const bool       mHasHeader;
+   /// The quote character.
+   const char       mQuote;
+
+}; // CsvReader
+
+
+} // namespace celma::common
+
+
+// =====  END OF csv_reader.hpp  =====
+
@@ -0,0 +1,71 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of function celma::common::detail::makeAlignedBuffer().
+
+
+#pragma once
+
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+
+namespace celma::common::detail {
+
+
+/// Alignment of the buffers, suitable for direct I/O (\c O_DIRECT) on all
+/// common block devices.
+constexpr size_t  BufferAlignment = 4096;
+
+
+/// Deleter for buffers allocated by makeAlignedBuffer().
+///
+/// @since  1.47.0, 18.10.2026
+struct AlignedBufferDelete
+{
+   /// Frees the buffer.
+   ///
+   /// @param[in]  ptr  Pointer to the buffer to free.
+   /// @since  1.47.0, 18.10.2026
+   void operator ()( unsigned char* ptr) const noexcept
+   {
+      ::operator delete[]( ptr, std::align_val_t( BufferAlignment));
+   } // AlignedBufferDelete::operator ()
+
+}; // AlignedBufferDelete
+
+
+/// Type of the buffers allocated by makeAlignedBuffer().
+using AlignedBuffer = std::unique_ptr< unsigned char[], AlignedBufferDelete>;
+
+
+/// Allocates a buffer whose start address is aligned to BufferAlignment.
+///
+/// @param[in]  size  The size of the buffer to allocate.
+/// @return  The new buffer.
+/// @since  1.47.0, 18.10.2026
+inline AlignedBuffer makeAlignedBuffer( size_t size)
+{
+   return AlignedBuffer( static_cast< unsigned char*>(
+      ::operator new[]( size, std::align_val_t( BufferAlignment))));
+} // makeAlignedBuffer
+
+
+} // namespace celma::common::detail
+
+
+// =====  END OF aligned_buffer.hpp  =====
+
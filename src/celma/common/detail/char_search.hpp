@@ -0,0 +1,88 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of class celma::common::detail::CharSet and function
+/// celma::common::detail::findFirstOf().
+
+
+#pragma once
+
+
+#include <array>
+#include <string>
+#include <string_view>
+
+
+namespace celma::common::detail {
+
+
+/// Set of characters to search for, e.g. the delimiters of a tokenizer.
+///
+/// @since  1.47.0, 18.10.2026
+class CharSet
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  chars  The characters of the set, duplicates are ignored.
+   /// @since  1.47.0, 18.10.2026
+   explicit CharSet( std::string_view chars);
+
+   /// Returns if the set contains the given character.
+   ///
+   /// @param[in]  c  The character to check.
+   /// @return  \c true if the character is in the set.
+   /// @since  1.47.0, 18.10.2026
+   bool contains( char c) const noexcept
+   {
+      return mTable[ static_cast< unsigned char>( c)];
+   } // CharSet::contains
+
+   /// Returns the characters of the set.
+   ///
+   /// @return  The characters, without duplicates.
+   /// @since  1.47.0, 18.10.2026
+   const std::string& chars() const noexcept
+   {
+      return mChars;
+   } // CharSet::chars
+
+private:
+   /// The characters of the set.
+   std::string               mChars;
+   /// Lookup table, the flag is set for all characters of the set.
+   std::array< bool, 256>  mTable = {};
+
+}; // CharSet
+
+
+/// Returns the position of the first character in the range that is contained
+/// in the set.<br>
+/// Uses AVX2 or SSE2 when available and the set is small, a lookup table
+/// otherwise.
+///
+/// @param[in]  first  Pointer to the first character of the range.
+/// @param[in]  last   Pointer behind the last character of the range.
+/// @param[in]  set    The characters to search for.
+/// @return  Pointer to the first character found, \a last if none was found.
+/// @since  1.47.0, 18.10.2026
+const char* findFirstOf( const char* first, const char* last,
+                         const CharSet& set) noexcept;
+
+
+} // namespace celma::common::detail
+
+
+// =====  END OF char_search.hpp  =====
+
@@ -20,7 +20,7 @@
 #define CELMA_COMMON_DETAIL_FILTER_POLICY_HPP
 
 
-#include <string>
+#include <string_view>
 
 
 namespace celma { namespace common { namespace detail {
@@ -34,7 +34,7 @@ protected:
    /// Policy method, does not do anything.
    /// @return  Always \c false.
    /// @since  1.3.0, 13.04.2016
-   bool filter( const std::string&) const
+   bool filter( std::string_view) const
    {
       return false;
    } // NoFilter::filter
@@ -51,7 +51,7 @@ protected:
    /// @param[in]  line  The line to check.
    /// @return  \c true if the line is empty.
    /// @since  1.3.0, 13.04.2016
-   bool filter( const std::string& line) const
+   bool filter( std::string_view line) const
    {
       return line.empty();
    } // EmptyLineFilter::filter
@@ -0,0 +1,81 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of functions celma::common::detail::futexWait(),
+/// futexWake() and cpuRelax().
+
+
+#pragma once
+
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstdint>
+
+
+namespace celma::common::detail {
+
+
+static_assert( sizeof( std::atomic< uint32_t>) == sizeof( uint32_t),
+               "futex needs a plain 32 bit integer");
+
+
+/// Blocks the calling thread as long as the value of the futex is
+/// \a expected. May return spuriously.
+///
+/// @param[in]  futex     The futex to wait on.
+/// @param[in]  expected  The value to block on.
+/// @since  1.47.0, 18.10.2026
+inline void futexWait( std::atomic< uint32_t>& futex, uint32_t expected)
+{
+   ::syscall( SYS_futex, reinterpret_cast< uint32_t*>( &futex),
+              FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+} // futexWait
+
+
+/// Wakes threads that are blocked on a futex.
+///
+/// @param[in]  futex      The futex to wake the threads of.
+/// @param[in]  num_wakes  The maximum number of threads to wake.
+/// @since  1.47.0, 18.10.2026
+inline void futexWake( std::atomic< uint32_t>& futex, int num_wakes)
+{
+   ::syscall( SYS_futex, reinterpret_cast< uint32_t*>( &futex),
+              FUTEX_WAKE_PRIVATE, num_wakes, nullptr, nullptr, 0);
+} // futexWake
+
+
+/// Tells the processor that the calling thread is in a spin loop (\c pause on
+/// x86), which reduces the power consumption and the penalty when the loop
+/// ends.
+///
+/// @since  1.47.0, 18.10.2026
+inline void cpuRelax() noexcept
+{
+#if defined( __x86_64__) || defined( __i386__)
+   __builtin_ia32_pause();
+#elif defined( __aarch64__)
+   asm volatile( "yield" ::: "memory");
+#else
+   std::atomic_signal_fence( std::memory_order_seq_cst);
+#endif
+} // cpuRelax
+
+
+} // namespace celma::common::detail
+
+
+// =====  END OF futex.hpp  =====
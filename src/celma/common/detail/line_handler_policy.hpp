@@ -21,7 +21,7 @@
 
 
 #include <cassert>
-#include <string>
+#include <string_view>
 #include "celma/common/detail/line_handler_call_points.hpp"
 
 
@@ -35,7 +35,7 @@ class DummyLineHandler
 protected:
    /// Policy method, does not do anything.
    /// @since  1.3.0, 13.04.2016
-   void handleLine( LineHandlerCallPoints, const std::string&) const
+   void handleLine( LineHandlerCallPoints, std::string_view) const
    {
    } // DummyLineHandler::handleLine
 
@@ -53,6 +53,19 @@ struct FileLineStat
    /// Number of lines actually processed.
    int  linesProcessed = 0;
 
+   /// Adds the counters of another statistic object, used to merge the
+   /// statistics of the chunks that were processed in parallel.
+   /// @param[in]  other  The other object to add the counters of.
+   /// @return  This object.
+   /// @since  1.47.0, 18.10.2026
+   FileLineStat& operator +=( const FileLineStat& other)
+   {
+      linesRead      += other.linesRead;
+      linesFiltered  += other.linesFiltered;
+      linesProcessed += other.linesProcessed;
+      return *this;
+   } // FileLineStat::operator +=
+
 }; // FileLineStat
 
 
@@ -103,7 +116,7 @@ protected:
    /// @param[in]  lhcp  The call point from which this methd was called.
    /// @param[in]        The current line, ignored.
    /// @since  1.3.0, 13.04.2016
-   void handleLine( LineHandlerCallPoints lhcp, const std::string&)
+   void handleLine( LineHandlerCallPoints lhcp, std::string_view)
    {
       if (mpFileLineStat == nullptr)
          return;
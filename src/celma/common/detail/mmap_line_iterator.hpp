@@ -0,0 +1,482 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of template class
+/// celma::common::detail::MmapLineIterator and function
+/// celma::common::detail::lineChunkBoundaries().
+
+
+#pragma once
+
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "celma/common/detail/line_handler_call_points.hpp"
+
+
+namespace celma::common::detail {
+
+
+/// Read-only memory mapping of a complete file.<br>
+/// Shared by all iterators created on the same file, the mapping is released
+/// when the last iterator is deleted.
+///
+/// @since  1.47.0, 18.10.2026
+class MappedFile
+{
+public:
+   /// Opens and maps the file, advises the kernel that the file will be read
+   /// sequentially.
+   ///
+   /// @param[in]  fname  The (path and) name of the file to map.
+   /// @throw  std::runtime_error if the file could not be opened or mapped.
+   /// @since  1.47.0, 18.10.2026
+   explicit MappedFile( const std::string& fname) noexcept( false);
+
+   // No copying or moving.
+   MappedFile( const MappedFile&) = delete;
+   MappedFile( MappedFile&&) = delete;
+
+   /// Destructor, removes the mapping.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   ~MappedFile();
+
+   // No assignment.
+   MappedFile& operator =( const MappedFile&) = delete;
+   MappedFile& operator =( MappedFile&&) = delete;
+
+   /// Returns the pointer to the mapped data.
+   ///
+   /// @return  The start of the file contents, \c nullptr for an empty file.
+   /// @since  1.47.0, 18.10.2026
+   const char* data() const
+   {
+      return mpData;
+   } // MappedFile::data
+
+   /// Returns the size of the file.
+   ///
+   /// @return  The number of bytes in the mapping.
+   /// @since  1.47.0, 18.10.2026
+   size_t size() const
+   {
+      return mSize;
+   } // MappedFile::size
+
+private:
+   /// Pointer to the mapped data.
+   const char*  mpData = nullptr;
+   /// Size of the mapping.
+   size_t       mSize = 0;
+
+}; // MappedFile
+
+
+/// Iterator for a textfile that maps the complete file into memory and
+/// returns the lines as string views into the mapping.<br>
+/// Behaves like StreamLineIterator, i.e. line numbers and the calls of the
+/// filter and line handler policies are the same, but no line is copied.
+/// The policies must accept the line as \c std::string_view.<br>
+/// The string views remain valid as long as an iterator on the file exists.
+///
+/// @tparam  F  Filter policy.
+/// @tparam  H  Policy object to call for each line.
+/// @tparam  C  The type of the statistic object.
+/// @since  1.47.0, 18.10.2026
+template< typename F, typename H, typename C = std::nullptr_t>
+   class MmapLineIterator:
+      public F, public H
+{
+
+   using F::filter;
+   using H::handleLine;
+
+public:
+   using iterator_category = std::forward_iterator_tag;
+
+   /// Constructor.
+   ///
+   /// @param[in]  source  The source == file name to read from.
+   /// @param[in]  atEnd   Set to \c true for end iterator, in this case the
+   ///                     file is not mapped.
+   /// @throw  std::runtime_error if the file could not be opened or mapped.
+   /// @since  1.47.0, 18.10.2026
+   explicit MmapLineIterator( const std::string& source, bool atEnd = false)
+      noexcept( false);
+
+   /// Constructor that takes a pointer to the statistics object to use.
+   ///
+   /// @param[in]  source    The source == file name to read from.
+   /// @param[in]  stat_obj  Pointer to the statistic object to use.
+   /// @throw  std::runtime_error if the file could not be opened or mapped.
+   /// @since  1.47.0, 18.10.2026
+   MmapLineIterator( const std::string& source, C* stat_obj) noexcept( false);
+
+   /// Constructor for an iterator that only returns the lines in the given
+   /// range of an existing mapping.
+   ///
+   /// @param[in]  source     The source == file name, used for comparisons.
+   /// @param[in]  mapping    The mapping of the file.
+   /// @param[in]  begin_pos  Offset of the first line to return.
+   /// @param[in]  end_pos    Offset after the last line to return.
+   /// @since  1.47.0, 18.10.2026
+   MmapLineIterator( const std::string& source,
+                     std::shared_ptr< const MappedFile> mapping,
+                     size_t begin_pos, size_t end_pos);
+
+   /// Constructor for an iterator that only returns the lines in the given
+   /// range of an existing mapping, and that uses a statistics object.
+   ///
+   /// @param[in]  source     The source == file name, used for comparisons.
+   /// @param[in]  mapping    The mapping of the file.
+   /// @param[in]  begin_pos  Offset of the first line to return.
+   /// @param[in]  end_pos    Offset after the last line to return.
+   /// @param[in]  stat_obj   Pointer to the statistic object to use.
+   /// @since  1.47.0, 18.10.2026
+   MmapLineIterator( const std::string& source,
+                     std::shared_ptr< const MappedFile> mapping,
+                     size_t begin_pos, size_t end_pos, C* stat_obj);
+
+   /// Copy constructor, cheap since the copy shares the mapping.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   MmapLineIterator( const MmapLineIterator&) = default;
+
+   /// Equality comparison operator.
+   ///
+   /// @param[in]  other  The other iterator to compare against.
+   /// @return  \c true if both iterators point to the same line.
+   /// @since  1.47.0, 18.10.2026
+   bool operator ==( const MmapLineIterator& other) const;
+
+   /// Not-equal comparison operator.
+   ///
+   /// @param[in]  other  The other iterator to compare against.
+   /// @return  \c true if the iterators point to different lines.
+   /// @since  1.47.0, 18.10.2026
+   bool operator !=( const MmapLineIterator& other) const;
+
+   /// Pre-increment operator.
+   ///
+   /// @return  This object, pointing to the next line.
+   /// @since  1.47.0, 18.10.2026
+   MmapLineIterator& operator ++();
+
+   /// Post-increment operator.
+   ///
+   /// @return  Object pointing to the current line.
+   /// @since  1.47.0, 18.10.2026
+   MmapLineIterator operator ++( int);
+
+   /// Dereference operator.
+   ///
+   /// @return  The current line, without the newline character.
+   /// @since  1.47.0, 18.10.2026
+   std::string_view operator *() const;
+
+   /// Returns the number of the current line.
+   ///
+   /// @return  The line number of the current line.
+   /// @since  1.47.0, 18.10.2026
+   int lineNbr() const;
+
+private:
+   /// Maps the file, unless this is an end iterator.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void init() noexcept( false);
+
+   /// The (path and) file name of the source file to read.
+   std::string                          mSourceFile;
+   /// The mapping of the file, shared by the copies of the iterator.
+   std::shared_ptr< const MappedFile>   mpMapping;
+   /// Offset of the next line in the mapping.
+   size_t                               mNextPos = 0;
+   /// Offset after the last line to return.
+   size_t                               mEndPos = 0;
+   /// Set to \c true if this object is at the end of the file.
+   bool                                 mAtEnd = false;
+   /// The current line.
+   std::string_view                     mCurrentLine;
+   /// Line number counter.
+   int                                  mLineNbr = -1;
+
+}; // MmapLineIterator< F, H, C>
+
+
+/// Splits a mapped file into ranges that start at the beginning of a line.
+///
+/// @param[in]  mapping     The mapping of the file to split.
+/// @param[in]  num_chunks  The number of ranges to create.
+/// @return  The offsets of the ranges, \a num_chunks + 1 values. Ranges may be
+///          empty if the file contains only a few very long lines.
+/// @since  1.47.0, 18.10.2026
+inline std::vector< size_t> lineChunkBoundaries( const MappedFile& mapping,
+                                                 size_t num_chunks);
+
+
+// inlined methods
+// ===============
+
+
+inline MappedFile::MappedFile( const std::string& fname)
+{
+
+   const int  fd = ::open( fname.c_str(), O_RDONLY);
+   if (fd == -1)
+      throw std::runtime_error( "could not open file '" + fname + "': "
+                                + ::strerror( errno));
+
+   struct stat  file_stat;
+   if (::fstat( fd, &file_stat) != 0)
+   {
+      const int  err = errno;
+      ::close( fd);
+      throw std::runtime_error( "could not get size of file '" + fname + "': "
+                                + ::strerror( err));
+   } // end if
+
+   mSize = static_cast< size_t>( file_stat.st_size);
+
+   // a mapping of length 0 is not possible
+   if (mSize > 0)
+   {
+      void*  addr = ::mmap( nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (addr == MAP_FAILED)
+      {
+         const int  err = errno;
+         ::close( fd);
+         throw std::runtime_error( "could not map file '" + fname + "': "
+                                   + ::strerror( err));
+      } // end if
+
+      ::madvise( addr, mSize, MADV_SEQUENTIAL);
+      mpData = static_cast< const char*>( addr);
+   } // end if
+
+   // the mapping stays valid after closing the file
+   ::close( fd);
+
+} // MappedFile::MappedFile
+
+
+inline MappedFile::~MappedFile()
+{
+   if (mpData != nullptr)
+      ::munmap( const_cast< char*>( mpData), mSize);
+} // MappedFile::~MappedFile
+
+
+template< typename F, typename H, typename C>
+   MmapLineIterator< F, H, C>::MmapLineIterator( const std::string& source,
+     bool atEnd):
+   F(),
+   H(),
+   mSourceFile( source),
+   mAtEnd( atEnd)
+{
+   init();
+} // MmapLineIterator< F, H, C>::MmapLineIterator
+
+
+template< typename F, typename H, typename C>
+   MmapLineIterator< F, H, C>::MmapLineIterator( const std::string& source,
+     C* stat_obj):
+   F(),
+   H( stat_obj),
+   mSourceFile( source)
+{
+   init();
+} // MmapLineIterator< F, H, C>::MmapLineIterator
+
+
+template< typename F, typename H, typename C>
+   MmapLineIterator< F, H, C>::MmapLineIterator( const std::string& source,
+     std::shared_ptr< const MappedFile> mapping, size_t begin_pos,
+     size_t end_pos):
+   F(),
+   H(),
+   mSourceFile( source),
+   mpMapping( std::move( mapping)),
+   mNextPos( begin_pos),
+   mEndPos( end_pos)
+{
+   operator ++();
+} // MmapLineIterator< F, H, C>::MmapLineIterator
+
+
+template< typename F, typename H, typename C>
+   MmapLineIterator< F, H, C>::MmapLineIterator( const std::string& source,
+     std::shared_ptr< const MappedFile> mapping, size_t begin_pos,
+     size_t end_pos, C* stat_obj):
+   F(),
+   H( stat_obj),
+   mSourceFile( source),
+   mpMapping( std::move( mapping)),
+   mNextPos( begin_pos),
+   mEndPos( end_pos)
+{
+   operator ++();
+} // MmapLineIterator< F, H, C>::MmapLineIterator
+
+
+template< typename F, typename H, typename C>
+   bool MmapLineIterator< F, H, C>::operator ==( const MmapLineIterator& other) const
+{
+   return (mSourceFile == other.mSourceFile) && (mAtEnd == other.mAtEnd)
+          && (mAtEnd || (mLineNbr == other.mLineNbr));
+} // MmapLineIterator< F, H, C>::operator ==
+
+
+template< typename F, typename H, typename C>
+   bool MmapLineIterator< F, H, C>::operator !=( const MmapLineIterator& other) const
+{
+   return !(*this == other);
+} // MmapLineIterator< F, H, C>::operator !=
+
+
+template< typename F, typename H, typename C>
+   MmapLineIterator< F, H, C>& MmapLineIterator< F, H, C>::operator ++()
+{
+
+   const char*  data = (mpMapping != nullptr) ? mpMapping->data() : nullptr;
+
+   for (;;)
+   {
+      if (mNextPos >= mEndPos)
+      {
+         mCurrentLine = std::string_view();
+         mAtEnd = true;
+         break;   // for
+      } // end if
+
+      // memchr() is vectorised in all relevant C libraries
+      const char*   line_start = data + mNextPos;
+      const size_t  remaining = mEndPos - mNextPos;
+      const auto    newline = static_cast< const char*>(
+         ::memchr( line_start, '\n', remaining));
+
+      if (newline != nullptr)
+      {
+         mCurrentLine = std::string_view( line_start, newline - line_start);
+         mNextPos += mCurrentLine.length() + 1;
+      } else
+      {
+         // last line without newline
+         mCurrentLine = std::string_view( line_start, remaining);
+         mNextPos = mEndPos;
+      } // end if
+
+      ++mLineNbr;
+      handleLine( LineHandlerCallPoints::lineRead, mCurrentLine);
+
+      if (!filter( mCurrentLine))
+      {
+         handleLine( LineHandlerCallPoints::lineProcessed, mCurrentLine);
+         break;   // for
+      } // end if
+
+      handleLine( LineHandlerCallPoints::lineFiltered, mCurrentLine);
+   } // end for
+
+   return *this;
+} // MmapLineIterator< F, H, C>::operator ++
+
+
+template< typename F, typename H, typename C>
+   MmapLineIterator< F, H, C> MmapLineIterator< F, H, C>::operator ++( int)
+{
+   auto  obj_copy( *this);
+   ++(*this);
+   return obj_copy;
+} // MmapLineIterator< F, H, C>::operator ++
+
+
+template< typename F, typename H, typename C>
+   std::string_view MmapLineIterator< F, H, C>::operator *() const
+{
+   return mCurrentLine;
+} // MmapLineIterator< F, H, C>::operator *
+
+
+template< typename F, typename H, typename C>
+   int MmapLineIterator< F, H, C>::lineNbr() const
+{
+   return mLineNbr;
+} // MmapLineIterator< F, H, C>::lineNbr
+
+
+template< typename F, typename H, typename C>
+   void MmapLineIterator< F, H, C>::init()
+{
+   if (mSourceFile.empty())
+      throw std::runtime_error( "need to specify a file name");
+   if (!mAtEnd)
+   {
+      mpMapping = std::make_shared< const MappedFile>( mSourceFile);
+      mEndPos = mpMapping->size();
+      operator ++();
+   } // end if
+} // MmapLineIterator< F, H, C>::init
+
+
+inline std::vector< size_t> lineChunkBoundaries( const MappedFile& mapping,
+                                                 size_t num_chunks)
+{
+
+   const size_t           size = mapping.size();
+   std::vector< size_t>  boundaries( num_chunks + 1, size);
+
+
+   boundaries[ 0] = 0;
+
+   for (size_t i = 1; i < num_chunks; ++i)
+   {
+      // a range starts after the first newline found before the (rough)
+      // split position, i.e. exactly at the split position if the previous
+      // character is a newline
+      const size_t  search_pos = std::max( size * i / num_chunks,
+                                           boundaries[ i - 1] + 1) - 1;
+      if (search_pos >= size)
+         break;   // for
+
+      const auto  newline = static_cast< const char*>(
+         ::memchr( mapping.data() + search_pos, '\n', size - search_pos));
+      if (newline == nullptr)
+         break;   // for
+
+      boundaries[ i] = newline - mapping.data() + 1;
+   } // end for
+
+   return boundaries;
+} // lineChunkBoundaries
+
+
+} // namespace celma::common::detail
+
+
+// =====  END OF mmap_line_iterator.hpp  =====
+
@@ -0,0 +1,47 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of function celma::common::detail::threadIndex().
+
+
+#pragma once
+
+
+#include <atomic>
+#include <cstdint>
+
+
+namespace celma::common::detail {
+
+
+/// Returns the index of the calling thread, e.g. to select the shard of a
+/// sharded counter. The index is assigned on the first call in a thread, so
+/// the threads that use the sharded counters get consecutive indexes.
+///
+/// @return  The index of the calling thread.
+/// @since  1.47.0, 18.10.2026
+inline uint32_t threadIndex() noexcept
+{
+   static std::atomic< uint32_t>  next_index{ 0};
+   static thread_local uint32_t   my_index
+      = next_index.fetch_add( 1, std::memory_order_relaxed);
+
+   return my_index;
+} // threadIndex
+
+
+} // namespace celma::common::detail
+
+
+// =====  END OF thread_index.hpp  =====
@@ -0,0 +1,270 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of template class celma::common::detail::WorkStealingDeque.
+
+
+#pragma once
+
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+
+namespace celma::common::detail {
+
+
+/// Lock-free work-stealing deque as described by Chase and Lev, with the
+/// memory orderings of Lê et al. ("Correct and Efficient Work-Stealing for
+/// Weak Memory Models", 2013).<br>
+/// The owner thread pushes and takes items at the bottom (LIFO), all other
+/// threads steal items from the top (FIFO). The deque only stores pointers,
+/// it does not take ownership of the objects.<br>
+/// When the deque is full, the owner thread replaces the buffer with a buffer
+/// of twice the size. The old buffers are kept until the deque is destroyed,
+/// since other threads may still read from them.
+///
+/// @tparam  T  The type of the objects to store pointers of.
+/// @since  1.47.0, 18.10.2026
+template< typename T> class WorkStealingDeque
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  initial_capacity
+   ///    The initial number of items that can be stored, is rounded up to the
+   ///    next power of 2.
+   /// @since  1.47.0, 18.10.2026
+   explicit WorkStealingDeque( size_t initial_capacity = 256);
+
+   WorkStealingDeque( const WorkStealingDeque&) = delete;
+   ~WorkStealingDeque() = default;
+   WorkStealingDeque& operator =( const WorkStealingDeque&) = delete;
+
+   /// Adds an item at the bottom. Must only be called by the owner thread.
+   ///
+   /// @param[in]  item  The pointer to store, must not be NULL.
+   /// @since  1.47.0, 18.10.2026
+   void push( T* item);
+
+   /// Removes the item at the bottom, i.e. the item that was pushed last.
+   /// Must only be called by the owner thread.
+   ///
+   /// @return  The item, NULL if the deque is empty.
+   /// @since  1.47.0, 18.10.2026
+   T* take();
+
+   /// Removes the item at the top, i.e. the oldest item. May be called by any
+   /// thread.
+   ///
+   /// @return  The item, NULL if the deque is empty or if another thread
+   ///          removed the item concurrently.
+   /// @since  1.47.0, 18.10.2026
+   T* steal();
+
+   /// Returns if the deque is empty. The result is only a snapshot when other
+   /// threads access the deque concurrently.
+   ///
+   /// @return  \c true if the deque contains no items.
+   /// @since  1.47.0, 18.10.2026
+   bool empty() const;
+
+private:
+   /// Circular buffer with a fixed capacity.
+   class Buffer
+   {
+   public:
+      /// Constructor.
+      ///
+      /// @param[in]  capacity  The capacity, must be a power of 2.
+      /// @since  1.47.0, 18.10.2026
+      explicit Buffer( size_t capacity):
+         mMask( capacity - 1),
+         mItems( std::make_unique< std::atomic< T*>[]>( capacity))
+      {
+      } // Buffer::Buffer
+
+      /// @return  The number of items that can be stored in the buffer.
+      /// @since  1.47.0, 18.10.2026
+      int64_t capacity() const noexcept
+      {
+         return static_cast< int64_t>( mMask + 1);
+      } // Buffer::capacity
+
+      /// Stores an item.
+      ///
+      /// @param[in]  idx   The (unbounded) index of the item.
+      /// @param[in]  item  The item to store.
+      /// @since  1.47.0, 18.10.2026
+      void put( int64_t idx, T* item) noexcept
+      {
+         mItems[ idx & mMask].store( item, std::memory_order_relaxed);
+      } // Buffer::put
+
+      /// Returns an item.
+      ///
+      /// @param[in]  idx  The (unbounded) index of the item.
+      /// @return  The item at this position.
+      /// @since  1.47.0, 18.10.2026
+      T* get( int64_t idx) const noexcept
+      {
+         return mItems[ idx & mMask].load( std::memory_order_relaxed);
+      } // Buffer::get
+
+      /// Creates a buffer with twice the capacity and copies the items.
+      ///
+      /// @param[in]  top     The index of the first item.
+      /// @param[in]  bottom  The index after the last item.
+      /// @return  The new buffer.
+      /// @since  1.47.0, 18.10.2026
+      std::unique_ptr< Buffer> grow( int64_t top, int64_t bottom) const
+      {
+         auto  new_buffer = std::make_unique< Buffer>( 2 * (mMask + 1));
+         for (int64_t i = top; i < bottom; ++i)
+            new_buffer->put( i, get( i));
+         return new_buffer;
+      } // Buffer::grow
+
+   private:
+      /// Mask to compute the position from an index.
+      const int64_t                         mMask;
+      /// The items.
+      std::unique_ptr< std::atomic< T*>[]>  mItems;
+
+   }; // Buffer
+
+   /// Index of the oldest item, modified by the thieves.
+   alignas( 64) std::atomic< int64_t>  mTop{ 0};
+   /// Index after the newest item, modified by the owner.
+   alignas( 64) std::atomic< int64_t>  mBottom{ 0};
+   /// The current buffer.
+   std::atomic< Buffer*>                mBuffer;
+   /// All buffers that were allocated, the last is the current one.
+   std::vector< std::unique_ptr< Buffer>>  mBuffers;
+
+}; // WorkStealingDeque< T>
+
+
+// inlined methods
+// ===============
+
+
+template< typename T>
+   WorkStealingDeque< T>::WorkStealingDeque( size_t initial_capacity)
+{
+
+   size_t  capacity = 2;
+
+
+   while (capacity < initial_capacity)
+      capacity *= 2;
+
+   mBuffers.push_back( std::make_unique< Buffer>( capacity));
+   mBuffer.store( mBuffers.back().get(), std::memory_order_relaxed);
+
+} // WorkStealingDeque< T>::WorkStealingDeque
+
+
+template< typename T> void WorkStealingDeque< T>::push( T* item)
+{
+
+   const int64_t  bottom = mBottom.load( std::memory_order_relaxed);
+   const int64_t  top = mTop.load( std::memory_order_acquire);
+   Buffer*        buffer = mBuffer.load( std::memory_order_relaxed);
+
+
+   if (bottom - top > buffer->capacity() - 1)
+   {
+      mBuffers.push_back( buffer->grow( top, bottom));
+      buffer = mBuffers.back().get();
+      mBuffer.store( buffer, std::memory_order_release);
+   } // end if
+
+   buffer->put( bottom, item);
+   mBottom.store( bottom + 1, std::memory_order_release);
+
+} // WorkStealingDeque< T>::push
+
+
+template< typename T> T* WorkStealingDeque< T>::take()
+{
+
+   const int64_t  bottom = mBottom.load( std::memory_order_relaxed) - 1;
+   Buffer*        buffer = mBuffer.load( std::memory_order_relaxed);
+
+
+   mBottom.store( bottom, std::memory_order_relaxed);
+   std::atomic_thread_fence( std::memory_order_seq_cst);
+
+   int64_t  top = mTop.load( std::memory_order_relaxed);
+
+   if (top > bottom)
+   {
+      // deque was empty
+      mBottom.store( bottom + 1, std::memory_order_relaxed);
+      return nullptr;
+   } // end if
+
+   T*  item = buffer->get( bottom);
+
+   if (top == bottom)
+   {
+      // last item: compete with the thieves
+      if (!mTop.compare_exchange_strong( top, top + 1,
+                                         std::memory_order_seq_cst,
+                                         std::memory_order_relaxed))
+         item = nullptr;
+      mBottom.store( bottom + 1, std::memory_order_relaxed);
+   } // end if
+
+   return item;
+} // WorkStealingDeque< T>::take
+
+
+template< typename T> T* WorkStealingDeque< T>::steal()
+{
+
+   int64_t  top = mTop.load( std::memory_order_acquire);
+
+
+   std::atomic_thread_fence( std::memory_order_seq_cst);
+
+   const int64_t  bottom = mBottom.load( std::memory_order_acquire);
+
+   if (top >= bottom)
+      return nullptr;
+
+   T*  item = mBuffer.load( std::memory_order_acquire)->get( top);
+
+   if (!mTop.compare_exchange_strong( top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed))
+      return nullptr;
+
+   return item;
+} // WorkStealingDeque< T>::steal
+
+
+template< typename T> bool WorkStealingDeque< T>::empty() const
+{
+   return mTop.load( std::memory_order_acquire)
+          >= mBottom.load( std::memory_order_acquire);
+} // WorkStealingDeque< T>::empty
+
+
+} // namespace celma::common::detail
+
+
+// =====  END OF work_stealing_deque.hpp  =====
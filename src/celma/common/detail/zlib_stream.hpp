@@ -0,0 +1,143 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of classes celma::common::detail::ZlibDeflate and
+/// celma::common::detail::ZlibInflate.
+
+
+#pragma once
+
+
+#include <cstddef>
+#include <memory>
+
+
+// forward declaration of the zlib stream state
+struct z_stream_s;
+
+
+namespace celma::common {
+
+
+class IReadStage;
+class IWriteStage;
+
+
+namespace detail {
+
+
+/// Streaming compression with zlib, used by ZlibCompressStage.
+///
+/// @since  1.47.0, 18.10.2026
+class ZlibDeflate
+{
+public:
+   /// Constructor, initialises the compression.
+   ///
+   /// @param[in]  level
+   ///    The compression level, 0 (none) to 9 (best), -1 for the default.
+   /// @throw  std::runtime_error if the initialisation failed.
+   /// @since  1.47.0, 18.10.2026
+   explicit ZlibDeflate( int level) noexcept( false);
+
+   // No copying or moving.
+   ZlibDeflate( const ZlibDeflate&) = delete;
+   ZlibDeflate( ZlibDeflate&&) = delete;
+
+   /// Destructor, frees the resources.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   ~ZlibDeflate();
+
+   // No assignment.
+   ZlibDeflate& operator =( const ZlibDeflate&) = delete;
+   ZlibDeflate& operator =( ZlibDeflate&&) = delete;
+
+   /// Compresses the data and passes the compressed data to the next stage.
+   ///
+   /// @param[in]  data    Pointer to the data to compress.
+   /// @param[in]  len     The length of the data.
+   /// @param[in]  next    The stage to pass the compressed data to.
+   /// @param[in]  finish  Set to write the remaining compressed data.
+   /// @return  Number of bytes passed to the next stage.
+   /// @since  1.47.0, 18.10.2026
+   size_t compress( const unsigned char* data, size_t len, IWriteStage& next,
+                    bool finish) noexcept( false);
+
+private:
+   /// The zlib stream state.
+   std::unique_ptr< z_stream_s>       mpStream;
+   /// The buffer for the compressed data.
+   std::unique_ptr< unsigned char[]>  mpOutput;
+
+}; // ZlibDeflate
+
+
+/// Streaming decompression with zlib, used by ZlibDecompressStage.
+///
+/// @since  1.47.0, 18.10.2026
+class ZlibInflate
+{
+public:
+   /// Constructor, initialises the decompression.
+   ///
+   /// @throw  std::runtime_error if the initialisation failed.
+   /// @since  1.47.0, 18.10.2026
+   ZlibInflate() noexcept( false);
+
+   // No copying or moving.
+   ZlibInflate( const ZlibInflate&) = delete;
+   ZlibInflate( ZlibInflate&&) = delete;
+
+   /// Destructor, frees the resources.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   ~ZlibInflate();
+
+   // No assignment.
+   ZlibInflate& operator =( const ZlibInflate&) = delete;
+   ZlibInflate& operator =( ZlibInflate&&) = delete;
+
+   /// Reads compressed data from the source and returns the decompressed
+   /// data.
+   ///
+   /// @param[in]   source    The stage to get the compressed data from.
+   /// @param[out]  data      Pointer to the buffer for the decompressed data.
+   /// @param[in]   len       Maximum length of the data to return.
+   /// @param[out]  bytes_in  Incremented by the number of bytes read from the
+   ///                        source.
+   /// @return  Number of bytes returned, 0 at the end of the compressed data.
+   /// @throw  std::runtime_error if the compressed data is invalid or
+   ///         truncated.
+   /// @since  1.47.0, 18.10.2026
+   size_t decompress( IReadStage& source, unsigned char* data, size_t len,
+                      size_t& bytes_in) noexcept( false);
+
+private:
+   /// The zlib stream state.
+   std::unique_ptr< z_stream_s>       mpStream;
+   /// The buffer for the compressed data.
+   std::unique_ptr< unsigned char[]>  mpInput;
+   /// Set when the end of the compressed data was reached.
+   bool                               mEnd = false;
+
+}; // ZlibInflate
+
+
+} // namespace detail
+} // namespace celma::common
+
+
+// =====  END OF zlib_stream.hpp  =====
+
@@ -0,0 +1,425 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of template class celma::common::FileReadBuffer<>.
+
+
+#pragma once
+
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include "celma/common/detail/aligned_buffer.hpp"
+#include "celma/common/managed_thread.hpp"
+#include "celma/common/read_buffer.hpp"
+
+
+namespace celma::common {
+
+
+/// ReadBuffer that reads sequentially from a file.<br>
+/// The data is read with \c pread(). After each read, the kernel is asked to
+/// already read the next \a R blocks of the file in the background
+/// (\c POSIX_FADV_WILLNEED), so that multiple reads are in flight while the
+/// data in the buffer is processed.<br>
+/// Optionally, the file can be read with \c O_DIRECT, bypassing the page
+/// cache. Then the kernel does no read-ahead, so a background thread reads
+/// the file in aligned blocks into \a R aligned bounce buffers, and
+/// readData() returns the data from these buffers in the order in which they
+/// were read. A short read in the middle of the file is treated as the end of
+/// the file, since the following reads would not be aligned anymore. If the
+/// file system does not support direct I/O, the file is read normally.<br>
+/// When the end of the file is reached and more data is requested, readData()
+/// throws a \c std::runtime_error. Use atEnd() to check if all data was read.
+///
+/// @tparam  N
+///    The size of the internal buffer to use.
+/// @tparam  P
+///    The statistics policy to use by this class.<br>
+///    Default = EmptyReadPolicy, a policy that counts nothing.
+/// @tparam  R
+///    Number of blocks of size \a N to request read-ahead for, or to keep
+///    read ahead by the reader thread for direct I/O.
+/// @since  1.47.0, 18.10.2026
+template< size_t N, typename P = EmptyReadPolicy, size_t R = 4>
+   class FileReadBuffer: public ReadBuffer< N, P>
+{
+public:
+   static_assert( R > 0, "at least 1 block must be read ahead");
+
+   /// Constructor, opens the file.
+   ///
+   /// @param[in]  path
+   ///    The path and name of the file to read.
+   /// @param[in]  direct
+   ///    Set this flag to read the file using direct I/O.
+   /// @throw  std::runtime_error if the file could not be opened.
+   /// @since  1.47.0, 18.10.2026
+   explicit FileReadBuffer( const std::string& path, bool direct = false)
+      noexcept( false);
+
+   /// Destructor, stops the reader thread and closes the file.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   ~FileReadBuffer() override;
+
+   /// Returns the size of the file when it was opened.
+   ///
+   /// @return  The size of the file in bytes.
+   /// @since  1.47.0, 18.10.2026
+   size_t fileSize() const noexcept;
+
+   /// Returns if all data of the file was read and returned from the buffer.
+   ///
+   /// @return  \c true if the end of the file was reached.
+   /// @since  1.47.0, 18.10.2026
+   bool atEnd() const noexcept;
+
+   /// Returns if the file is read using direct I/O.
+   ///
+   /// @return  \c true if the file was opened with \c O_DIRECT.
+   /// @since  1.47.0, 18.10.2026
+   bool isDirect() const noexcept;
+
+protected:
+   /// Reads the next block of data from the file.
+   ///
+   /// @param[in]  data  Pointer to the buffer to read the data into.
+   /// @param[in]  len   Maximum length of the data to read.
+   /// @return  Number of bytes of data actually read.
+   /// @throw  std::runtime_error at the end of the file or on read errors.
+   /// @since  1.47.0, 18.10.2026
+   size_t readData( unsigned char* data, size_t len) override;
+
+private:
+   /// Size of the aligned blocks for direct I/O.
+   static constexpr size_t  DirectBlockSize =
+      ((N + detail::BufferAlignment - 1) / detail::BufferAlignment)
+      * detail::BufferAlignment;
+
+   /// Reads the next data from the file with \c pread(), retries on
+   /// interrupts.
+   ///
+   /// @param[in]  data    Pointer to the buffer to read the data into.
+   /// @param[in]  len     Length of the data to read.
+   /// @param[in]  offset  Position in the file to read from.
+   /// @return  Number of bytes of data actually read.
+   /// @since  1.47.0, 18.10.2026
+   size_t readFile( unsigned char* data, size_t len, size_t offset);
+
+   /// Direct I/O: Returns the data from the current bounce buffer, waits for
+   /// the reader thread if necessary.
+   ///
+   /// @param[in]  data  Pointer to the buffer to copy the data into.
+   /// @param[in]  len   Maximum length of the data to copy.
+   /// @return  Number of bytes of data actually copied.
+   /// @throw  std::runtime_error at the end of the file or on read errors.
+   /// @since  1.47.0, 18.10.2026
+   size_t readDirect( unsigned char* data, size_t len);
+
+   /// The function of the reader thread for direct I/O: Reads the file in
+   /// aligned blocks as long as a bounce buffer is free.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void readerLoop();
+
+   /// The file descriptor of the file.
+   int                              mFd = -1;
+   /// The size of the file.
+   size_t                           mFileSize = 0;
+   /// Number of bytes returned from readData() so far.
+   size_t                           mOffset = 0;
+   /// Set when the file is read with direct I/O.
+   bool                             mDirect = false;
+   /// The memory of the \a R bounce buffers for direct I/O.
+   detail::AlignedBuffer            mpBounce;
+   /// The length of the data read into each bounce buffer.
+   size_t                           mBounceLengths[ R] = {};
+   /// Index of the bounce buffer to return the data from.
+   size_t                           mConsumerIdx = 0;
+   /// Start of the data in the current bounce buffer not yet returned.
+   size_t                           mBounceStart = 0;
+   /// End of the data in the current bounce buffer, 0 when no bounce buffer
+   /// was taken from the reader thread yet.
+   size_t                           mBounceEnd = 0;
+   /// Index of the next bounce buffer to read into by the reader thread.
+   size_t                           mReaderIdx = 0;
+   /// Position in the file to read the next aligned block from, only used
+   /// by the reader thread.
+   size_t                           mDirectOffset = 0;
+   /// Protects the following members.
+   std::mutex                       mMutex;
+   /// Used to wake up the reader thread.
+   std::condition_variable          mReaderCond;
+   /// Used to wake up readData() waiting for a bounce buffer.
+   std::condition_variable          mConsumerCond;
+   /// Number of bounce buffers read and not yet returned completely.
+   size_t                           mNumFilled = 0;
+   /// Set when the reader thread reached the end of the file.
+   bool                             mReaderDone = false;
+   /// Set when the reader thread should stop.
+   bool                             mStop = false;
+   /// Exception from reading the file in the reader thread.
+   std::exception_ptr               mError;
+   /// The reader thread for direct I/O, must be the last member.
+   std::unique_ptr< ManagedThread>  mpReader;
+
+}; // FileReadBuffer< N, P, R>
+
+
+// inlined methods
+// ===============
+
+
+template< size_t N, typename P, size_t R>
+   FileReadBuffer< N, P, R>::FileReadBuffer( const std::string& path,
+                                             bool direct):
+      ReadBuffer< N, P>()
+{
+
+   if (direct)
+   {
+      mFd = ::open( path.c_str(), O_RDONLY | O_DIRECT);
+      // direct I/O is not supported by all file systems
+      if ((mFd == -1) && (errno == EINVAL))
+         direct = false;
+   } // end if
+
+   if (!direct)
+      mFd = ::open( path.c_str(), O_RDONLY);
+
+   if (mFd == -1)
+      throw std::runtime_error( "could not open file '" + path + "': "
+                                + ::strerror( errno));
+
+   struct stat  file_stat;
+
+   if (::fstat( mFd, &file_stat) == -1)
+   {
+      const std::string  err_text( ::strerror( errno));
+      ::close( mFd);
+      throw std::runtime_error( "could not get size of file '" + path + "': "
+                                + err_text);
+   } // end if
+
+   mFileSize = file_stat.st_size;
+   mDirect   = direct;
+
+   if (mDirect)
+   {
+      mpBounce = detail::makeAlignedBuffer( DirectBlockSize * R);
+      mpReader = std::make_unique< ManagedThread>( [this]() { readerLoop(); });
+   } else
+   {
+      ::posix_fadvise( mFd, 0, 0, POSIX_FADV_SEQUENTIAL);
+   } // end if
+
+} // FileReadBuffer< N, P, R>::FileReadBuffer
+
+
+template< size_t N, typename P, size_t R>
+   FileReadBuffer< N, P, R>::~FileReadBuffer()
+{
+   if (mpReader)
+   {
+      {
+         std::lock_guard< std::mutex>  lock( mMutex);
+         mStop = true;
+      } // end scope
+      mReaderCond.notify_one();
+      mpReader.reset();
+   } // end if
+
+   ::close( mFd);
+} // FileReadBuffer< N, P, R>::~FileReadBuffer
+
+
+template< size_t N, typename P, size_t R>
+   size_t FileReadBuffer< N, P, R>::fileSize() const noexcept
+{
+   return mFileSize;
+} // FileReadBuffer< N, P, R>::fileSize
+
+
+template< size_t N, typename P, size_t R>
+   bool FileReadBuffer< N, P, R>::atEnd() const noexcept
+{
+   return (mOffset >= mFileSize) && (this->available() == 0);
+} // FileReadBuffer< N, P, R>::atEnd
+
+
+template< size_t N, typename P, size_t R>
+   bool FileReadBuffer< N, P, R>::isDirect() const noexcept
+{
+   return mDirect;
+} // FileReadBuffer< N, P, R>::isDirect
+
+
+template< size_t N, typename P, size_t R>
+   size_t FileReadBuffer< N, P, R>::readData( unsigned char* data, size_t len)
+{
+
+   if (mOffset >= mFileSize)
+      throw std::runtime_error( "end of file reached");
+
+   size_t  data_read = 0;
+
+   if (mDirect)
+   {
+      data_read = readDirect( data, len);
+   } else
+   {
+      data_read = readFile( data, len, mOffset);
+      // let the kernel read the next blocks while this data is processed
+      ::posix_fadvise( mFd, mOffset + data_read, N * R, POSIX_FADV_WILLNEED);
+   } // end if
+
+   mOffset += data_read;
+
+   return data_read;
+} // FileReadBuffer< N, P, R>::readData
+
+
+template< size_t N, typename P, size_t R>
+   size_t FileReadBuffer< N, P, R>::readFile( unsigned char* data, size_t len,
+                                              size_t offset)
+{
+
+   for (;;)
+   {
+      const auto  result = ::pread( mFd, data, len, offset);
+
+      if (result > 0)
+         return result;
+      if (result == 0)
+         throw std::runtime_error( "end of file reached");
+      if (errno != EINTR)
+         throw std::runtime_error( std::string( "could not read from file: ")
+                                   + ::strerror( errno));
+   } // end for
+
+} // FileReadBuffer< N, P, R>::readFile
+
+
+template< size_t N, typename P, size_t R>
+   size_t FileReadBuffer< N, P, R>::readDirect( unsigned char* data,
+                                                size_t len)
+{
+
+   if (mBounceStart == mBounceEnd)
+   {
+      std::unique_lock< std::mutex>  lock( mMutex);
+
+      // give the bounce buffer that was returned completely back to the
+      // reader thread
+      if (mBounceEnd > 0)
+      {
+         --mNumFilled;
+         mConsumerIdx = (mConsumerIdx + 1) % R;
+         mBounceStart = mBounceEnd = 0;
+         mReaderCond.notify_one();
+      } // end if
+
+      mConsumerCond.wait( lock, [this]()
+         {
+            return (mNumFilled > 0) || mReaderDone;
+         });
+
+      if (mNumFilled == 0)
+      {
+         if (mError)
+            std::rethrow_exception( mError);
+         throw std::runtime_error( "end of file reached");
+      } // end if
+
+      mBounceEnd = mBounceLengths[ mConsumerIdx];
+   } // end if
+
+   const size_t  data_read = std::min( len, mBounceEnd - mBounceStart);
+
+   ::memcpy( data, &mpBounce[ mConsumerIdx * DirectBlockSize + mBounceStart],
+             data_read);
+   mBounceStart += data_read;
+
+   return data_read;
+} // FileReadBuffer< N, P, R>::readDirect
+
+
+template< size_t N, typename P, size_t R>
+   void FileReadBuffer< N, P, R>::readerLoop()
+{
+
+   for (;;)
+   {
+      {
+         std::unique_lock< std::mutex>  lock( mMutex);
+         mReaderCond.wait( lock, [this]() { return mStop || (mNumFilled < R); });
+         if (mStop)
+            return;
+      } // end scope
+
+      size_t  data_read = 0;
+
+      try
+      {
+         if (mDirectOffset < mFileSize)
+            data_read = readFile( &mpBounce[ mReaderIdx * DirectBlockSize],
+                                  DirectBlockSize, mDirectOffset);
+      } catch (...)
+      {
+         std::lock_guard< std::mutex>  lock( mMutex);
+         mError = std::current_exception();
+         mReaderDone = true;
+         mConsumerCond.notify_one();
+         return;
+      } // end try
+
+      mDirectOffset += data_read;
+
+      {
+         std::lock_guard< std::mutex>  lock( mMutex);
+         if (data_read > 0)
+         {
+            mBounceLengths[ mReaderIdx] = data_read;
+            mReaderIdx = (mReaderIdx + 1) % R;
+            ++mNumFilled;
+         } // end if
+         // after a short read, the next read would not be aligned anymore
+         if (data_read < DirectBlockSize)
+            mReaderDone = true;
+      } // end scope
+      mConsumerCond.notify_one();
+
+      if (data_read < DirectBlockSize)
+         return;
+   } // end for
+
+} // FileReadBuffer< N, P, R>::readerLoop
+
+
+} // namespace celma::common
+
+
+// =====  END OF file_read_buffer.hpp  =====
+
@@ -0,0 +1,198 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of template class celma::common::FileWriteBuffer<>.
+
+
+#pragma once
+
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include "celma/common/async_write_buffer.hpp"
+
+
+namespace celma::common {
+
+
+/// Writes data into a file, using an AsyncWriteBuffer: While the flusher
+/// thread writes one buffer with \c pwrite(), up to \a B - 1 further buffers
+/// can be filled and queued.<br>
+/// Optionally, the file can be written with \c O_DIRECT, bypassing the page
+/// cache. This requires that the buffer size \a N is a multiple of the block
+/// size (see detail::BufferAlignment). Since the last buffer is usually not
+/// full, direct I/O is switched off for this last write. If the file system
+/// does not support direct I/O, the file is written normally.<br>
+/// The file is created, or truncated if it exists already. The destructor
+/// writes the remaining data, call drain() before to get notified about write
+/// errors.
+///
+/// @tparam  N
+///    The size of each buffer.
+/// @tparam  P
+///    The statistics policy to use by this class.<br>
+///    Default = EmptyWritePolicy, a policy that counts nothing.
+/// @tparam  B
+///    The number of buffers to use.
+/// @since  1.47.0, 18.10.2026
+template< size_t N, typename P = EmptyWritePolicy, size_t B = 4>
+   class FileWriteBuffer: public AsyncWriteBuffer< N, P, B>
+{
+public:
+   /// Constructor, creates the file.
+   ///
+   /// @param[in]  path
+   ///    The path and name of the file to write.
+   /// @param[in]  direct
+   ///    Set this flag to write the file using direct I/O.
+   /// @throw  std::invalid_argument if direct I/O is requested, but the buffer
+   ///         size is not a multiple of the block size.
+   /// @throw  std::runtime_error if the file could not be created.
+   /// @since  1.47.0, 18.10.2026
+   explicit FileWriteBuffer( const std::string& path, bool direct = false)
+      noexcept( false);
+
+   /// Destructor, writes the remaining data and closes the file.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   ~FileWriteBuffer() override;
+
+   /// Returns if the file is currently written using direct I/O.
+   ///
+   /// @return  \c true if the file was opened with \c O_DIRECT.
+   /// @since  1.47.0, 18.10.2026
+   bool isDirect() const noexcept;
+
+protected:
+   /// Called from the flusher thread to write the data into the file.
+   ///
+   /// @param[in]  data  Pointer to the beginning of the data block to write.
+   /// @param[in]  len   Length of the data block to write.
+   /// @throw  std::runtime_error if the data could not be written.
+   /// @since  1.47.0, 18.10.2026
+   void writeData( const unsigned char* const data, size_t len) const override;
+
+private:
+   /// The file descriptor of the file.
+   int                         mFd = -1;
+   /// Position in the file to write the next data block to.
+   mutable size_t              mOffset = 0;
+   /// Set while the file is written with direct I/O. Cleared by the flusher
+   /// thread, read by the user thread.
+   mutable std::atomic< bool>  mDirect { false };
+
+}; // FileWriteBuffer< N, P, B>
+
+
+// inlined methods
+// ===============
+
+
+template< size_t N, typename P, size_t B>
+   FileWriteBuffer< N, P, B>::FileWriteBuffer( const std::string& path,
+                                               bool direct):
+      AsyncWriteBuffer< N, P, B>()
+{
+
+   constexpr int  flags = O_WRONLY | O_CREAT | O_TRUNC;
+
+   if (direct)
+   {
+      if (N % detail::BufferAlignment != 0)
+         throw std::invalid_argument( "buffer size must be a multiple of "
+            + std::to_string( detail::BufferAlignment) + " for direct I/O");
+
+      mFd = ::open( path.c_str(), flags | O_DIRECT, 0644);
+      // direct I/O is not supported by all file systems
+      if ((mFd == -1) && (errno == EINVAL))
+         direct = false;
+   } // end if
+
+   if (!direct)
+      mFd = ::open( path.c_str(), flags, 0644);
+
+   if (mFd == -1)
+      throw std::runtime_error( "could not create file '" + path + "': "
+                                + ::strerror( errno));
+
+   mDirect = direct;
+
+} // FileWriteBuffer< N, P, B>::FileWriteBuffer
+
+
+template< size_t N, typename P, size_t B>
+   FileWriteBuffer< N, P, B>::~FileWriteBuffer()
+{
+   try
+   {
+      this->drain();
+   } catch (...)
+   {
+      // nothing we can do here
+   } // end try
+   ::close( mFd);
+} // FileWriteBuffer< N, P, B>::~FileWriteBuffer
+
+
+template< size_t N, typename P, size_t B>
+   bool FileWriteBuffer< N, P, B>::isDirect() const noexcept
+{
+   return mDirect.load( std::memory_order_relaxed);
+} // FileWriteBuffer< N, P, B>::isDirect
+
+
+template< size_t N, typename P, size_t B>
+   void FileWriteBuffer< N, P, B>::writeData( const unsigned char* const data,
+                                              size_t len) const
+{
+
+   if (mDirect.load( std::memory_order_relaxed)
+       && (len % detail::BufferAlignment != 0))
+   {
+      // a partial block cannot be written with direct I/O
+      ::fcntl( mFd, F_SETFL, ::fcntl( mFd, F_GETFL) & ~O_DIRECT);
+      mDirect.store( false, std::memory_order_relaxed);
+   } // end if
+
+   size_t  written = 0;
+
+   while (written < len)
+   {
+      const auto  result = ::pwrite( mFd, data + written, len - written,
+                                     mOffset + written);
+
+      if (result > 0)
+         written += result;
+      else if (result == 0)
+         throw std::runtime_error( "could not write into file: no data written");
+      else if (errno != EINTR)
+         throw std::runtime_error( std::string( "could not write into file: ")
+                                   + ::strerror( errno));
+   } // end while
+
+   mOffset += len;
+
+} // FileWriteBuffer< N, P, B>::writeData
+
+
+} // namespace celma::common
+
+
+// =====  END OF file_write_buffer.hpp  =====
+
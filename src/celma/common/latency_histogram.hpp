@@ -0,0 +1,372 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of classes celma::common::LatencyHistogram,
+/// celma::common::HistogramRecorder and celma::common::HistogramSnapshot.
+
+
+#pragma once
+
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+namespace celma::common {
+
+
+/// Log-linear bucket layout of the latency histograms, like in the
+/// HdrHistogram: Values below 128 get their own bucket. Above, each power of
+/// two range is divided into 64 buckets of equal width. The relative error of
+/// a value is thus at most 1/64 (1.6 %), over the full 64 bit range, with
+/// 3776 buckets.
+///
+/// @since  1.47.0, 18.10.2026
+struct HistogramBuckets
+{
+   /// Number of bits used for the linear part.
+   static constexpr int       SubBucketBits = 7;
+   /// Number of buckets per power of two range.
+   static constexpr uint64_t  SubBucketHalf = uint64_t( 1) << (SubBucketBits - 1);
+   /// Total number of buckets.
+   static constexpr size_t    NumBuckets = (64 - SubBucketBits + 2)
+                                           * SubBucketHalf;
+
+   /// Returns the index of the bucket for a value.
+   ///
+   /// @param[in]  value  The value to return the bucket index of.
+   /// @return  The index of the bucket.
+   /// @since  1.47.0, 18.10.2026
+   static size_t index( uint64_t value) noexcept
+   {
+      if (value < 2 * SubBucketHalf)
+         return static_cast< size_t>( value);
+      const int  shift = 63 - __builtin_clzll( value) - (SubBucketBits - 1);
+      return static_cast< size_t>( shift * SubBucketHalf + (value >> shift));
+   } // HistogramBuckets::index
+
+   /// Returns the smallest value that is counted in a bucket.
+   ///
+   /// @param[in]  idx  The index of the bucket.
+   /// @return  The lower bound of the bucket.
+   /// @since  1.47.0, 18.10.2026
+   static uint64_t lowerBound( size_t idx) noexcept
+   {
+      if (idx < 2 * SubBucketHalf)
+         return idx;
+      const uint64_t  shift = idx / SubBucketHalf - 1;
+      return (idx - shift * SubBucketHalf) << shift;
+   } // HistogramBuckets::lowerBound
+
+   /// Returns the largest value that is counted in a bucket.
+   ///
+   /// @param[in]  idx  The index of the bucket.
+   /// @return  The upper bound of the bucket.
+   /// @since  1.47.0, 18.10.2026
+   static uint64_t upperBound( size_t idx) noexcept
+   {
+      if (idx < 2 * SubBucketHalf)
+         return idx;
+      const uint64_t  shift = idx / SubBucketHalf - 1;
+      return lowerBound( idx) + ((uint64_t( 1) << shift) - 1);
+   } // HistogramBuckets::upperBound
+
+}; // HistogramBuckets
+
+
+/// Records values into a log-linear histogram, in constant time and without
+/// allocating memory.<br>
+/// A recorder must only be written by one thread. It uses no atomic
+/// read-modify-write operations, the counters are atomics only so that
+/// another thread can take a snapshot while values are recorded.<br>
+/// Use LatencyHistogram to create one recorder per thread and merge them.
+///
+/// @since  1.47.0, 18.10.2026
+class HistogramRecorder
+{
+public:
+   HistogramRecorder() = default;
+   HistogramRecorder( const HistogramRecorder&) = delete;
+   ~HistogramRecorder() = default;
+   HistogramRecorder& operator =( const HistogramRecorder&) = delete;
+
+   /// Records a value.
+   ///
+   /// @param[in]  value  The value to record.
+   /// @since  1.47.0, 18.10.2026
+   void record( uint64_t value) noexcept;
+
+   /// Records a time period, in nanoseconds.
+   ///
+   /// @param[in]  period  The time period to record, negative values are
+   ///                     recorded as 0.
+   /// @since  1.47.0, 18.10.2026
+   void record( std::chrono::nanoseconds period) noexcept;
+
+   /// Records the same value multiple times.
+   ///
+   /// @param[in]  value  The value to record.
+   /// @param[in]  count  How often to record the value.
+   /// @since  1.47.0, 18.10.2026
+   void record( uint64_t value, uint64_t count) noexcept;
+
+private:
+   friend class HistogramSnapshot;
+
+   using Counter = std::atomic< uint64_t>;
+
+   /// Adds to a counter. Only the owning thread writes, so load and store
+   /// suffice.
+   ///
+   /// @param[in]  counter  The counter to increment.
+   /// @param[in]  add      The value to add.
+   /// @since  1.47.0, 18.10.2026
+   static void add( Counter& counter, uint64_t add) noexcept
+   {
+      counter.store( counter.load( std::memory_order_relaxed) + add,
+                     std::memory_order_relaxed);
+   } // HistogramRecorder::add
+
+   /// Number of values per bucket.
+   std::array< Counter, HistogramBuckets::NumBuckets>  mCounts{};
+   /// Sum of all values recorded.
+   Counter  mSum{ 0};
+   /// Smallest value recorded.
+   Counter  mMin{ std::numeric_limits< uint64_t>::max()};
+   /// Largest value recorded.
+   Counter  mMax{ 0};
+
+}; // HistogramRecorder
+
+
+/// Range and number of values of one bucket, for exporting the raw counts.
+///
+/// @since  1.47.0, 18.10.2026
+struct HistogramBucket
+{
+   /// Smallest value of the bucket.
+   uint64_t  mLow;
+   /// Largest value of the bucket.
+   uint64_t  mHigh;
+   /// Number of values in the bucket.
+   uint64_t  mCount;
+
+}; // HistogramBucket
+
+
+/// Contents of one or more histogram recorders at a point in time, used to
+/// compute the percentiles.
+///
+/// @since  1.47.0, 18.10.2026
+class HistogramSnapshot
+{
+public:
+   /// Constructor, creates an empty snapshot.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   HistogramSnapshot();
+
+   /// Adds the current values of a recorder. The recorder may be in use by
+   /// another thread.
+   ///
+   /// @param[in]  recorder  The recorder to add the values of.
+   /// @since  1.47.0, 18.10.2026
+   void merge( const HistogramRecorder& recorder);
+
+   /// Adds the values of another snapshot.
+   ///
+   /// @param[in]  other  The snapshot to add the values of.
+   /// @since  1.47.0, 18.10.2026
+   void merge( const HistogramSnapshot& other);
+
+   /// Returns the number of values recorded.
+   ///
+   /// @return  The number of values.
+   /// @since  1.47.0, 18.10.2026
+   uint64_t count() const noexcept;
+
+   /// Returns the smallest value recorded.
+   ///
+   /// @return  The minimum, 0 if the snapshot is empty.
+   /// @since  1.47.0, 18.10.2026
+   uint64_t min() const noexcept;
+
+   /// Returns the largest value recorded.
+   ///
+   /// @return  The maximum, 0 if the snapshot is empty.
+   /// @since  1.47.0, 18.10.2026
+   uint64_t max() const noexcept;
+
+   /// Returns the average of the values recorded.
+   ///
+   /// @return  The mean value, 0 if the snapshot is empty.
+   /// @since  1.47.0, 18.10.2026
+   double mean() const noexcept;
+
+   /// Returns the value below or at which the given percentage of the values
+   /// lies, e.g. 99.9 for p99.9.<br>
+   /// The result is the upper bound of the bucket, limited to the maximum.
+   ///
+   /// @param[in]  percent  The percentile to return, 0 .. 100.
+   /// @return  The value of the percentile, 0 if the snapshot is empty.
+   /// @since  1.47.0, 18.10.2026
+   uint64_t percentile( double percent) const noexcept;
+
+   /// Returns the number of values per bucket, indexed as defined by
+   /// HistogramBuckets.
+   ///
+   /// @return  The raw counts.
+   /// @since  1.47.0, 18.10.2026
+   const std::vector< uint64_t>& counts() const noexcept;
+
+   /// Returns the range and number of values of all buckets that contain
+   /// values.
+   ///
+   /// @return  The non-empty buckets, sorted by value.
+   /// @since  1.47.0, 18.10.2026
+   std::vector< HistogramBucket> buckets() const;
+
+private:
+   /// Number of values per bucket.
+   std::vector< uint64_t>  mCounts;
+   /// Number of values recorded.
+   uint64_t                mTotalCount = 0;
+   /// Sum of all values recorded.
+   uint64_t                mSum = 0;
+   /// Smallest value recorded.
+   uint64_t                mMin = std::numeric_limits< uint64_t>::max();
+   /// Largest value recorded.
+   uint64_t                mMax = 0;
+
+}; // HistogramSnapshot
+
+
+/// Latency histogram with one recorder per thread.<br>
+/// Each thread that records values calls createRecorder() once and then
+/// records into its own recorder, without synchronisation. snapshot() merges
+/// all recorders to compute the percentiles.<br>
+/// Usage:
+/// @code
+///   LatencyHistogram  latencies;
+///   // in each worker thread
+///   auto&  rec = latencies.createRecorder();
+///   rec.record( timer.timed());
+///   // in the reporting thread
+///   auto  snap = latencies.snapshot();
+///   std::cout << "p99 = " << snap.percentile( 99.0) << " ns\n";
+/// @endcode
+///
+/// @since  1.47.0, 18.10.2026
+class LatencyHistogram
+{
+public:
+   LatencyHistogram() = default;
+   LatencyHistogram( const LatencyHistogram&) = delete;
+   ~LatencyHistogram() = default;
+   LatencyHistogram& operator =( const LatencyHistogram&) = delete;
+
+   /// Creates a new recorder. The recorder remains valid as long as the
+   /// histogram exists.
+   ///
+   /// @return  The new recorder, for use by one thread.
+   /// @since  1.47.0, 18.10.2026
+   HistogramRecorder& createRecorder();
+
+   /// Merges the current values of all recorders.
+   ///
+   /// @return  The snapshot with the values of all recorders.
+   /// @since  1.47.0, 18.10.2026
+   HistogramSnapshot snapshot() const;
+
+private:
+   /// Protects the list of recorders.
+   mutable std::mutex                                mMutex;
+   /// The recorders created.
+   std::vector< std::unique_ptr< HistogramRecorder>>  mRecorders;
+
+}; // LatencyHistogram
+
+
+// inlined methods
+// ===============
+
+
+inline void HistogramRecorder::record( uint64_t value) noexcept
+{
+   record( value, 1);
+} // HistogramRecorder::record
+
+
+inline void HistogramRecorder::record( std::chrono::nanoseconds period) noexcept
+{
+   record( (period.count() < 0) ? 0 : static_cast< uint64_t>( period.count()),
+           1);
+} // HistogramRecorder::record
+
+
+inline void HistogramRecorder::record( uint64_t value, uint64_t count) noexcept
+{
+
+   add( mCounts[ HistogramBuckets::index( value)], count);
+   add( mSum, value * count);
+
+   if (value < mMin.load( std::memory_order_relaxed))
+      mMin.store( value, std::memory_order_relaxed);
+   if (value > mMax.load( std::memory_order_relaxed))
+      mMax.store( value, std::memory_order_relaxed);
+
+} // HistogramRecorder::record
+
+
+inline uint64_t HistogramSnapshot::count() const noexcept
+{
+   return mTotalCount;
+} // HistogramSnapshot::count
+
+
+inline uint64_t HistogramSnapshot::min() const noexcept
+{
+   return (mTotalCount == 0) ? 0 : mMin;
+} // HistogramSnapshot::min
+
+
+inline uint64_t HistogramSnapshot::max() const noexcept
+{
+   return mMax;
+} // HistogramSnapshot::max
+
+
+inline double HistogramSnapshot::mean() const noexcept
+{
+   return (mTotalCount == 0) ? 0.0 : static_cast< double>( mSum)
+                                     / static_cast< double>( mTotalCount);
+} // HistogramSnapshot::mean
+
+
+inline const std::vector< uint64_t>& HistogramSnapshot::counts() const noexcept
+{
+   return mCounts;
+} // HistogramSnapshot::counts
+
+
+} // namespace celma::common
+
+
+// =====  END OF latency_histogram.hpp  =====
@@ -3,7 +3,7 @@
 **
 **    ####   ######  #       #    #   ####
 **   #    #  #       #       ##  ##  #    #
-**   #       ###     #       # ## #  ######    (C) 2017-2020 Rene Eng
+**   #       ###     #       # ## #  ######    (C) 2017-2026 Rene Eng
 **   #    #  #       #       #    #  #    #        LGPL
 **    ####   ######  ######  #    #  #    #
 **
@@ -20,19 +20,72 @@
 
 
 #include <atomic>
+#include <exception>
+#include <future>
+#include <string>
 #include <thread>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 
 namespace celma { namespace common {
 
 
+/// Options for the thread created by a ManagedThread object. The options are
+/// applied by the new thread itself, before the thread function is called.
+/// @since  1.47.0, 18.10.2026
+struct ThreadOptions
+{
+   /// The name of the thread, set with \c pthread_setname_np(). Names longer
+   /// than 15 characters are truncated. Empty to keep the name.
+   std::string        mName;
+   /// The CPUs that the thread may run on. Empty to keep the affinity.
+   std::vector< int>  mCpus;
+   /// The scheduling policy, e.g. \c SCHED_FIFO. -1 to keep the policy and
+   /// priority.
+   int                mSchedPolicy = -1;
+   /// The scheduling priority, used together with \a mSchedPolicy.
+   int                mSchedPriority = 0;
+   /// If set, memory is allocated on the NUMA node of the CPU that the thread
+   /// runs on (policy \c MPOL_LOCAL), overriding an inherited memory policy.
+   /// Combined with a CPU set on one node, the stack pages and all memory
+   /// first touched by the thread are then placed on this node.
+   bool               mNumaLocal = false;
+
+}; // ThreadOptions
+
+
+namespace detail {
+
+
+/// Holds the data of a ManagedThread that is accessed by the new thread.<br>
+/// Used as first base class of ManagedThread, so that the data is initialised
+/// before the thread is started by the \c std::thread base class.
+/// @since  1.47.0, 18.10.2026
+class ManagedThreadFlag
+{
+public:
+   /// Flag, set by the thread before the thread function is executed, cleared
+   /// when the thread function returnes, i.e. finished its work.
+   std::atomic< bool>  mActive{ false};
+   /// Result of applying the thread options, set by the new thread.
+   std::promise< void>  mSetupResult;
+
+}; // ManagedThreadFlag
+
+
+} // namespace detail
+
+
 /// Small helper class that provides the information if the thread is still
 /// active or if it finished its work.<br>
 /// When this object is destroyed, it calls \c join(), so the calling
-/// application does not need to do that.
+/// application does not need to do that.<br>
+/// Using ThreadOptions, the thread can be named, bound to CPUs, given a
+/// scheduling policy and NUMA-local memory placement.
 /// @since  012, 19.01.2017
-class ManagedThread final: public std::thread
+class ManagedThread final: private detail::ManagedThreadFlag, public std::thread
 {
 public:
    /// Constructor, creates the thread which immediately starts its work.
@@ -42,8 +95,27 @@ public:
    /// @param[in]  f     The function to execute in the thread.
    /// @param[in]  args  The parameters for the thread function.
    /// @since  012, 19.01.2017
+   template< class Function, class... Args, typename = std::enable_if_t<
+      !std::is_same_v< std::decay_t< Function>, ThreadOptions>>>
+         explicit ManagedThread( Function&& f, Args&&... args);
+
+   /// Constructor, creates the thread, which applies the options and then
+   /// calls the thread function.<br>
+   /// Returns when the options are applied.
+   /// @tparam  Function  The type of the function to be called by the thread.
+   /// @tparam  Args...   The types of the parameters to be passed to the
+   ///                    function.
+   /// @param[in]  options  The options to apply.
+   /// @param[in]  f        The function to execute in the thread.
+   /// @param[in]  args     The parameters for the thread function.
+   /// @throw  std::invalid_argument if a CPU number is invalid.
+   /// @throw  std::system_error if an option could not be applied, e.g. if
+   ///         the process may not use a CPU or scheduling policy. In this
+   ///         case the thread function is not called.
+   /// @since  1.47.0, 18.10.2026
    template< class Function, class... Args>
-      explicit ManagedThread( Function&& f, Args&&... args);
+      ManagedThread( const ThreadOptions& options, Function&& f,
+                     Args&&... args) noexcept( false);
 
    // copy-construction is not allowed
    ManagedThread( const ManagedThread&) = delete;
@@ -61,17 +133,29 @@ public:
    /// @since  012, 19.01.2017
    bool isActive() const noexcept;
 
+   /// Applies thread options to the calling thread.
+   /// @param[in]  options  The options to apply.
+   /// @throw  std::invalid_argument if a CPU number is invalid.
+   /// @throw  std::system_error if an option could not be applied.
+   /// @since  1.47.0, 18.10.2026
+   static void applyOptions( const ThreadOptions& options) noexcept( false);
+
+   /// Returns the CPU that the calling thread currently runs on.
+   /// @return  The number of the CPU, -1 if it could not be determined.
+   /// @since  1.47.0, 18.10.2026
+   static int currentCpu() noexcept;
+
+   /// Returns the NUMA node that the calling thread currently runs on.
+   /// @return  The number of the NUMA node, -1 if it could not be determined.
+   /// @since  1.47.0, 18.10.2026
+   static int currentNumaNode() noexcept;
+
    // copy-assignment is not allowed
    ManagedThread& operator =( const ManagedThread&) = delete;
 
    // move-assignment is also not allowed
    ManagedThread& operator =( ManagedThread&&) = delete;
 
-private:
-   /// Flag, set by the thread before the thread function is executed, cleared
-   /// when the thread function returnes, i.e. finished its work.
-   std::atomic< bool>  mActive{ false};
-
 }; // ManagedThread
 
 
@@ -79,7 +163,7 @@ private:
 // ===============
 
 
-template< class Function, class... Args>
+template< class Function, class... Args, typename>
    ManagedThread::ManagedThread( Function&& f, Args&&... args):
       std::thread( [ func = std::forward< Function>( f), flag = &mActive]
                    ( Args&&... lbd_args)
@@ -94,6 +178,42 @@ template< class Function, class... Args>
 } // ManagedThread::ManagedThread
 
 
+template< class Function, class... Args>
+   ManagedThread::ManagedThread( const ThreadOptions& options, Function&& f,
+                                 Args&&... args) noexcept( false):
+      std::thread( [ func = std::forward< Function>( f), options,
+                     base = static_cast< detail::ManagedThreadFlag*>( this)]
+                   ( Args&&... lbd_args) mutable
+                   {
+                      try
+                      {
+                         applyOptions( options);
+                      } catch (...)
+                      {
+                         base->mSetupResult.set_exception(
+                            std::current_exception());
+                         return;
+                      } // end try
+                      base->mActive.store( true, std::memory_order_release);
+                      base->mSetupResult.set_value();
+                      func( std::forward< Args>( lbd_args)...);
+                      base->mActive.store( false, std::memory_order_release);
+                   },
+                   std::forward< Args>( args)...)
+{
+
+   try
+   {
+      mSetupResult.get_future().get();
+   } catch (...)
+   {
+      join();
+      throw;
+   } // end try
+
+} // ManagedThread::ManagedThread
+
+
 inline ManagedThread::~ManagedThread()
 {
    if (joinable())
@@ -115,4 +235,3 @@ inline bool ManagedThread::isActive() const noexcept
 
 
 // =====  END OF managed_thread.hpp  =====
-
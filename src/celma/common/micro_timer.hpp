@@ -31,7 +31,10 @@ namespace celma { namespace common {
 // ================
 
 
-/// Simple class for measuring time periods with microsecond granularity.
+/// Simple class for measuring time periods with microsecond granularity.<br>
+/// Uses \c gettimeofday(), i.e. the wall-clock time, which may jump when the
+/// system time is changed. For time measurements with a monotonic clock and
+/// nanosecond resolution use NanoTimer.
 /// @since  0.13.5, 28.02.2017
 class MicroTimer
 {
@@ -238,6 +241,9 @@ public:
    uint64_t sumTime() const;
 
    /// Returns the average time per event (timer) in microseconds.
+   /// @return  The average time, 0 if no time was measured yet.
+   /// @since  1.47.0, 18.10.2026
+   ///    (returns 0 instead of dividing by zero)
    /// @since  0.13.5, 28.02.2017
    uint64_t averageTime() const;
 
@@ -304,7 +310,7 @@ inline uint64_t AverageMicroTimer::sumTime() const
 
 inline uint64_t AverageMicroTimer::averageTime() const
 {
-   return mTimeSum / mEvents;
+   return (mEvents == 0) ? 0 : mTimeSum / mEvents;
 } // AverageMicroTimer::averageTime
 
 
@@ -315,11 +321,17 @@ inline uint64_t AverageMicroTimer::averageTime() const
 /// Helper function to calculate the units per second.
 /// @param[in]  number  Number of units handled in the measured time.
 /// @param[in]  mt      The timer used to stop the time.
-/// @return  The average number of units per second.
+/// @return  The average number of units per second, 0 if no time was
+///          measured.
+/// @since  1.47.0, 18.10.2026
+///    (returns 0 instead of dividing by zero)
 /// @since  0.13.5, 28.02.2017
 inline double avgPerSecond( int64_t number, const MicroTimer& mt)
 {
 
+   if (mt.timed() == 0)
+      return 0.0;
+
    // number * 1'000'000 [ms] / time [ms] = avg/s
    return (static_cast< double>( number) * 1000000.0) /
           static_cast< double>( mt.timed());
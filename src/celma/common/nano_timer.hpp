@@ -0,0 +1,370 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of classes celma::common::NanoTimer,
+/// celma::common::TimerStatistics and celma::common::ScopeTimer.
+
+
+#pragma once
+
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+
+namespace celma::common {
+
+
+/// Timer with nanosecond resolution, based on a monotonic clock.<br>
+/// Unlike MicroTimer, which uses \c gettimeofday(), the time measured is not
+/// affected by changes of the system time.
+///
+/// @tparam  C  The clock to use, \c std::chrono::steady_clock or TscClock.
+/// @since  1.47.0, 18.10.2026
+template< typename C = std::chrono::steady_clock> class NanoTimer
+{
+public:
+   using clock_type = C;
+
+   NanoTimer() = default;
+
+   /// Starts the timer.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void start() noexcept;
+
+   /// Stops the timer.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void stop() noexcept;
+
+   /// Returns the time measured between the start() and stop() calls.
+   ///
+   /// @return  The time for which the timer was running.
+   /// @since  1.47.0, 18.10.2026
+   std::chrono::nanoseconds timed() const noexcept;
+
+   /// Returns the time elapsed since start() was called, the timer continues
+   /// to run.
+   ///
+   /// @return  The time since the timer was started.
+   /// @since  1.47.0, 18.10.2026
+   std::chrono::nanoseconds elapsed() const noexcept;
+
+   /// Returns if the timer was started and is currently measuring time.
+   ///
+   /// @return  \c true if the timer was started and is measuring time.
+   /// @since  1.47.0, 18.10.2026
+   bool started() const noexcept;
+
+   /// Returns if the timer was stopped and can provide a measured time.
+   ///
+   /// @return  \c true if the timer was stopped and has measured a time.
+   /// @since  1.47.0, 18.10.2026
+   bool stopped() const noexcept;
+
+private:
+   /// The time when the timer was started.
+   typename C::time_point  mStart{};
+   /// The time when the timer was stopped.
+   typename C::time_point  mEnd{};
+   /// Flag, set when the timer is currently started.
+   bool                    mStarted = false;
+   /// Flag, set when the timer was started and stopped.
+   bool                    mStopped = false;
+
+}; // NanoTimer
+
+
+/// Collects time periods and provides the number of measurements, minimum,
+/// maximum, mean and standard deviation.<br>
+/// Mean and variance are computed incrementally (Welford's algorithm), so
+/// adding a value takes constant time and the results are numerically stable.
+/// The object is not thread-safe.
+///
+/// @since  1.47.0, 18.10.2026
+class TimerStatistics
+{
+public:
+   TimerStatistics() = default;
+
+   /// Adds a time period.
+   ///
+   /// @param[in]  period  The time period to add.
+   /// @since  1.47.0, 18.10.2026
+   void add( std::chrono::nanoseconds period) noexcept;
+
+   /// Resets all values.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void reset() noexcept;
+
+   /// Returns the number of time periods added.
+   ///
+   /// @return  The number of measurements.
+   /// @since  1.47.0, 18.10.2026
+   uint64_t count() const noexcept;
+
+   /// Returns the sum of all time periods.
+   ///
+   /// @return  The total time measured.
+   /// @since  1.47.0, 18.10.2026
+   std::chrono::nanoseconds sum() const noexcept;
+
+   /// Returns the shortest time period.
+   ///
+   /// @return  The minimum, 0 if nothing was measured yet.
+   /// @since  1.47.0, 18.10.2026
+   std::chrono::nanoseconds min() const noexcept;
+
+   /// Returns the longest time period.
+   ///
+   /// @return  The maximum, 0 if nothing was measured yet.
+   /// @since  1.47.0, 18.10.2026
+   std::chrono::nanoseconds max() const noexcept;
+
+   /// Returns the average time period in nanoseconds.
+   ///
+   /// @return  The mean value, 0 if nothing was measured yet.
+   /// @since  1.47.0, 18.10.2026
+   double mean() const noexcept;
+
+   /// Returns the sample standard deviation in nanoseconds.
+   ///
+   /// @return  The standard deviation, 0 for less than 2 measurements.
+   /// @since  1.47.0, 18.10.2026
+   double stddev() const noexcept;
+
+private:
+   /// Number of time periods added.
+   uint64_t  mCount = 0;
+   /// Sum of all time periods, in nanoseconds.
+   int64_t   mSum = 0;
+   /// Shortest time period, in nanoseconds.
+   int64_t   mMin = std::numeric_limits< int64_t>::max();
+   /// Longest time period, in nanoseconds.
+   int64_t   mMax = 0;
+   /// Running mean.
+   double    mMean = 0.0;
+   /// Running sum of the squared differences from the mean.
+   double    mM2 = 0.0;
+
+}; // TimerStatistics
+
+
+/// Measures the time between its construction and destruction and adds it to
+/// a TimerStatistics object.<br>
+/// Usage:
+/// @code
+///   TimerStatistics  stats;
+///   for (auto& msg : messages)
+///   {
+///      ScopeTimer<>  st( stats);
+///      handle( msg);
+///   }
+/// @endcode
+///
+/// @tparam  C  The clock to use, \c std::chrono::steady_clock or TscClock.
+/// @since  1.47.0, 18.10.2026
+template< typename C = std::chrono::steady_clock> class ScopeTimer
+{
+public:
+   /// Constructor, starts the time measurement.
+   ///
+   /// @param[in]  stats  The object to add the time measured to.
+   /// @since  1.47.0, 18.10.2026
+   explicit ScopeTimer( TimerStatistics& stats) noexcept;
+
+   ScopeTimer( const ScopeTimer&) = delete;
+   ScopeTimer& operator =( const ScopeTimer&) = delete;
+
+   /// Destructor, adds the time elapsed since construction to the statistics.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   ~ScopeTimer();
+
+private:
+   /// The object to add the time to.
+   TimerStatistics&        mStats;
+   /// When the scope was entered.
+   typename C::time_point  mStart;
+
+}; // ScopeTimer
+
+
+// helper functions
+// ================
+
+
+/// Helper function to calculate the units per second.
+///
+/// @param[in]  number  Number of units handled in the measured time.
+/// @param[in]  period  The time measured.
+/// @return  The average number of units per second, 0 if \a period is 0.
+/// @since  1.47.0, 18.10.2026
+inline double avgPerSecond( int64_t number, std::chrono::nanoseconds period)
+{
+
+   if (period.count() <= 0)
+      return 0.0;
+
+   return static_cast< double>( number) * 1'000'000'000.0
+          / static_cast< double>( period.count());
+} // avgPerSecond
+
+
+/// Helper function to calculate the units per second.
+///
+/// @tparam  C  The clock used by the timer.
+/// @param[in]  number  Number of units handled in the measured time.
+/// @param[in]  nt      The timer used to stop the time.
+/// @return  The average number of units per second.
+/// @since  1.47.0, 18.10.2026
+template< typename C> double avgPerSecond( int64_t number,
+                                           const NanoTimer< C>& nt)
+{
+   return avgPerSecond( number, nt.timed());
+} // avgPerSecond
+
+
+// inlined methods
+// ===============
+
+
+template< typename C> void NanoTimer< C>::start() noexcept
+{
+   mStarted = true;
+   mStopped = false;
+   mStart = C::now();
+} // NanoTimer< C>::start
+
+
+template< typename C> void NanoTimer< C>::stop() noexcept
+{
+   mEnd = C::now();
+   mStarted = false;
+   mStopped = true;
+} // NanoTimer< C>::stop
+
+
+template< typename C>
+   std::chrono::nanoseconds NanoTimer< C>::timed() const noexcept
+{
+   return std::chrono::duration_cast< std::chrono::nanoseconds>( mEnd - mStart);
+} // NanoTimer< C>::timed
+
+
+template< typename C>
+   std::chrono::nanoseconds NanoTimer< C>::elapsed() const noexcept
+{
+   return std::chrono::duration_cast< std::chrono::nanoseconds>( C::now()
+                                                                 - mStart);
+} // NanoTimer< C>::elapsed
+
+
+template< typename C> bool NanoTimer< C>::started() const noexcept
+{
+   return mStarted;
+} // NanoTimer< C>::started
+
+
+template< typename C> bool NanoTimer< C>::stopped() const noexcept
+{
+   return mStopped;
+} // NanoTimer< C>::stopped
+
+
+inline void TimerStatistics::add( std::chrono::nanoseconds period) noexcept
+{
+
+   const int64_t  nanos = period.count();
+
+
+   ++mCount;
+   mSum += nanos;
+   mMin = std::min( mMin, nanos);
+   mMax = std::max( mMax, nanos);
+
+   const double  delta = static_cast< double>( nanos) - mMean;
+   mMean += delta / static_cast< double>( mCount);
+   mM2 += delta * (static_cast< double>( nanos) - mMean);
+
+} // TimerStatistics::add
+
+
+inline void TimerStatistics::reset() noexcept
+{
+   *this = TimerStatistics();
+} // TimerStatistics::reset
+
+
+inline uint64_t TimerStatistics::count() const noexcept
+{
+   return mCount;
+} // TimerStatistics::count
+
+
+inline std::chrono::nanoseconds TimerStatistics::sum() const noexcept
+{
+   return std::chrono::nanoseconds( mSum);
+} // TimerStatistics::sum
+
+
+inline std::chrono::nanoseconds TimerStatistics::min() const noexcept
+{
+   return std::chrono::nanoseconds( (mCount == 0) ? 0 : mMin);
+} // TimerStatistics::min
+
+
+inline std::chrono::nanoseconds TimerStatistics::max() const noexcept
+{
+   return std::chrono::nanoseconds( mMax);
+} // TimerStatistics::max
+
+
+inline double TimerStatistics::mean() const noexcept
+{
+   return mMean;
+} // TimerStatistics::mean
+
+
+inline double TimerStatistics::stddev() const noexcept
+{
+   return (mCount < 2) ? 0.0
+                       : std::sqrt( mM2 / static_cast< double>( mCount - 1));
+} // TimerStatistics::stddev
+
+
+template< typename C>
+   ScopeTimer< C>::ScopeTimer( TimerStatistics& stats) noexcept:
+      mStats( stats),
+      mStart( C::now())
+{
+} // ScopeTimer< C>::ScopeTimer
+
+
+template< typename C> ScopeTimer< C>::~ScopeTimer()
+{
+   mStats.add( std::chrono::duration_cast< std::chrono::nanoseconds>(
+      C::now() - mStart));
+} // ScopeTimer< C>::~ScopeTimer
+
+
+} // namespace celma::common
+
+
+// =====  END OF nano_timer.hpp  =====
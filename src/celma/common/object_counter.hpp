@@ -3,7 +3,7 @@
 **
 **    ####   ######  #       #    #   ####
 **   #    #  #       #       ##  ##  #    #
-**   #       ###     #       # ## #  ######    (C) 2016-2018 Rene Eng
+**   #       ###     #       # ## #  ######    (C) 2016-2026 Rene Eng
 **   #    #  #       #       #    #  #    #        LGPL
 **    ####   ######  ######  #    #  #    #
 **
@@ -12,29 +12,457 @@
 
 
 /// @file
-/// See documentation of template celma::common::ObjectCounter.
+/// See documentation of template celma::common::ObjectCounter, the counting
+/// policies and class celma::common::ObjectCounterRegistry.
 
 
 #ifndef CELMA_COMMON_OBJECT_COUNTER_HPP
 #define CELMA_COMMON_OBJECT_COUNTER_HPP
 
 
+#include <cxxabi.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include "celma/common/detail/thread_index.hpp"
+#include "celma/common/detail/type_name.hpp"
 
 
 namespace celma { namespace common {
 
 
+// Counting policies
+// =================
+
+
+/// Counting policy without synchronisation. Cheapest, but may only be used
+/// when all objects are created and destroyed by the same thread.
+///
+/// @tparam  C  The type to use for the counter.
+/// @since  1.47.0, 18.10.2026
+template< typename C> class PlainCountPolicy
+{
+public:
+   /// Called when an object is created.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void increment() noexcept
+   {
+      if (++mCount > mPeak)
+         mPeak = mCount;
+   } // PlainCountPolicy::increment
+
+   /// Called when an object is destroyed.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void decrement() noexcept
+   {
+      --mCount;
+   } // PlainCountPolicy::decrement
+
+   /// Returns the current number of objects.
+   ///
+   /// @return  The number of objects.
+   /// @since  1.47.0, 18.10.2026
+   C count() const noexcept
+   {
+      return mCount;
+   } // PlainCountPolicy::count
+
+   /// Returns the highest number of objects that existed at the same time.
+   ///
+   /// @return  The peak number of objects.
+   /// @since  1.47.0, 18.10.2026
+   C peak() const noexcept
+   {
+      return mPeak;
+   } // PlainCountPolicy::peak
+
+   /// Sets the peak to the current number of objects.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void resetPeak() noexcept
+   {
+      mPeak = mCount;
+   } // PlainCountPolicy::resetPeak
+
+private:
+   /// Current number of objects.
+   C  mCount = 0;
+   /// Highest number of objects.
+   C  mPeak = 0;
+
+}; // PlainCountPolicy< C>
+
+
+/// Counting policy with one atomic counter. Exact, also the peak, but all
+/// threads update the same cache line.
+///
+/// @tparam  C  The type to use for the counter.
+/// @since  1.47.0, 18.10.2026
+template< typename C> class AtomicCountPolicy
+{
+public:
+   /// Called when an object is created, updates the peak if necessary.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void increment() noexcept
+   {
+      const C  now = mCount.fetch_add( 1, std::memory_order_relaxed) + 1;
+      C        peak = mPeak.load( std::memory_order_relaxed);
+
+      while ((now > peak)
+             && !mPeak.compare_exchange_weak( peak, now,
+                                              std::memory_order_relaxed))
+         ;
+   } // AtomicCountPolicy::increment
+
+   /// Called when an object is destroyed.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void decrement() noexcept
+   {
+      mCount.fetch_sub( 1, std::memory_order_relaxed);
+   } // AtomicCountPolicy::decrement
+
+   /// Returns the current number of objects.
+   ///
+   /// @return  The number of objects.
+   /// @since  1.47.0, 18.10.2026
+   C count() const noexcept
+   {
+      return mCount.load( std::memory_order_relaxed);
+   } // AtomicCountPolicy::count
+
+   /// Returns the highest number of objects that existed at the same time.
+   ///
+   /// @return  The peak number of objects.
+   /// @since  1.47.0, 18.10.2026
+   C peak() const noexcept
+   {
+      return mPeak.load( std::memory_order_relaxed);
+   } // AtomicCountPolicy::peak
+
+   /// Sets the peak to the current number of objects.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void resetPeak() noexcept
+   {
+      mPeak.store( count(), std::memory_order_relaxed);
+   } // AtomicCountPolicy::resetPeak
+
+private:
+   /// Current number of objects.
+   std::atomic< C>  mCount{ 0};
+   /// Highest number of objects.
+   std::atomic< C>  mPeak{ 0};
+
+}; // AtomicCountPolicy< C>
+
+
+/// Counting policy with per-thread shards: Each thread updates the counter
+/// in its own cache line, so creating and destroying objects does not cause
+/// contention. Reading the count has to sum up all shards.<br>
+/// Since no thread knows the total on creation of an object, the peak is the
+/// highest number of objects observed when the count was read, i.e. it may
+/// be lower than the real peak.
+///
+/// @tparam  C  The type to use for the counter.
+/// @tparam  N  The number of shards.
+/// @since  1.47.0, 18.10.2026
+template< typename C, size_t N = 16> class ShardedCountPolicy
+{
+public:
+   /// Called when an object is created.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void increment() noexcept
+   {
+      myShard().fetch_add( 1, std::memory_order_relaxed);
+   } // ShardedCountPolicy::increment
+
+   /// Called when an object is destroyed. The object may have been created
+   /// by another thread, so a shard may become negative.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void decrement() noexcept
+   {
+      myShard().fetch_sub( 1, std::memory_order_relaxed);
+   } // ShardedCountPolicy::decrement
+
+   /// Returns the current number of objects, the sum of all shards. Also
+   /// updates the peak.
+   ///
+   /// @return  The number of objects.
+   /// @since  1.47.0, 18.10.2026
+   C count() const noexcept
+   {
+      int64_t  sum = 0;
+
+      for (const auto& shard : mShards)
+         sum += shard.mCount.load( std::memory_order_relaxed);
+
+      const C  now = static_cast< C>( std::max< int64_t>( sum, 0));
+      C        peak = mPeak.load( std::memory_order_relaxed);
+
+      while ((now > peak)
+             && !mPeak.compare_exchange_weak( peak, now,
+                                              std::memory_order_relaxed))
+         ;
+
+      return now;
+   } // ShardedCountPolicy::count
+
+   /// Returns the highest number of objects observed when the count was read.
+   ///
+   /// @return  The (observed) peak number of objects.
+   /// @since  1.47.0, 18.10.2026
+   C peak() const noexcept
+   {
+      count();
+      return mPeak.load( std::memory_order_relaxed);
+   } // ShardedCountPolicy::peak
+
+   /// Sets the peak to the current number of objects.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void resetPeak() noexcept
+   {
+      mPeak.store( 0, std::memory_order_relaxed);
+      count();
+   } // ShardedCountPolicy::resetPeak
+
+private:
+   /// The counter of one or more threads, in its own cache line.
+   struct alignas( 64) Shard
+   {
+      /// Created minus destroyed objects of the threads using this shard.
+      std::atomic< int64_t>  mCount{ 0};
+   };
+
+   /// Returns the counter to use by the calling thread.
+   ///
+   /// @return  The counter of the calling thread.
+   /// @since  1.47.0, 18.10.2026
+   std::atomic< int64_t>& myShard() noexcept
+   {
+      return mShards[ detail::threadIndex() % N].mCount;
+   } // ShardedCountPolicy::myShard
+
+   /// The shards.
+   std::array< Shard, N>    mShards;
+   /// Highest number of objects observed.
+   mutable std::atomic< C>  mPeak{ 0};
+
+}; // ShardedCountPolicy< C, N>
+
+
+// Class ObjectCounterRegistry
+// ===========================
+
+
+/// The counts of one counted type, as returned by ObjectCounterRegistry.
+///
+/// @since  1.47.0, 18.10.2026
+struct ObjectCountInfo
+{
+   /// The name of the type.
+   std::string  mTypeName;
+   /// Size of one object.
+   size_t       mObjectSize;
+   /// Current number of objects.
+   uint64_t     mNumObjects;
+   /// Highest number of objects.
+   uint64_t     mPeakObjects;
+
+   /// Returns the memory used by the current objects, the number of objects
+   /// times the object size. Memory allocated by the objects is not included.
+   ///
+   /// @return  The number of bytes used by the objects.
+   /// @since  1.47.0, 18.10.2026
+   uint64_t numBytes() const noexcept
+   {
+      return mNumObjects * mObjectSize;
+   } // ObjectCountInfo::numBytes
+
+   /// Returns the memory used by the objects at the peak.
+   ///
+   /// @return  The number of bytes used by the objects at the peak.
+   /// @since  1.47.0, 18.10.2026
+   uint64_t peakBytes() const noexcept
+   {
+      return mPeakObjects * mObjectSize;
+   } // ObjectCountInfo::peakBytes
+
+}; // ObjectCountInfo
+
+
+/// Registry of all types counted with ObjectCounter. A type is registered
+/// when the first object of the type is created.<br>
+/// Used to print the live and peak numbers of objects of all counted types,
+/// e.g. to find the cause of a growing memory usage in a long-running
+/// process.
+///
+/// @since  1.47.0, 18.10.2026
+class ObjectCounterRegistry
+{
+public:
+   /// Type of the functions that return the number of objects of a type.
+   using count_fn_t = uint64_t (*)();
+
+   /// Returns the registry.
+   ///
+   /// @return  The one and only registry object.
+   /// @since  1.47.0, 18.10.2026
+   static ObjectCounterRegistry& instance()
+   {
+      // never destroyed, objects may still be created during the shutdown
+      static auto  registry = new ObjectCounterRegistry();
+      return *registry;
+   } // ObjectCounterRegistry::instance
+
+   /// Adds a counted type.
+   ///
+   /// @param[in]  type_name    The name of the type from celma::type<>, or
+   ///                          "unknown".
+   /// @param[in]  ti           The type info of the type, used to get the
+   ///                          name if \a type_name is "unknown".
+   /// @param[in]  object_size  The size of an object of the type.
+   /// @param[in]  num_objects  Function that returns the current number of
+   ///                          objects.
+   /// @param[in]  peak         Function that returns the peak number of
+   ///                          objects.
+   /// @since  1.47.0, 18.10.2026
+   void add( const char* type_name, const std::type_info& ti,
+             size_t object_size, count_fn_t num_objects, count_fn_t peak)
+   {
+      std::string  name( type_name);
+
+      if (name == "unknown")
+      {
+         int    status = 0;
+         char*  demangled = abi::__cxa_demangle( ti.name(), nullptr, nullptr,
+                                                 &status);
+         name = (status == 0) ? demangled : ti.name();
+         std::free( demangled);
+      } // end if
+
+      const std::lock_guard< std::mutex>  guard( mMutex);
+      mEntries.push_back( Entry{ std::move( name), object_size, num_objects,
+                                 peak });
+   } // ObjectCounterRegistry::add
+
+   /// Returns the current counts of all registered types, sorted by name.
+   ///
+   /// @return  The counts of the registered types.
+   /// @since  1.47.0, 18.10.2026
+   std::vector< ObjectCountInfo> counts() const
+   {
+      std::vector< ObjectCountInfo>  result;
+
+      {
+         const std::lock_guard< std::mutex>  guard( mMutex);
+         result.reserve( mEntries.size());
+         for (const auto& entry : mEntries)
+            result.push_back( ObjectCountInfo{ entry.mTypeName,
+                                               entry.mObjectSize,
+                                               entry.mNumObjects(),
+                                               entry.mPeak() });
+      } // end scope
+
+      std::sort( result.begin(), result.end(),
+                 []( const ObjectCountInfo& lhs, const ObjectCountInfo& rhs)
+                 {
+                    return lhs.mTypeName < rhs.mTypeName;
+                 });
+
+      return result;
+   } // ObjectCounterRegistry::counts
+
+   /// Prints the counts of all registered types as table: Type name, current
+   /// and peak number of objects and the memory used by them.
+   ///
+   /// @param[in]  os  The stream to print into.
+   /// @since  1.47.0, 18.10.2026
+   void print( std::ostream& os) const
+   {
+      const auto  old_flags = os.flags();
+
+      os << std::left << std::setw( 40) << "Type" << std::right
+         << std::setw( 14) << "Objects" << std::setw( 14) << "Peak"
+         << std::setw( 16) << "Bytes" << std::setw( 16) << "Peak bytes"
+         << '\n' << std::string( 100, '-') << '\n';
+
+      for (const auto& info : counts())
+      {
+         os << std::left << std::setw( 40) << info.mTypeName << std::right
+            << std::setw( 14) << info.mNumObjects
+            << std::setw( 14) << info.mPeakObjects
+            << std::setw( 16) << info.numBytes()
+            << std::setw( 16) << info.peakBytes() << '\n';
+      } // end for
+
+      os.flags( old_flags);
+   } // ObjectCounterRegistry::print
+
+private:
+   /// Data of a registered type.
+   struct Entry
+   {
+      /// The name of the type.
+      std::string  mTypeName;
+      /// Size of one object.
+      size_t       mObjectSize;
+      /// Returns the current number of objects.
+      count_fn_t   mNumObjects;
+      /// Returns the peak number of objects.
+      count_fn_t   mPeak;
+   };
+
+   ObjectCounterRegistry() = default;
+
+   /// Protects the list of entries.
+   mutable std::mutex    mMutex;
+   /// The registered types.
+   std::vector< Entry>   mEntries;
+
+}; // ObjectCounterRegistry
+
+
+// Template ObjectCounter
+// ======================
+
+
 /// Helper class to count the current number of objects of a class.<br>
 /// Use this template with the CRTP:
 ///   class Counter: public ObjectCounter< Counter>
 /// This (the CRTP) is necessary to make sure that multiple counted classes
-/// in the same application are counted separately.
+/// in the same application are counted separately.<br>
+/// Besides the current number of objects, the highest number of objects
+/// (peak) is counted too. The memory used by the objects is computed from
+/// the numbers of objects and the size of the class.<br>
+/// When the first object of a class is created, the class is added to the
+/// ObjectCounterRegistry.
 ///
 /// @tparam  T  The class to count the objects of.
 /// @tparam  C  The type to use for the counter.
+/// @tparam  P  The counting policy: AtomicCountPolicy (default),
+///             ShardedCountPolicy for classes whose objects are created very
+///             often by multiple threads, or PlainCountPolicy if only one
+///             thread creates and destroys objects.
+/// @since  1.47.0, 18.10.2026
+///    (counting policies, peak, bytes and registry)
 /// @since  0.2, 10.04.2016
-template< typename T, typename C = uint64_t> class ObjectCounter
+template< typename T, typename C = uint64_t, typename P = AtomicCountPolicy< C>>
+   class ObjectCounter
 {
 public:
    /// Returns the current number of objects of this class.
@@ -43,52 +471,106 @@ public:
    /// @since  0.2, 10.04.2016
    static C numObjects()
    {
-      return mNumObjects;
-   } // ObjectCounter< T, C>::numObjects
+      return mCounter.count();
+   } // ObjectCounter< T, C, P>::numObjects
+
+   /// Returns the highest number of objects of this class that existed at
+   /// the same time.
+   ///
+   /// @return  Peak number of objects of the super class.
+   /// @since  1.47.0, 18.10.2026
+   static C peakObjects()
+   {
+      return mCounter.peak();
+   } // ObjectCounter< T, C, P>::peakObjects
+
+   /// Sets the peak to the current number of objects.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   static void resetPeak()
+   {
+      mCounter.resetPeak();
+   } // ObjectCounter< T, C, P>::resetPeak
+
+   /// Returns the memory used by the current objects of this class, i.e.
+   /// the number of objects times the size of the class.
+   ///
+   /// @return  Number of bytes used by the objects.
+   /// @since  1.47.0, 18.10.2026
+   static uint64_t numBytes()
+   {
+      return static_cast< uint64_t>( numObjects()) * sizeof( T);
+   } // ObjectCounter< T, C, P>::numBytes
+
+   /// Returns the memory used by the objects of this class at the peak.
+   ///
+   /// @return  Number of bytes used by the objects at the peak.
+   /// @since  1.47.0, 18.10.2026
+   static uint64_t peakBytes()
+   {
+      return static_cast< uint64_t>( peakObjects()) * sizeof( T);
+   } // ObjectCounter< T, C, P>::peakBytes
 
 protected:
    /// Constructor, increments the object counter.<br>
    /// Protected to make sure that no stand-alone objects of this class can be
    /// created.
    ///
+   /// @since  1.47.0, 18.10.2026
+   ///    (registers the class on the first call)
    /// @since  0.2, 10.04.2016
    ObjectCounter()
    {
-      ++mNumObjects;
-   } // end ObjectCounter< T, C>::ObjectCounter
+      static const bool  registered = registerType();
+      (void) registered;
+      mCounter.increment();
+   } // end ObjectCounter< T, C, P>::ObjectCounter
 
    /// Copy constructor, also increments the object counter.
    ///
    /// @since  0.2, 10.04.2016
    ObjectCounter( const ObjectCounter& /* other */)
    {
-      ++mNumObjects;
-   } // ObjectCounter< T, C>::ObjectCounter
+      mCounter.increment();
+   } // ObjectCounter< T, C, P>::ObjectCounter
 
    /// Move constructor, also increments the object counter.
    ///
    /// @since  1.11.0, 22.08.2018
    ObjectCounter( ObjectCounter&& /* other */)
    {
-      ++mNumObjects;
-   } // ObjectCounter< T, C>::ObjectCounter
+      mCounter.increment();
+   } // ObjectCounter< T, C, P>::ObjectCounter
 
    /// Destructor, decrements the object counter.
    ///
    /// @since  0.2, 10.04.2016
    ~ObjectCounter()
    {
-      --mNumObjects;
-   } // ObjectCounter< T, C>::~ObjectCounter
+      mCounter.decrement();
+   } // ObjectCounter< T, C, P>::~ObjectCounter
 
 private:
-   /// Current number of object of the super class.
-   static C  mNumObjects;
+   /// Adds the class to the registry.
+   ///
+   /// @return  Always \c true.
+   /// @since  1.47.0, 18.10.2026
+   static bool registerType()
+   {
+      ObjectCounterRegistry::instance().add( type< T>::name(), typeid( T),
+         sizeof( T),
+         []() -> uint64_t { return static_cast< uint64_t>( numObjects()); },
+         []() -> uint64_t { return static_cast< uint64_t>( peakObjects()); });
+      return true;
+   } // ObjectCounter< T, C, P>::registerType
 
-}; // ObjectCounter< T, C>
+   /// The counter(s) of the objects of the super class.
+   static P  mCounter;
 
+}; // ObjectCounter< T, C, P>
 
-template< typename T, typename C> C ObjectCounter< T, C>::mNumObjects = 0;
+
+template< typename T, typename C, typename P> P ObjectCounter< T, C, P>::mCounter;
 
 
 } // namespace common
@@ -99,4 +581,3 @@ template< typename T, typename C> C ObjectCounter< T, C>::mNumObjects = 0;
 
 
 // =====  END OF object_counter.hpp  =====
-
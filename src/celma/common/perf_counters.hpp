@@ -0,0 +1,239 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of classes celma::common::PerfCounters,
+/// celma::common::PerfCounterValues and celma::common::PerfScope.
+
+
+#pragma once
+
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+
+
+namespace celma::common {
+
+
+/// The events that are counted by PerfCounters.
+///
+/// @since  1.47.0, 18.10.2026
+enum class PerfEvent
+{
+   cycles,            //!< CPU cycles.
+   instructions,      //!< Instructions retired.
+   cacheReferences,   //!< Last level cache accesses.
+   cacheMisses,       //!< Last level cache misses.
+   branchMisses,      //!< Mispredicted branches.
+   contextSwitches    //!< Context switches of the thread.
+};
+
+
+/// Values of the performance counters, either absolute or the difference
+/// between two readings.
+///
+/// @since  1.47.0, 18.10.2026
+class PerfCounterValues
+{
+public:
+   /// Number of events.
+   static constexpr size_t  NumEvents = 6;
+
+   PerfCounterValues() = default;
+
+   /// Returns if the value of an event is available.
+   ///
+   /// @param[in]  event  The event to check.
+   /// @return  \c true if the event could be counted.
+   /// @since  1.47.0, 18.10.2026
+   bool available( PerfEvent event) const noexcept
+   {
+      return mAvailable[ static_cast< size_t>( event)];
+   } // PerfCounterValues::available
+
+   /// Returns the value of an event.
+   ///
+   /// @param[in]  event  The event to return the value of.
+   /// @return  The counter value, 0 if the event is not available.
+   /// @since  1.47.0, 18.10.2026
+   uint64_t value( PerfEvent event) const noexcept
+   {
+      return mValues[ static_cast< size_t>( event)];
+   } // PerfCounterValues::value
+
+   /// Returns the time, measured with \c steady_clock.
+   ///
+   /// @return  The time (difference).
+   /// @since  1.47.0, 18.10.2026
+   std::chrono::nanoseconds time() const noexcept
+   {
+      return mTime;
+   } // PerfCounterValues::time
+
+   /// Returns the instructions per cycle.
+   ///
+   /// @return  The IPC, a negative value if not available.
+   /// @since  1.47.0, 18.10.2026
+   double ipc() const noexcept;
+
+   /// Returns the percentage of last level cache accesses that missed.
+   ///
+   /// @return  The cache miss rate in percent, a negative value if not
+   ///          available.
+   /// @since  1.47.0, 18.10.2026
+   double cacheMissRate() const noexcept;
+
+   /// Returns the difference between two readings.
+   ///
+   /// @param[in]  earlier  The earlier reading.
+   /// @return  The counter differences, an event is available only when it is
+   ///          available in both readings.
+   /// @since  1.47.0, 18.10.2026
+   PerfCounterValues operator -( const PerfCounterValues& earlier) const noexcept;
+
+   /// Prints the time and the available counters, IPC and cache miss rate in
+   /// one line.
+   ///
+   /// @param[in]  os      The stream to write into.
+   /// @param[in]  values  The values to print.
+   /// @return  The stream as passed in.
+   /// @since  1.47.0, 18.10.2026
+   friend std::ostream& operator <<( std::ostream& os,
+                                     const PerfCounterValues& values);
+
+private:
+   friend class PerfCounters;
+
+   /// The counter values.
+   std::array< uint64_t, NumEvents>  mValues{};
+   /// Flags, set for the events that are available.
+   std::array< bool, NumEvents>      mAvailable{};
+   /// The time.
+   std::chrono::nanoseconds          mTime{ 0};
+
+}; // PerfCounterValues
+
+
+/// Opens hardware and software performance counters for the calling thread
+/// using \c perf_event_open().<br>
+/// Counters that cannot be opened, because the kernel or the hardware does
+/// not support them or \c /proc/sys/kernel/perf_event_paranoid forbids the
+/// access, are reported as not available. The time is always measured, so in
+/// the worst case the object degrades to a timer.<br>
+/// Only user space is counted for the hardware events. The counters are
+/// scaled if the kernel had to multiplex them.<br>
+/// The object must be used by the thread that created it.
+///
+/// @since  1.47.0, 18.10.2026
+class PerfCounters
+{
+public:
+   /// Constructor, opens and starts the counters.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   PerfCounters();
+
+   PerfCounters( const PerfCounters&) = delete;
+
+   /// Destructor, closes the counters.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   ~PerfCounters();
+
+   PerfCounters& operator =( const PerfCounters&) = delete;
+
+   /// Returns if at least one counter could be opened.
+   ///
+   /// @return  \c true if any counter is available.
+   /// @since  1.47.0, 18.10.2026
+   bool available() const noexcept;
+
+   /// Returns if the counter of an event could be opened.
+   ///
+   /// @param[in]  event  The event to check.
+   /// @return  \c true if the event is counted.
+   /// @since  1.47.0, 18.10.2026
+   bool available( PerfEvent event) const noexcept;
+
+   /// Reads the current values of all counters and the time.
+   ///
+   /// @return  The current values.
+   /// @since  1.47.0, 18.10.2026
+   PerfCounterValues read() const noexcept;
+
+private:
+   /// The file descriptors of the counters, -1 if not available.
+   std::array< int, PerfCounterValues::NumEvents>  mFds;
+
+}; // PerfCounters
+
+
+/// Reads the performance counters on construction and destruction, and
+/// stores the difference.<br>
+/// Usage:
+/// @code
+///   PerfCounters       counters;
+///   PerfCounterValues  result;
+///   {
+///      PerfScope  ps( counters, result);
+///      ...
+///   }
+///   std::cout << result << std::endl;
+/// @endcode
+///
+/// @since  1.47.0, 18.10.2026
+class PerfScope
+{
+public:
+   /// Constructor, reads the counters.
+   ///
+   /// @param[in]  counters  The counters to read.
+   /// @param[out] result    Set to the counter differences at the end of the
+   ///                       scope.
+   /// @since  1.47.0, 18.10.2026
+   PerfScope( const PerfCounters& counters, PerfCounterValues& result) noexcept:
+      mCounters( counters),
+      mResult( result),
+      mStart( counters.read())
+   {
+   } // PerfScope::PerfScope
+
+   PerfScope( const PerfScope&) = delete;
+   PerfScope& operator =( const PerfScope&) = delete;
+
+   /// Destructor, computes the counter differences.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   ~PerfScope()
+   {
+      mResult = mCounters.read() - mStart;
+   } // PerfScope::~PerfScope
+
+private:
+   /// The counters to read.
+   const PerfCounters&      mCounters;
+   /// Where to store the result.
+   PerfCounterValues&       mResult;
+   /// The values at the beginning of the scope.
+   const PerfCounterValues  mStart;
+
+}; // PerfScope
+
+
+} // namespace celma::common
+
+
+// =====  END OF perf_counters.hpp  =====
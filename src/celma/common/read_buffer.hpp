@@ -23,6 +23,8 @@
 #include <cstring>
 #include <memory>
 #include <stdexcept>
+#include <string_view>
+#include <vector>
 
 
 namespace celma::common {
@@ -190,7 +192,12 @@ private:
 /// So, to minimize the read operations, the buffer must be bigger than the
 /// expected data blocks.<br>
 /// The buffer must also be bigger than the maximum size of a data block that
-/// is expected.
+/// is expected for get().<br>
+/// Records can also be parsed in place, without copying: peek() returns a view
+/// on the buffered data, consume() removes the data from the buffer, and
+/// readUntil() returns the data up to a delimiter. If more data than the size
+/// of the internal buffer is needed by these functions, the data is collected
+/// in a growable overflow buffer.
 ///
 /// @tparam  N
 ///    The size of the internal buffer to use.
@@ -235,6 +242,46 @@ public:
    ///    1.20.0, 25.01.2019
    template< typename T> void get( T* data, size_t len) noexcept( false);
 
+   /// Returns a view on the next \a len bytes of data, without removing them
+   /// from the buffer. If the buffer does not hold enough data, readData() is
+   /// called until the requested data is available.<br>
+   /// If \a len is greater than the size of the internal buffer, the data is
+   /// collected in the overflow buffer.<br>
+   /// The view is valid until the next call of get(), peek() or readUntil().
+   ///
+   /// @param[in]  len  Length of the data in bytes to return.
+   /// @return  View on the requested data.
+   /// @since  1.47.0, 18.10.2026
+   std::string_view peek( size_t len) noexcept( false);
+
+   /// Removes data from the buffer, typically after it was examined with
+   /// peek().
+   ///
+   /// @param[in]  len
+   ///    Number of bytes to remove, must not be greater than the amount of
+   ///    data currently buffered.
+   /// @since  1.47.0, 18.10.2026
+   void consume( size_t len) noexcept( false);
+
+   /// Returns the data up to the next occurrence of the delimiter, and
+   /// removes this data plus the delimiter from the buffer.<br>
+   /// readData() is called until the delimiter is found. If the record is
+   /// longer than the internal buffer, it is collected in the overflow
+   /// buffer.<br>
+   /// The view is valid until the next call of get(), peek() or readUntil().
+   ///
+   /// @param[in]  delim  The delimiter to search.
+   /// @return  View on the data before the delimiter.
+   /// @since  1.47.0, 18.10.2026
+   std::string_view readUntil( char delim) noexcept( false);
+
+   /// Returns the amount of data currently buffered, i.e. that can be
+   /// returned without calling readData().
+   ///
+   /// @return  Number of bytes currently buffered.
+   /// @since  1.47.0, 18.10.2026
+   size_t available() const noexcept;
+
 protected:
    /// Called when more data is needed.
    ///
@@ -256,6 +303,33 @@ private:
    /// @since  1.20.0, 25.01.2019
    void fillBuffer( size_t min_length = 0);
 
+   /// Returns a pointer to the available data, which must contain at least
+   /// \a len bytes. Reads more data and switches to the overflow buffer if
+   /// needed.
+   ///
+   /// @param[in]  len  Minimum amount of data needed.
+   /// @return  Pointer to the beginning of the available data.
+   /// @since  1.47.0, 18.10.2026
+   const unsigned char* ensure( size_t len);
+
+   /// Reads one more block of data from the source and appends it to the
+   /// overflow buffer.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void growOverflow();
+
+   /// If the data remaining in the overflow buffer fits into the internal
+   /// buffer, moves it back there.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void leaveOverflow();
+
+   /// Returns if the data is currently stored in the overflow buffer.
+   ///
+   /// @return  \c true if the overflow buffer is in use.
+   /// @since  1.47.0, 18.10.2026
+   bool inOverflow() const noexcept;
+
    /// The internal buffer.
    std::unique_ptr< unsigned char[]>  mpBuffer;
    /// Position in the data buffer where the available data starts.
@@ -263,6 +337,11 @@ private:
    /// Position to read the next data block into, i.e. 1 position after the
    /// last data byte.
    size_t                             mDataEnd = 0;
+   /// Holds the data when more than \a N bytes are needed. While it is used,
+   /// the internal buffer is empty.
+   std::vector< unsigned char>        mOverflow;
+   /// Position in the overflow buffer where the available data starts.
+   size_t                             mOverflowStart = 0;
 
 }; // ReadBuffer< N, P>
 
@@ -287,23 +366,68 @@ template< size_t N, typename P>
    if (len > N)
       throw std::runtime_error( "length requested from get() exceeds buffer length");
 
-   // invariant
-   assert( mDataStart <= mDataEnd);
+   leaveOverflow();
+   // only returns when the buffer holds enough data
+   ::memcpy( data, ensure( len), len);
+   consume( len);
+} // ReadBuffer< N, P>::get
 
-   // check if we already have enough data in the buffer
-   if (len <= (mDataEnd - mDataStart))
-   {
-      ::memcpy( data, &mpBuffer[ mDataStart], len);
+
+template< size_t N, typename P>
+   std::string_view ReadBuffer< N, P>::peek( size_t len)
+{
+   leaveOverflow();
+   return std::string_view( reinterpret_cast< const char*>( ensure( len)), len);
+} // ReadBuffer< N, P>::peek
+
+
+template< size_t N, typename P> void ReadBuffer< N, P>::consume( size_t len)
+{
+   if (len > available())
+      throw std::runtime_error( "length to consume exceeds buffered data");
+
+   if (inOverflow())
+      mOverflowStart += len;
+   else
       mDataStart += len;
-      P::bufferRead( len);
-      return;
-   } // end if
-   fillBuffer( len);
-   // only returns when the buffer holds enough data
-   ::memcpy( data, &mpBuffer[ mDataStart], len);
-   mDataStart += len;
    P::bufferRead( len);
-} // ReadBuffer< N, P>::get
+} // ReadBuffer< N, P>::consume
+
+
+template< size_t N, typename P>
+   std::string_view ReadBuffer< N, P>::readUntil( char delim)
+{
+   leaveOverflow();
+
+   // number of bytes already searched, no need to search them again
+   size_t  searched = 0;
+
+   for (;;)
+   {
+      const size_t  avail = available();
+      auto          data = ensure( avail);
+      // memchr() of the C library already uses SIMD instructions
+      auto          found = static_cast< const unsigned char*>(
+         ::memchr( data + searched, delim, avail - searched));
+
+      if (found != nullptr)
+      {
+         const size_t  len = found - data;
+         consume( len + 1);
+         return std::string_view( reinterpret_cast< const char*>( data), len);
+      } // end if
+
+      searched = avail;
+      ensure( avail + 1);
+   } // end for
+} // ReadBuffer< N, P>::readUntil
+
+
+template< size_t N, typename P> size_t ReadBuffer< N, P>::available() const noexcept
+{
+   return inOverflow() ? mOverflow.size() - mOverflowStart
+                       : mDataEnd - mDataStart;
+} // ReadBuffer< N, P>::available
 
 
 template< size_t N, typename P> void ReadBuffer< N, P>::fillBuffer( size_t min_length)
@@ -331,6 +455,77 @@ template< size_t N, typename P> void ReadBuffer< N, P>::fillBuffer( size_t min_l
 } // ReadBuffer< N, P>::fillBuffer
 
 
+template< size_t N, typename P>
+   const unsigned char* ReadBuffer< N, P>::ensure( size_t len)
+{
+   if (inOverflow())
+   {
+      while (mOverflow.size() - mOverflowStart < len)
+         growOverflow();
+      return mOverflow.data() + mOverflowStart;
+   } // end if
+
+   if (len <= mDataEnd - mDataStart)
+      return &mpBuffer[ mDataStart];
+
+   if (len <= N)
+   {
+      fillBuffer( len);
+      return &mpBuffer[ mDataStart];
+   } // end if
+
+   // more data needed than fits into the buffer: continue in the overflow
+   // buffer
+   mOverflow.assign( &mpBuffer[ mDataStart], &mpBuffer[ mDataEnd]);
+   mOverflowStart = 0;
+   mDataStart = mDataEnd = 0;
+
+   while (mOverflow.size() < len)
+      growOverflow();
+
+   return mOverflow.data();
+} // ReadBuffer< N, P>::ensure
+
+
+template< size_t N, typename P> void ReadBuffer< N, P>::growOverflow()
+{
+   // the internal buffer is empty while the overflow buffer is used
+   const size_t  data_read = readData( mpBuffer.get(), N);
+
+   P::sourceRead( data_read);
+   mOverflow.insert( mOverflow.end(), mpBuffer.get(), mpBuffer.get() + data_read);
+} // ReadBuffer< N, P>::growOverflow
+
+
+template< size_t N, typename P> void ReadBuffer< N, P>::leaveOverflow()
+{
+   if (mOverflow.empty())
+      return;
+
+   const size_t  remaining = mOverflow.size() - mOverflowStart;
+
+   if (remaining <= N)
+   {
+      ::memcpy( mpBuffer.get(), &mOverflow[ mOverflowStart], remaining);
+      mDataStart = 0;
+      mDataEnd   = remaining;
+      mOverflow.clear();
+      mOverflowStart = 0;
+   } else if (mOverflowStart > 0)
+   {
+      // same compaction as in fillBuffer()
+      mOverflow.erase( mOverflow.begin(), mOverflow.begin() + mOverflowStart);
+      mOverflowStart = 0;
+   } // end if
+} // ReadBuffer< N, P>::leaveOverflow
+
+
+template< size_t N, typename P> bool ReadBuffer< N, P>::inOverflow() const noexcept
+{
+   return !mOverflow.empty();
+} // ReadBuffer< N, P>::inOverflow
+
+
 } // namespace celma::common
 
 
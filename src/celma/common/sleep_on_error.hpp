@@ -3,7 +3,7 @@
 **
 **    ####   ######  #       #    #   ####
 **   #    #  #       #       ##  ##  #    #
-**   #       ###     #       # ## #  ######    (C) 2017 Rene Eng
+**   #       ###     #       # ## #  ######    (C) 2017-2026 Rene Eng
 **   #    #  #       #       #    #  #    #        LGPL
 **    ####   ######  ######  #    #  #    #
 **
@@ -12,7 +12,7 @@
 
 
 /// @file
-/// See documentation of class celma::common::@@@.
+/// See documentation of class celma::common::SleepOnError.
 
 
 #ifndef CELMA_COMMON_SLEEP_ON_ERROR_HPP
@@ -41,6 +41,8 @@ namespace celma { namespace common {
 /// does not exceed the specified maximum.<br>
 /// Every time that sleep() is called and no error occurred, the (next) sleep
 /// time is set to 0.
+/// To wait for data from a queue or a flag set by another thread, use
+/// AdaptiveWait instead, which is woken up immediately by the producer.
 /// @tparam  T  The type of the sleep time to manage.
 /// @since  0.13.4, 24.02.2017
 template< typename T = int> class SleepOnError
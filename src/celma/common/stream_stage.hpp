@@ -0,0 +1,650 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of the interfaces celma::common::IWriteStage and
+/// celma::common::IReadStage.<br>
+/// Also contains the statistics policies for stages, the stages to write into
+/// and read from a file descriptor, the CRC32C checksum stages, and the
+/// buffer classes that pass their data to/get their data from a stage.
+
+
+#pragma once
+
+
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include "celma/common/crc32c.hpp"
+#include "celma/common/read_buffer.hpp"
+#include "celma/common/write_buffer.hpp"
+
+
+namespace celma::common {
+
+
+// Class EmptyStagePolicy
+// ======================
+
+
+/// Default statistics policy for the stages: Does nothing.
+///
+/// @since  1.47.0, 18.10.2026
+class EmptyStagePolicy
+{
+public:
+   /// The stages do not need to measure the time spent.
+   static constexpr bool  MeasureTime = false;
+
+   /// Called when a stage processed data: Does nothing.
+   ///
+   /// @param  Ignored.
+   /// @param  Ignored.
+   /// @param  Ignored.
+   /// @since  1.47.0, 18.10.2026
+   void processed( size_t /* bytes_in */, size_t /* bytes_out */,
+                   std::chrono::nanoseconds /* duration */)
+   {
+   } // EmptyStagePolicy::processed
+
+   /// Always returns 0.
+   ///
+   /// @return  0.
+   /// @since  1.47.0, 18.10.2026
+   size_t numCalls() const
+   {
+      return 0;
+   } // EmptyStagePolicy::numCalls
+
+   /// Always returns 0.
+   ///
+   /// @return  0.
+   /// @since  1.47.0, 18.10.2026
+   size_t bytesIn() const
+   {
+      return 0;
+   } // EmptyStagePolicy::bytesIn
+
+   /// Always returns 0.
+   ///
+   /// @return  0.
+   /// @since  1.47.0, 18.10.2026
+   size_t bytesOut() const
+   {
+      return 0;
+   } // EmptyStagePolicy::bytesOut
+
+   /// Always returns 0.
+   ///
+   /// @return  0.
+   /// @since  1.47.0, 18.10.2026
+   std::chrono::nanoseconds timeSpent() const
+   {
+      return std::chrono::nanoseconds( 0);
+   } // EmptyStagePolicy::timeSpent
+
+}; // EmptyStagePolicy
+
+
+// Class StageCountPolicy
+// ======================
+
+
+/// Use this policy with the stages to get statistics about the amount of data
+/// that was passed into and out of the stage, and the time spent in the stage
+/// including the following stages.
+///
+/// @since  1.47.0, 18.10.2026
+class StageCountPolicy
+{
+public:
+   /// Tells the stages to measure the time spent.
+   static constexpr bool  MeasureTime = true;
+
+   /// Called when a stage processed data.
+   ///
+   /// @param[in]  bytes_in   Number of bytes passed into the stage.
+   /// @param[in]  bytes_out  Number of bytes that the stage passed on.
+   /// @param[in]  duration   Time spent processing the data.
+   /// @since  1.47.0, 18.10.2026
+   void processed( size_t bytes_in, size_t bytes_out,
+                   std::chrono::nanoseconds duration)
+   {
+      ++mNumCalls;
+      mBytesIn   += bytes_in;
+      mBytesOut  += bytes_out;
+      mTimeSpent += duration;
+   } // StageCountPolicy::processed
+
+   /// Returns how many times the stage was called.
+   ///
+   /// @return  Number of calls of the stage.
+   /// @since  1.47.0, 18.10.2026
+   size_t numCalls() const
+   {
+      return mNumCalls;
+   } // StageCountPolicy::numCalls
+
+   /// Returns the number of bytes that were passed into the stage.
+   ///
+   /// @return  Number of bytes passed into the stage.
+   /// @since  1.47.0, 18.10.2026
+   size_t bytesIn() const
+   {
+      return mBytesIn;
+   } // StageCountPolicy::bytesIn
+
+   /// Returns the number of bytes that the stage passed on.
+   ///
+   /// @return  Number of bytes passed on by the stage.
+   /// @since  1.47.0, 18.10.2026
+   size_t bytesOut() const
+   {
+      return mBytesOut;
+   } // StageCountPolicy::bytesOut
+
+   /// Returns the time spent in the stage.
+   ///
+   /// @return  The sum of the processing times.
+   /// @since  1.47.0, 18.10.2026
+   std::chrono::nanoseconds timeSpent() const
+   {
+      return mTimeSpent;
+   } // StageCountPolicy::timeSpent
+
+private:
+   /// Counts the number of calls.
+   size_t                    mNumCalls = 0;
+   /// Counts the number of bytes passed into the stage.
+   size_t                    mBytesIn = 0;
+   /// Counts the number of bytes passed on.
+   size_t                    mBytesOut = 0;
+   /// The total processing time.
+   std::chrono::nanoseconds  mTimeSpent{ 0};
+
+}; // StageCountPolicy
+
+
+namespace detail {
+
+
+/// Helper class to measure the time spent in a stage, if the policy requests
+/// it.
+///
+/// @tparam  P  The statistics policy of the stage.
+/// @since  1.47.0, 18.10.2026
+template< typename P> class StageTimer
+{
+public:
+   /// Constructor, stores the start time if needed.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   StageTimer()
+   {
+      if constexpr (P::MeasureTime)
+         mStart = std::chrono::steady_clock::now();
+   } // StageTimer::StageTimer
+
+   /// Returns the time since the object was created.
+   ///
+   /// @return  The elapsed time, 0 if the policy does not measure time.
+   /// @since  1.47.0, 18.10.2026
+   std::chrono::nanoseconds elapsed() const
+   {
+      if constexpr (P::MeasureTime)
+         return std::chrono::steady_clock::now() - mStart;
+      else
+         return std::chrono::nanoseconds( 0);
+   } // StageTimer::elapsed
+
+private:
+   /// The start time.
+   std::chrono::steady_clock::time_point  mStart;
+
+}; // StageTimer< P>
+
+
+} // namespace detail
+
+
+// Interface IWriteStage
+// =====================
+
+
+/// Interface for stages that process data on the way to the destination.<br>
+/// Each stage passes the processed data on to the next stage, the last stage
+/// writes the data to the destination. So, a compressed file with a checksum
+/// is written by the chain
+/// <pre>StageWriteBuffer -> Crc32cWriteStage -> ZlibCompressStage -> FdWriteStage</pre>
+///
+/// @since  1.47.0, 18.10.2026
+class IWriteStage
+{
+public:
+   /// Empty, virtual destructor.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   virtual ~IWriteStage() = default;
+
+   /// Processes the data and passes it on to the next stage.
+   ///
+   /// @param[in]  data  Pointer to the data to process.
+   /// @param[in]  len   The length of the data.
+   /// @since  1.47.0, 18.10.2026
+   virtual void write( const unsigned char* data, size_t len) = 0;
+
+   /// Called after the last data was written: Pass on the remaining data, if
+   /// any, then call finish() of the next stage.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   virtual void finish() = 0;
+
+}; // IWriteStage
+
+
+// Interface IReadStage
+// ====================
+
+
+/// Interface for stages that process data on the way from the source.<br>
+/// Each stage gets its data from the previous stage, the first stage reads
+/// the data from the source.
+///
+/// @since  1.47.0, 18.10.2026
+class IReadStage
+{
+public:
+   /// Empty, virtual destructor.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   virtual ~IReadStage() = default;
+
+   /// Returns the next processed data.
+   ///
+   /// @param[in]  data  Pointer to the buffer to store the data in.
+   /// @param[in]  len   Maximum length of the data to return.
+   /// @return  Number of bytes returned, 0 at the end of the data.
+   /// @since  1.47.0, 18.10.2026
+   virtual size_t read( unsigned char* data, size_t len) = 0;
+
+}; // IReadStage
+
+
+// Class FdWriteStage
+// ==================
+
+
+/// Last stage of a write chain: Writes the data into a file descriptor.<br>
+/// The file descriptor is not closed by this class.
+///
+/// @tparam  P  The statistics policy to use.
+/// @since  1.47.0, 18.10.2026
+template< typename P = EmptyStagePolicy>
+   class FdWriteStage: public IWriteStage, public P
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  fd  The file descriptor to write into.
+   /// @since  1.47.0, 18.10.2026
+   explicit FdWriteStage( int fd):
+      mFd( fd)
+   {
+   } // FdWriteStage::FdWriteStage
+
+   /// Writes all data into the file descriptor.
+   ///
+   /// @param[in]  data  Pointer to the data to write.
+   /// @param[in]  len   The length of the data.
+   /// @throw  std::runtime_error if writing failed.
+   /// @since  1.47.0, 18.10.2026
+   void write( const unsigned char* data, size_t len) override
+   {
+      const detail::StageTimer< P>  timer;
+      size_t                        written = 0;
+
+      while (written < len)
+      {
+         const auto  result = ::write( mFd, data + written, len - written);
+         if (result > 0)
+            written += result;
+         else if (result == 0)
+            throw std::runtime_error( "could not write data: no data written");
+         else if (errno != EINTR)
+            throw std::runtime_error( std::string( "could not write data: ")
+                                      + ::strerror( errno));
+      } // end while
+
+      P::processed( len, len, timer.elapsed());
+   } // FdWriteStage::write
+
+   /// Nothing to do here.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void finish() override
+   {
+   } // FdWriteStage::finish
+
+private:
+   /// The file descriptor to write into.
+   const int  mFd;
+
+}; // FdWriteStage< P>
+
+
+// Class FdReadStage
+// =================
+
+
+/// First stage of a read chain: Reads the data from a file descriptor.<br>
+/// The file descriptor is not closed by this class.
+///
+/// @tparam  P  The statistics policy to use.
+/// @since  1.47.0, 18.10.2026
+template< typename P = EmptyStagePolicy>
+   class FdReadStage: public IReadStage, public P
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  fd  The file descriptor to read from.
+   /// @since  1.47.0, 18.10.2026
+   explicit FdReadStage( int fd):
+      mFd( fd)
+   {
+   } // FdReadStage::FdReadStage
+
+   /// Reads data from the file descriptor.
+   ///
+   /// @param[in]  data  Pointer to the buffer to store the data in.
+   /// @param[in]  len   Maximum length of the data to return.
+   /// @return  Number of bytes read, 0 at the end of the file.
+   /// @throw  std::runtime_error if reading failed.
+   /// @since  1.47.0, 18.10.2026
+   size_t read( unsigned char* data, size_t len) override
+   {
+      const detail::StageTimer< P>  timer;
+
+      for (;;)
+      {
+         const auto  result = ::read( mFd, data, len);
+         if (result >= 0)
+         {
+            P::processed( result, result, timer.elapsed());
+            return result;
+         } // end if
+         if (errno != EINTR)
+            throw std::runtime_error( std::string( "could not read data: ")
+                                      + ::strerror( errno));
+      } // end for
+   } // FdReadStage::read
+
+private:
+   /// The file descriptor to read from.
+   const int  mFd;
+
+}; // FdReadStage< P>
+
+
+// Class Crc32cWriteStage
+// ======================
+
+
+/// Write stage that computes the CRC32C checksum of the data that passes
+/// through. The data itself is passed on unchanged, without copying.
+///
+/// @tparam  P  The statistics policy to use.
+/// @since  1.47.0, 18.10.2026
+template< typename P = EmptyStagePolicy>
+   class Crc32cWriteStage: public IWriteStage, public P
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  next  The next stage to pass the data to.
+   /// @since  1.47.0, 18.10.2026
+   explicit Crc32cWriteStage( IWriteStage& next):
+      mNext( next)
+   {
+   } // Crc32cWriteStage::Crc32cWriteStage
+
+   /// Updates the checksum and passes the data on.
+   ///
+   /// @param[in]  data  Pointer to the data.
+   /// @param[in]  len   The length of the data.
+   /// @since  1.47.0, 18.10.2026
+   void write( const unsigned char* data, size_t len) override
+   {
+      const detail::StageTimer< P>  timer;
+
+      mChecksum = crc32c( data, len, mChecksum);
+      mNext.write( data, len);
+      P::processed( len, len, timer.elapsed());
+   } // Crc32cWriteStage::write
+
+   /// Calls finish() of the next stage.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void finish() override
+   {
+      mNext.finish();
+   } // Crc32cWriteStage::finish
+
+   /// Returns the checksum of the data written so far.
+   ///
+   /// @return  The CRC32C checksum.
+   /// @since  1.47.0, 18.10.2026
+   uint32_t checksum() const noexcept
+   {
+      return mChecksum;
+   } // Crc32cWriteStage::checksum
+
+private:
+   /// The next stage.
+   IWriteStage&  mNext;
+   /// The checksum of the data so far.
+   uint32_t      mChecksum = 0;
+
+}; // Crc32cWriteStage< P>
+
+
+// Class Crc32cReadStage
+// =====================
+
+
+/// Read stage that computes the CRC32C checksum of the data that passes
+/// through, e.g. to verify the data against a stored checksum.
+///
+/// @tparam  P  The statistics policy to use.
+/// @since  1.47.0, 18.10.2026
+template< typename P = EmptyStagePolicy>
+   class Crc32cReadStage: public IReadStage, public P
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  source  The stage to get the data from.
+   /// @since  1.47.0, 18.10.2026
+   explicit Crc32cReadStage( IReadStage& source):
+      mSource( source)
+   {
+   } // Crc32cReadStage::Crc32cReadStage
+
+   /// Reads data from the previous stage and updates the checksum.
+   ///
+   /// @param[in]  data  Pointer to the buffer to store the data in.
+   /// @param[in]  len   Maximum length of the data to return.
+   /// @return  Number of bytes returned, 0 at the end of the data.
+   /// @since  1.47.0, 18.10.2026
+   size_t read( unsigned char* data, size_t len) override
+   {
+      const detail::StageTimer< P>  timer;
+      const size_t                  data_read = mSource.read( data, len);
+
+      mChecksum = crc32c( data, data_read, mChecksum);
+      P::processed( data_read, data_read, timer.elapsed());
+
+      return data_read;
+   } // Crc32cReadStage::read
+
+   /// Returns the checksum of the data read so far.
+   ///
+   /// @return  The CRC32C checksum.
+   /// @since  1.47.0, 18.10.2026
+   uint32_t checksum() const noexcept
+   {
+      return mChecksum;
+   } // Crc32cReadStage::checksum
+
+private:
+   /// The stage to get the data from.
+   IReadStage&  mSource;
+   /// The checksum of the data so far.
+   uint32_t     mChecksum = 0;
+
+}; // Crc32cReadStage< P>
+
+
+// Template Class StageWriteBuffer
+// ===============================
+
+
+/// WriteBuffer that passes the data to a chain of write stages.<br>
+/// Call finish() after the last data was appended, this writes the remaining
+/// data from the buffer and finishes the chain of stages. If this was not
+/// done, the destructor calls finish() and ignores errors.
+///
+/// @tparam  N  The size of the buffer to use.
+/// @tparam  P  The statistics policy of the buffer.
+/// @since  1.47.0, 18.10.2026
+template< size_t N, typename P = EmptyWritePolicy>
+   class StageWriteBuffer: public WriteBuffer< N, P>
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  next  The first stage to pass the data to.
+   /// @since  1.47.0, 18.10.2026
+   explicit StageWriteBuffer( IWriteStage& next):
+      WriteBuffer< N, P>(),
+      mNext( next)
+   {
+   } // StageWriteBuffer::StageWriteBuffer
+
+   /// Destructor, calls finish() if this was not done yet.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   ~StageWriteBuffer() override
+   {
+      try
+      {
+         finish();
+      } catch (...)
+      {
+      } // end try
+   } // StageWriteBuffer::~StageWriteBuffer
+
+   /// Writes the remaining data and finishes the chain of stages.<br>
+   /// Does nothing when called again.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void finish()
+   {
+      if (!mFinished)
+      {
+         mFinished = true;
+         this->flush();
+         mNext.finish();
+      } // end if
+   } // StageWriteBuffer::finish
+
+protected:
+   /// Passes the data to the first stage.
+   ///
+   /// @param[in]  data  Pointer to the beginning of the data block to write.
+   /// @param[in]  len   Length of the data block to write.
+   /// @since  1.47.0, 18.10.2026
+   void writeData( const unsigned char* const data, size_t len) const override
+   {
+      mNext.write( data, len);
+   } // StageWriteBuffer::writeData
+
+private:
+   /// The first stage.
+   IWriteStage&  mNext;
+   /// Set when finish() was called.
+   bool          mFinished = false;
+
+}; // StageWriteBuffer< N, P>
+
+
+// Template Class StageReadBuffer
+// ==============================
+
+
+/// ReadBuffer that gets its data from a chain of read stages.<br>
+/// When the end of the data is reached and more data is requested, readData()
+/// throws a \c std::runtime_error.
+///
+/// @tparam  N  The size of the buffer to use.
+/// @tparam  P  The statistics policy of the buffer.
+/// @since  1.47.0, 18.10.2026
+template< size_t N, typename P = EmptyReadPolicy>
+   class StageReadBuffer: public ReadBuffer< N, P>
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  source  The last stage to get the data from.
+   /// @since  1.47.0, 18.10.2026
+   explicit StageReadBuffer( IReadStage& source):
+      ReadBuffer< N, P>(),
+      mSource( source)
+   {
+   } // StageReadBuffer::StageReadBuffer
+
+protected:
+   /// Gets the next data from the stage.
+   ///
+   /// @param[in]  data  Pointer to the buffer to read the data into.
+   /// @param[in]  len   Maximum length of the data to read.
+   /// @return  Number of bytes of data actually read.
+   /// @throw  std::runtime_error at the end of the data.
+   /// @since  1.47.0, 18.10.2026
+   size_t readData( unsigned char* data, size_t len) override
+   {
+      const size_t  data_read = mSource.read( data, len);
+
+      if (data_read == 0)
+         throw std::runtime_error( "end of data reached");
+
+      return data_read;
+   } // StageReadBuffer::readData
+
+private:
+   /// The stage to get the data from.
+   IReadStage&  mSource;
+
+}; // StageReadBuffer< N, P>
+
+
+} // namespace celma::common
+
+
+// =====  END OF stream_stage.hpp  =====
+
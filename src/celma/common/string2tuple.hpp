@@ -3,7 +3,7 @@
 **
 **    ####   ######  #       #    #   ####
 **   #    #  #       #       ##  ##  #    #
-**   #       ###     #       # ## #  ######    (C) 2016 Rene Eng
+**   #       ###     #       # ## #  ######    (C) 2016-2026 Rene Eng
 **   #    #  #       #       #    #  #    #        LGPL
 **    ####   ######  ######  #    #  #    #
 **
@@ -12,20 +12,28 @@
 
 
 /// @file
-/// See documentation of template function celma::common::tuple_at_index.
+/// See documentation of template functions celma::common::string2tuple(),
+/// celma::common::stringView2tuple() and celma::common::strings2tuples().
 
 
-#ifndef CELMA_COMMON_TUPLE_AT_INDEX_HPP
-#define CELMA_COMMON_TUPLE_AT_INDEX_HPP
+#ifndef CELMA_COMMON_STRING2TUPLE_HPP
+#define CELMA_COMMON_STRING2TUPLE_HPP
 
 
 #include <cassert>
+#include <iterator>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <boost/lexical_cast.hpp>
 
 #include "celma/common/tuple_at_index.hpp"
 #include "celma/common/tuple_length.hpp"
+#include "celma/format/string_to.hpp"
 
 
 namespace celma { namespace common {
@@ -54,8 +62,8 @@ template< typename T> void string2tuple( T& dest_tuple, const std::string& str)
 {
 
    int                     idx = 0;
-   std::string::size_type  last_pos = 0; 
-   std::string::size_type  comma_pos = 0; 
+   std::string::size_type  last_pos = 0;
+   std::string::size_type  comma_pos = 0;
 
    while ((comma_pos = str.find( ',', last_pos)) != std::string::npos)
    {
@@ -74,8 +82,7 @@ template< typename T> void string2tuple( T& dest_tuple, const std::string& str)
 
    tuple_at_index( idx, dest_tuple, tva);
 
-   std::cout << "tuple length = " << tuple_length( dest_tuple) << std::endl;
-   assert( idx + 1 == tuple_length( dest_tuple));
+   assert( static_cast< size_t>( idx + 1) == tuple_length( dest_tuple));
 
 /*
    using a generic lampda with c++ 14
@@ -88,12 +95,169 @@ template< typename T> void string2tuple( T& dest_tuple, const std::string& str)
 }
 
 
+namespace detail {
+
+
+/// Converts one field and assigns it to a tuple element.<br>
+/// Numbers are converted in place with \c std::from_chars(), string views
+/// are assigned directly, all other types (including \c bool and \c char)
+/// use the conversion of string2tuple().
+///
+/// @tparam  T  The type of the tuple element.
+/// @param[out]  dest   The tuple element to assign the value to.
+/// @param[in]   value  The field with the value.
+/// @throw  std::invalid_argument or std::out_of_range if a number could not
+///         be converted.
+/// @throw  boost::bad_lexical_cast if another type could not be converted.
+/// @since  1.47.0, 18.10.2026
+template< typename T> void assignField( T& dest, std::string_view value)
+   noexcept( false)
+{
+   if constexpr (std::is_same_v< T, std::string_view>)
+      dest = value;
+   else if constexpr (std::is_same_v< T, std::string>)
+      dest.assign( value);
+   else if constexpr (std::is_arithmetic_v< T> && !std::is_same_v< T, bool>
+                      && !std::is_same_v< T, char>)
+      format::stringTo( value, dest);
+   else
+      dest = boost::lexical_cast< T>( std::string( value));
+} // assignField
+
+
+/// Extracts the next field from the string and assigns it to a tuple
+/// element.
+///
+/// @tparam  T  The type of the tuple element.
+/// @param[out]     dest        The tuple element to assign the value to.
+/// @param[in]      str         The complete string.
+/// @param[in,out]  pos         Position of the field, returns the position of
+///                             the next field.
+/// @param[in]      separator   The field separator.
+/// @param[in]      last_field  Set for the last element of the tuple.
+/// @throw  std::invalid_argument if the string contains too few or too many
+///         fields.
+/// @since  1.47.0, 18.10.2026
+template< typename T>
+   void nextField( T& dest, std::string_view str, size_t& pos, char separator,
+                   bool last_field) noexcept( false)
+{
+
+   const auto  sep_pos = str.find( separator, pos);
+
+
+   if (last_field)
+   {
+      if (sep_pos != std::string_view::npos)
+         throw std::invalid_argument( "string contains more fields than tuple");
+      assignField( dest, str.substr( pos));
+   } else
+   {
+      if (sep_pos == std::string_view::npos)
+         throw std::invalid_argument( "string contains less fields than tuple");
+      assignField( dest, str.substr( pos, sep_pos - pos));
+      pos = sep_pos + 1;
+   } // end if
+
+} // nextField
+
+
+/// Assigns all fields of the string to the tuple elements, unrolled at
+/// compile time.
+///
+/// @tparam  Tp  The types of the tuple elements.
+/// @tparam  I   The indices of the tuple elements.
+/// @param[out]  dest_tuple  The tuple to assign the values to.
+/// @param[in]   str         The string with the values.
+/// @param[in]   separator   The field separator.
+/// @since  1.47.0, 18.10.2026
+template< typename... Tp, std::size_t... I>
+   void fields2tuple( std::tuple< Tp...>& dest_tuple, std::string_view str,
+                      char separator, std::index_sequence< I...>)
+      noexcept( false)
+{
+
+   size_t  pos = 0;
+
+
+   (nextField( std::get< I>( dest_tuple), str, pos, separator,
+               I + 1 == sizeof...( I)), ...);
+
+} // fields2tuple
+
+
+} // namespace detail
+
+
+/// Splits a string into fields and assigns the values to the elements of a
+/// tuple.<br>
+/// Other than string2tuple(), the iteration over the tuple elements is
+/// unrolled at compile time and numbers are converted in place with
+/// \c std::from_chars(), so no string is created per field. Elements of type
+/// \c std::string_view are set to point into \a str. Types other than
+/// numbers and strings are converted like in string2tuple().
+///
+/// @tparam  Tp  The types of the tuple elements.
+/// @param[out]  dest_tuple  The tuple to assign the values to.
+/// @param[in]   str         The string with the values.
+/// @param[in]   separator   The field separator.
+/// @throw  std::invalid_argument if the number of fields does not match the
+///         number of elements of the tuple, or if a number is invalid.
+/// @throw  std::out_of_range if a number is out of the range of its type.
+/// @throw  boost::bad_lexical_cast if another type could not be converted.
+/// @since  1.47.0, 18.10.2026
+template< typename... Tp>
+   void stringView2tuple( std::tuple< Tp...>& dest_tuple, std::string_view str,
+                          char separator = ',') noexcept( false)
+{
+   static_assert( sizeof...( Tp) > 0, "tuple must not be empty");
+   detail::fields2tuple( dest_tuple, str, separator,
+                         std::index_sequence_for< Tp...>());
+} // stringView2tuple
+
+
+/// Batch version of stringView2tuple(): Converts each string of a container
+/// into a tuple and appends the tuples to a vector. The capacity of the
+/// vector is reserved before the first string is converted.
+///
+/// @tparam  C   The type of the container with the strings.
+/// @tparam  Tp  The types of the tuple elements.
+/// @param[in]      strings    The strings to convert.
+/// @param[in,out]  dest       The vector to append the tuples to.
+/// @param[in]      separator  The field separator.
+/// @throw  std::invalid_argument if a string contains an invalid value or an
+///         invalid number of fields.<br>
+///         The tuples of the strings before are kept in the vector.
+/// @throw  std::out_of_range if a number is out of the range of its type.
+/// @since  1.47.0, 18.10.2026
+template< typename C, typename... Tp>
+   void strings2tuples( const C& strings, std::vector< std::tuple< Tp...>>& dest,
+                        char separator = ',') noexcept( false)
+{
+
+   dest.reserve( dest.size() + std::size( strings));
+
+   for (auto const& str : strings)
+   {
+      dest.emplace_back();
+      try
+      {
+         stringView2tuple( dest.back(), str, separator);
+      } catch (...)
+      {
+         dest.pop_back();
+         throw;
+      } // end try
+   } // end for
+
+} // strings2tuples
+
+
 } // namespace common
 } // namespace celma
 
 
-#endif   // CELMA_COMMON_TUPLE_AT_INDEX_HPP
+#endif   // CELMA_COMMON_STRING2TUPLE_HPP
 
 
 // =========================  END OF string2tuple.hpp  =========================
-
@@ -0,0 +1,496 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of template class celma::common::StringViewTokenizer and
+/// the delimiter classes celma::common::CharDelimiter,
+/// celma::common::StringDelimiter and celma::common::CharSetDelimiter.
+
+
+#pragma once
+
+
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include "celma/common/detail/char_search.hpp"
+#include "celma/container/counting_iterator.hpp"
+
+
+namespace celma::common {
+
+
+/// Delimiter for StringViewTokenizer: A single character.
+///
+/// @since  1.47.0, 18.10.2026
+class CharDelimiter
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  delimiter  The delimiter character.
+   /// @since  1.47.0, 18.10.2026
+   explicit CharDelimiter( char delimiter) noexcept:
+      mDelimiter( delimiter)
+   {
+   } // CharDelimiter::CharDelimiter
+
+   /// Returns the position of the next delimiter in the range.
+   ///
+   /// @param[in]  first  Pointer to the first character of the range.
+   /// @param[in]  last   Pointer behind the last character of the range.
+   /// @return  Pointer to the delimiter, \a last if none was found.
+   /// @since  1.47.0, 18.10.2026
+   const char* find( const char* first, const char* last) const noexcept
+   {
+      // memchr() is already vectorised by the C library
+      const auto  found = ::memchr( first, mDelimiter, last - first);
+      return (found != nullptr) ? static_cast< const char*>( found) : last;
+   } // CharDelimiter::find
+
+   /// Returns the length of the delimiter.
+   ///
+   /// @return  Always 1.
+   /// @since  1.47.0, 18.10.2026
+   size_t length() const noexcept
+   {
+      return 1;
+   } // CharDelimiter::length
+
+private:
+   /// The delimiter character.
+   const char  mDelimiter;
+
+}; // CharDelimiter
+
+
+/// Delimiter for StringViewTokenizer: A string of multiple characters.
+///
+/// @since  1.47.0, 18.10.2026
+class StringDelimiter
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  delimiter  The delimiter string.
+   /// @throw  std::invalid_argument if the delimiter is empty.
+   /// @since  1.47.0, 18.10.2026
+   explicit StringDelimiter( std::string_view delimiter) noexcept( false):
+      mDelimiter( delimiter)
+   {
+      if (mDelimiter.empty())
+         throw std::invalid_argument( "delimiter must not be empty");
+   } // StringDelimiter::StringDelimiter
+
+   /// Returns the position of the next delimiter in the range.
+   ///
+   /// @param[in]  first  Pointer to the first character of the range.
+   /// @param[in]  last   Pointer behind the last character of the range.
+   /// @return  Pointer to the delimiter, \a last if none was found.
+   /// @since  1.47.0, 18.10.2026
+   const char* find( const char* first, const char* last) const noexcept
+   {
+      const std::string_view  range( first, last - first);
+      const auto              pos = range.find( mDelimiter);
+      return (pos != std::string_view::npos) ? first + pos : last;
+   } // StringDelimiter::find
+
+   /// Returns the length of the delimiter.
+   ///
+   /// @return  The length of the delimiter string.
+   /// @since  1.47.0, 18.10.2026
+   size_t length() const noexcept
+   {
+      return mDelimiter.length();
+   } // StringDelimiter::length
+
+private:
+   /// The delimiter string.
+   const std::string  mDelimiter;
+
+}; // StringDelimiter
+
+
+/// Delimiter for StringViewTokenizer: Any character of a set.<br>
+/// Small sets are searched with AVX2/SSE2 if available.
+///
+/// @since  1.47.0, 18.10.2026
+class CharSetDelimiter
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  delimiters  The delimiter characters.
+   /// @throw  std::invalid_argument if no delimiter character is given.
+   /// @since  1.47.0, 18.10.2026
+   explicit CharSetDelimiter( std::string_view delimiters) noexcept( false):
+      mDelimiters( delimiters)
+   {
+      if (mDelimiters.chars().empty())
+         throw std::invalid_argument( "delimiter set must not be empty");
+   } // CharSetDelimiter::CharSetDelimiter
+
+   /// Returns the position of the next delimiter in the range.
+   ///
+   /// @param[in]  first  Pointer to the first character of the range.
+   /// @param[in]  last   Pointer behind the last character of the range.
+   /// @return  Pointer to the delimiter, \a last if none was found.
+   /// @since  1.47.0, 18.10.2026
+   const char* find( const char* first, const char* last) const noexcept
+   {
+      return detail::findFirstOf( first, last, mDelimiters);
+   } // CharSetDelimiter::find
+
+   /// Returns the length of the delimiter.
+   ///
+   /// @return  Always 1.
+   /// @since  1.47.0, 18.10.2026
+   size_t length() const noexcept
+   {
+      return 1;
+   } // CharSetDelimiter::length
+
+private:
+   /// The delimiter characters.
+   const detail::CharSet  mDelimiters;
+
+}; // CharSetDelimiter
+
+
+/// Tokenizer that splits a string without copying it: The tokens are returned
+/// as string views into the original string.<br>
+/// Like TokenizerBase, provides a counting iterator and the number of tokens.
+/// Other than TokenizerBase, the caller must make sure that the string
+/// persists until the tokenisation is finished.
+///
+/// @tparam  D  The type of the delimiter: CharDelimiter, StringDelimiter or
+///             CharSetDelimiter.
+/// @since  1.47.0, 18.10.2026
+template< typename D = CharDelimiter>
+   class StringViewTokenizer: public container::ICountResult
+{
+public:
+   /// Iterator that returns the tokens.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   class iterator
+   {
+   public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type        = std::string_view;
+      using difference_type   = std::ptrdiff_t;
+      using pointer           = const std::string_view*;
+      using reference         = const std::string_view&;
+
+      /// Constructor.
+      ///
+      /// @param[in]  owner   The tokenizer object.
+      /// @param[in]  at_end  Set to create the end iterator.
+      /// @since  1.47.0, 18.10.2026
+      iterator( const StringViewTokenizer* owner, bool at_end);
+
+      /// Equality comparison operator.
+      ///
+      /// @param[in]  other  The other iterator to compare against.
+      /// @return  \c true if both iterators point to the same token.
+      /// @since  1.47.0, 18.10.2026
+      bool operator ==( const iterator& other) const noexcept;
+
+      /// Not-equal comparison operator.
+      ///
+      /// @param[in]  other  The other iterator to compare against.
+      /// @return  \c true if the iterators point to different tokens.
+      /// @since  1.47.0, 18.10.2026
+      bool operator !=( const iterator& other) const noexcept;
+
+      /// Pre-increment operator.
+      ///
+      /// @return  This object, pointing to the next token.
+      /// @since  1.47.0, 18.10.2026
+      iterator& operator ++( std::prefix);
+
+      /// Post-increment operator.
+      ///
+      /// @return  Object pointing to the current token.
+      /// @since  1.47.0, 18.10.2026
+      iterator operator ++( std::postfix);
+
+      /// Dereference operator.
+      ///
+      /// @return  The current token.
+      /// @since  1.47.0, 18.10.2026
+      reference operator *() const noexcept;
+
+      /// Member access operator.
+      ///
+      /// @return  Pointer to the current token.
+      /// @since  1.47.0, 18.10.2026
+      pointer operator ->() const noexcept;
+
+   private:
+      /// Searches the next token.
+      ///
+      /// @since  1.47.0, 18.10.2026
+      void next();
+
+      /// The tokenizer object.
+      const StringViewTokenizer*  mpOwner;
+      /// The current token.
+      std::string_view            mToken;
+      /// Start of the remaining string.
+      const char*                 mpNext = nullptr;
+      /// Set when the last token was found.
+      bool                        mLastToken = false;
+      /// Set when this iterator is at the end.
+      bool                        mAtEnd = false;
+
+   }; // StringViewTokenizer< D>::iterator
+
+   friend class container::CountingIterator< iterator>;
+
+   /// Type of the counting iterator.
+   using counting_iterator = container::CountingIterator< iterator>;
+
+   /// Constructor.
+   ///
+   /// @param[in]  s           The string to split, must persist until the
+   ///                         tokenisation is finished.
+   /// @param[in]  delimiter   The delimiter.
+   /// @param[in]  keep_empty  Set to also return empty tokens (leading,
+   ///                         trailing or consecutive delimiters).
+   /// @since  1.47.0, 18.10.2026
+   StringViewTokenizer( std::string_view s, D delimiter,
+                        bool keep_empty = false);
+
+   /// Default destructor is just fine.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   ~StringViewTokenizer() override = default;
+
+   /// Returns an iterator that points to the first token.
+   ///
+   /// @return  Iterator that points to the first token.
+   /// @since  1.47.0, 18.10.2026
+   iterator begin() const;
+
+   /// Returns an iterator that points behind the last token.
+   ///
+   /// @return  Iterator that points behind the last token.
+   /// @since  1.47.0, 18.10.2026
+   iterator end() const;
+
+   /// Returns a counting iterator that points to the first token.
+   ///
+   /// @return  Counting iterator that points to the first token.
+   /// @since  1.47.0, 18.10.2026
+   counting_iterator begin_counting();
+
+   /// Returns a counting iterator that points behind the last token.
+   ///
+   /// @return  Counting iterator that points behind the last token.
+   /// @since  1.47.0, 18.10.2026
+   counting_iterator end_counting();
+
+   /// Returns the number of tokens that were found when the iterating over the
+   /// results with a counting iterator is finished.
+   ///
+   /// @return  Number of tokens found in the string.
+   /// @since  1.47.0, 18.10.2026
+   int numTokens() const;
+
+private:
+   // Don't copy or assign, iterators point to the object.
+   StringViewTokenizer( const StringViewTokenizer&) = delete;
+   StringViewTokenizer& operator =( const StringViewTokenizer&) = delete;
+
+   /// Sets the number of tokens found.
+   ///
+   /// @param[in]  theCount  The number of tokens that were found.
+   /// @since  1.47.0, 18.10.2026
+   void setCount( int theCount) override;
+
+   /// The string to split.
+   const std::string_view  mString;
+   /// The delimiter.
+   const D                 mDelimiter;
+   /// Set if empty tokens should be returned too.
+   const bool              mKeepEmpty;
+   /// The number of tokens found when iterating over the results.
+   int                     mNumTokens = 0;
+
+}; // StringViewTokenizer< D>
+
+
+// inlined methods
+// ===============
+
+
+template< typename D>
+   StringViewTokenizer< D>::iterator::iterator( const StringViewTokenizer* owner,
+                                                bool at_end):
+      mpOwner( owner),
+      mpNext( owner->mString.data()),
+      mLastToken( owner->mString.empty()),
+      mAtEnd( at_end)
+{
+   if (!mAtEnd)
+      next();
+} // StringViewTokenizer< D>::iterator::iterator
+
+
+template< typename D>
+   bool StringViewTokenizer< D>::iterator::operator ==( const iterator& other)
+      const noexcept
+{
+   return (mpOwner == other.mpOwner) && (mAtEnd == other.mAtEnd)
+          && (mAtEnd || (mToken.data() == other.mToken.data()));
+} // StringViewTokenizer< D>::iterator::operator ==
+
+
+template< typename D>
+   bool StringViewTokenizer< D>::iterator::operator !=( const iterator& other)
+      const noexcept
+{
+   return !(*this == other);
+} // StringViewTokenizer< D>::iterator::operator !=
+
+
+template< typename D>
+   typename StringViewTokenizer< D>::iterator&
+      StringViewTokenizer< D>::iterator::operator ++( std::prefix)
+{
+   next();
+   return *this;
+} // StringViewTokenizer< D>::iterator::operator ++
+
+
+template< typename D>
+   typename StringViewTokenizer< D>::iterator
+      StringViewTokenizer< D>::iterator::operator ++( std::postfix)
+{
+   auto  copy( *this);
+   next();
+   return copy;
+} // StringViewTokenizer< D>::iterator::operator ++
+
+
+template< typename D>
+   typename StringViewTokenizer< D>::iterator::reference
+      StringViewTokenizer< D>::iterator::operator *() const noexcept
+{
+   return mToken;
+} // StringViewTokenizer< D>::iterator::operator *
+
+
+template< typename D>
+   typename StringViewTokenizer< D>::iterator::pointer
+      StringViewTokenizer< D>::iterator::operator ->() const noexcept
+{
+   return &mToken;
+} // StringViewTokenizer< D>::iterator::operator ->
+
+
+template< typename D> void StringViewTokenizer< D>::iterator::next()
+{
+
+   const char* const  end = mpOwner->mString.data() + mpOwner->mString.length();
+
+
+   for (;;)
+   {
+      if (mLastToken)
+      {
+         mToken = std::string_view();
+         mAtEnd = true;
+         return;
+      } // end if
+
+      const char*  delim = mpOwner->mDelimiter.find( mpNext, end);
+
+      mToken = std::string_view( mpNext, delim - mpNext);
+      if (delim == end)
+      {
+         mLastToken = true;
+      } else
+      {
+         mpNext = delim + mpOwner->mDelimiter.length();
+      } // end if
+
+      if (!mToken.empty() || mpOwner->mKeepEmpty)
+         return;
+   } // end for
+
+} // StringViewTokenizer< D>::iterator::next
+
+
+template< typename D>
+   StringViewTokenizer< D>::StringViewTokenizer( std::string_view s,
+                                                 D delimiter, bool keep_empty):
+      ICountResult(),
+      mString( s),
+      mDelimiter( std::move( delimiter)),
+      mKeepEmpty( keep_empty)
+{
+} // StringViewTokenizer< D>::StringViewTokenizer
+
+
+template< typename D>
+   typename StringViewTokenizer< D>::iterator StringViewTokenizer< D>::begin() const
+{
+   return iterator( this, false);
+} // StringViewTokenizer< D>::begin
+
+
+template< typename D>
+   typename StringViewTokenizer< D>::iterator StringViewTokenizer< D>::end() const
+{
+   return iterator( this, true);
+} // StringViewTokenizer< D>::end
+
+
+template< typename D>
+   typename StringViewTokenizer< D>::counting_iterator
+      StringViewTokenizer< D>::begin_counting()
+{
+   return counting_iterator( this, begin());
+} // StringViewTokenizer< D>::begin_counting
+
+
+template< typename D>
+   typename StringViewTokenizer< D>::counting_iterator
+      StringViewTokenizer< D>::end_counting()
+{
+   return counting_iterator( this, end());
+} // StringViewTokenizer< D>::end_counting
+
+
+template< typename D> int StringViewTokenizer< D>::numTokens() const
+{
+   return mNumTokens;
+} // StringViewTokenizer< D>::numTokens
+
+
+template< typename D> void StringViewTokenizer< D>::setCount( int theCount)
+{
+   mNumTokens = theCount;
+} // StringViewTokenizer< D>::setCount
+
+
+} // namespace celma::common
+
+
+// =====  END OF string_view_tokenizer.hpp  =====
+
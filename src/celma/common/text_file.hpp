@@ -19,13 +19,19 @@
 #define CELMA_COMMON_TEXT_FILE_HPP
 
 
+#include <algorithm>
+#include <exception>
 #include <functional>
+#include <memory>
 #include <string>
 #include <stdexcept>
+#include <thread>
 #include <type_traits>
+#include <vector>
 #include "celma/common/detail/stream_line_iterator.hpp"
 #include "celma/common/detail/filter_policy.hpp"
 #include "celma/common/detail/line_handler_policy.hpp"
+#include "celma/common/detail/mmap_line_iterator.hpp"
 #include "celma/common/reset_at_exit.hpp"
 
 
@@ -48,10 +54,17 @@ using detail::StatLineHandler;
 ///             implementation.
 /// @tparam  S  The type of the statistics object used by the line handler class
 ///             to compute a statistic.
+/// @tparam  I  The iterator class template that actually reads the file:
+///             detail::StreamLineIterator reads the file line by line and
+///             returns copies of the lines, detail::MmapLineIterator maps the
+///             file and returns string views, see MmapTextFile.
+/// @since  1.47.0, 18.10.2026  (added template parameter I)
 /// @since  1.3.0, 13.04.2016
 template< typename F = detail::NoFilter,
           typename H = detail::DummyLineHandler,
-          typename S = std::nullptr_t> class TextFile
+          typename S = std::nullptr_t,
+          template< typename, typename, typename> class I
+             = detail::StreamLineIterator> class TextFile
 {
 public:
    /// Default constructor. Call set() afterwards to specify the file to read.
@@ -86,7 +99,7 @@ public:
    void setStatObj( S& stat_obj);
 
    /// Type of the iterator.
-   using const_iterator = detail::StreamLineIterator< F, H, S>;
+   using const_iterator = I< F, H, S>;
 
    /// Returns the iterator pointing to the beginning of the file.
    /// @return  Iterator set on the beginning of the file.
@@ -108,7 +121,76 @@ public:
    /// @since  1.3.0, 16.05.2017
    const_iterator cend() const noexcept( false);
 
+   /// Processes the file in parallel: The file is mapped into memory and split
+   /// into chunks at line boundaries, each chunk is processed by a separate
+   /// thread using the filter and line handler policies of this class.<br>
+   /// If a statistics object was set, each chunk computes its own statistic,
+   /// these are added to the statistics object at the end. So the type  S
+   /// must provide the operator +=.<br>
+   /// The lines are passed as \c std::string_view to the policies and the
+   /// function, independent of the iterator type \a I.
+   ///
+   /// @tparam  Fn  The type of the function to call for each line.
+   /// @param[in]  line_fn
+   ///    The function to call with each line that was not filtered. Is called
+   ///    concurrently from multiple threads, in no particular order.
+   /// @param[in]  num_chunks
+   ///    The number of chunks == threads to use, 0 means one per processor.
+   /// @throw  std::runtime_error if the file could not be mapped.
+   /// @throw  Any exception thrown by a line handler or the line function,
+   ///         rethrown after all threads finished.
+   /// @since  1.47.0, 18.10.2026
+   template< typename Fn>
+      void processParallel( Fn line_fn, size_t num_chunks = 0) const
+         noexcept( false);
+
+   /// Processes the file in parallel like processParallel(), but each chunk
+   /// collects its own result. At the end, the results are passed to the
+   /// reduce function in the order of the chunks, i.e. in the order of the
+   /// lines in the file.
+   ///
+   /// @tparam  T   The type of the result object used per chunk, must be
+   ///              default constructible.
+   /// @tparam  Fn  The type of the function to call for each line.
+   /// @tparam  R   The type of the reduce function.
+   /// @param[in]  line_fn
+   ///    The function to call with the result object of the chunk and each line
+   ///    that was not filtered. Is called concurrently from multiple threads,
+   ///    but for the same chunk always from the same thread.
+   /// @param[in]  reduce_fn
+   ///    The function that is called with each chunk result (as rvalue), in the
+   ///    order of the chunks and from the calling thread.
+   /// @param[in]  num_chunks
+   ///    The number of chunks == threads to use, 0 means one per processor.
+   /// @throw  std::runtime_error if the file could not be mapped.
+   /// @throw  Any exception thrown by a line handler or the line function,
+   ///         rethrown after all threads finished.
+   /// @since  1.47.0, 18.10.2026
+   template< typename T, typename Fn, typename R>
+      void processParallelOrdered( Fn line_fn, R reduce_fn,
+         size_t num_chunks = 0) const noexcept( false);
+
 private:
+   /// Type of the iterator used to process a chunk.
+   using chunk_iterator = detail::MmapLineIterator< F, H, S>;
+
+   /// Returns the number of chunks to use.
+   /// @param[in]  num_chunks  The number of chunks requested by the caller.
+   /// @return  The given number of chunks, the number of processors if 0.
+   /// @since  1.47.0, 18.10.2026
+   static size_t numChunks( size_t num_chunks);
+
+   /// Maps the file, splits it into chunks and calls the chunk function for
+   /// each chunk in a separate thread.
+   /// @tparam  Fn  The type of the chunk function.
+   /// @param[in]  num_chunks  The number of chunks to create.
+   /// @param[in]  chunk_fn
+   ///    The function to call with the chunk index, the iterator for the
+   ///    chunk and the end iterator.
+   /// @since  1.47.0, 18.10.2026
+   template< typename Fn> void runChunks( size_t num_chunks, Fn chunk_fn) const
+      noexcept( false);
+
    /// Internal method that actually creates a new iterator object.<br>
    /// This specific method creates an iterator that accepts/uses a statistic
    /// object.
@@ -126,7 +208,7 @@ private:
    {
       const ResetAtExit< S*>  rae( mpStatObject, nullptr);
       return const_iterator( mFilename, mpStatObject);
-   } // TextFile< F, H, S>::beginStatIter
+   } // TextFile< F, H, S, I>::beginStatIter
 
    /// Internal method that actually creates a new iterator object.<br>
    /// This specific method creates an iterator that does not accept/use a
@@ -142,7 +224,7 @@ private:
          beginStatIter( T*) const
    {
       return const_iterator( mFilename);
-   } // TextFile< F, H, S>::beginStatIter
+   } // TextFile< F, H, S, I>::beginStatIter
 
    /// The file to read from.
    std::string  mFilename;
@@ -150,82 +232,235 @@ private:
    /// the next iterator object that is created through a begin()/cbegin() call.
    mutable S*   mpStatObject = nullptr;
 
-}; // TextFile< F, H, S>
+}; // TextFile< F, H, S, I>
+
+
+/// Text file that is mapped into memory, the iterator returns the lines as
+/// \c std::string_view into the mapping, i.e. without copying the data.<br>
+/// The filter and line handler policies must accept the line as
+/// \c std::string_view, like all the policies provided by this library.
+///
+/// @tparam  F  Line filter policy.
+/// @tparam  H  Additional policy object that is called for each line.
+/// @tparam  S  The type of the statistics object used by the line handler.
+/// @since  1.47.0, 18.10.2026
+template< typename F = detail::NoFilter,
+          typename H = detail::DummyLineHandler,
+          typename S = std::nullptr_t>
+   using MmapTextFile = TextFile< F, H, S, detail::MmapLineIterator>;
 
 
 // inlined methods
 // ===============
 
 
-template< typename F, typename H, typename S> TextFile< F, H, S>::TextFile():
+template< typename F, typename H, typename S,
+          template< typename, typename, typename> class I>
+   TextFile< F, H, S, I>::TextFile():
    mFilename()
 {
-} // TextFile< F, H, S>::TextFile
+} // TextFile< F, H, S, I>::TextFile
 
 
-template< typename F, typename H, typename S>
-   TextFile< F, H, S>::TextFile( const std::string& fname):
+template< typename F, typename H, typename S,
+          template< typename, typename, typename> class I>
+   TextFile< F, H, S, I>::TextFile( const std::string& fname):
       mFilename( fname)
 {
    if (fname.empty())
       throw std::runtime_error( "file name may not be empty");
-} // TextFile< F, H, S>::TextFile
+} // TextFile< F, H, S, I>::TextFile
 
 
-template< typename F, typename H, typename S>
-   TextFile< F, H, S>::TextFile( const TextFile& other):
+template< typename F, typename H, typename S,
+          template< typename, typename, typename> class I>
+   TextFile< F, H, S, I>::TextFile( const TextFile& other):
       mFilename( other.mFilename),
       mpStatObject( nullptr)
 {
-} // TextFile< F, H, S>::TextFile
+} // TextFile< F, H, S, I>::TextFile
 
 
-template< typename F, typename H, typename S>
-   void TextFile< F, H, S>::TextFile::set( const std::string& fname)
+template< typename F, typename H, typename S,
+          template< typename, typename, typename> class I>
+   void TextFile< F, H, S, I>::TextFile::set( const std::string& fname)
 {
    if (fname.empty())
       throw std::runtime_error( "file name may not be empty");
    mFilename = fname;
-} // TextFile< F, H, S>::set
+} // TextFile< F, H, S, I>::set
 
 
-template< typename F, typename H, typename S>
-   void TextFile< F, H, S>::setStatObj( S& stat_obj)
+template< typename F, typename H, typename S,
+          template< typename, typename, typename> class I>
+   void TextFile< F, H, S, I>::setStatObj( S& stat_obj)
 {
    mpStatObject = &stat_obj;
-} // TextFile< F, H, S>::setStatObj
+} // TextFile< F, H, S, I>::setStatObj
 
 
-template< typename F, typename H, typename S>
-   typename TextFile< F, H, S>::const_iterator
-      TextFile< F, H, S>::TextFile::begin() const
+template< typename F, typename H, typename S,
+          template< typename, typename, typename> class I>
+   typename TextFile< F, H, S, I>::const_iterator
+      TextFile< F, H, S, I>::TextFile::begin() const
 {
    return beginStatIter( mpStatObject);
-} // TextFile< F, H, S>::begin
+} // TextFile< F, H, S, I>::begin
 
 
-template< typename F, typename H, typename S>
-   typename TextFile< F, H, S>::const_iterator
-      TextFile< F, H, S>::TextFile::cbegin() const
+template< typename F, typename H, typename S,
+          template< typename, typename, typename> class I>
+   typename TextFile< F, H, S, I>::const_iterator
+      TextFile< F, H, S, I>::TextFile::cbegin() const
 {
    return beginStatIter( mpStatObject);
-} // TextFile< F, H, S>::cbegin
+} // TextFile< F, H, S, I>::cbegin
 
 
-template< typename F, typename H, typename S>
-   typename TextFile< F, H, S>::const_iterator
-      TextFile< F, H, S>::TextFile::end() const
+template< typename F, typename H, typename S,
+          template< typename, typename, typename> class I>
+   typename TextFile< F, H, S, I>::const_iterator
+      TextFile< F, H, S, I>::TextFile::end() const
 {
    return const_iterator( mFilename, true);
-} // TextFile< F, H, S>::end
+} // TextFile< F, H, S, I>::end
 
 
-template< typename F, typename H, typename S>
-   typename TextFile< F, H, S>::const_iterator
-      TextFile< F, H, S>::TextFile::cend() const
+template< typename F, typename H, typename S,
+          template< typename, typename, typename> class I>
+   typename TextFile< F, H, S, I>::const_iterator
+      TextFile< F, H, S, I>::TextFile::cend() const
 {
    return const_iterator( mFilename, true);
-} // TextFile< F, H, S>::cend
+} // TextFile< F, H, S, I>::cend
+
+
+template< typename F, typename H, typename S,
+          template< typename, typename, typename> class I>
+   template< typename Fn>
+      void TextFile< F, H, S, I>::processParallel( Fn line_fn,
+         size_t num_chunks) const
+{
+   runChunks( numChunks( num_chunks),
+              [&]( size_t, chunk_iterator iter, const chunk_iterator& end_iter)
+   {
+      for (; iter != end_iter; ++iter)
+         line_fn( *iter);
+   });
+} // TextFile< F, H, S, I>::processParallel
+
+
+template< typename F, typename H, typename S,
+          template< typename, typename, typename> class I>
+   template< typename T, typename Fn, typename R>
+      void TextFile< F, H, S, I>::processParallelOrdered( Fn line_fn,
+         R reduce_fn, size_t num_chunks) const
+{
+
+   num_chunks = numChunks( num_chunks);
+
+   std::vector< T>  results( num_chunks);
+
+
+   runChunks( num_chunks,
+              [&]( size_t idx, chunk_iterator iter, const chunk_iterator& end_iter)
+   {
+      for (; iter != end_iter; ++iter)
+         line_fn( results[ idx], *iter);
+   });
+
+   for (auto& result : results)
+   {
+      reduce_fn( std::move( result));
+   } // end for
+
+} // TextFile< F, H, S, I>::processParallelOrdered
+
+
+template< typename F, typename H, typename S,
+          template< typename, typename, typename> class I>
+   size_t TextFile< F, H, S, I>::numChunks( size_t num_chunks)
+{
+   if (num_chunks > 0)
+      return num_chunks;
+   return std::max( 1U, std::thread::hardware_concurrency());
+} // TextFile< F, H, S, I>::numChunks
+
+
+template< typename F, typename H, typename S,
+          template< typename, typename, typename> class I>
+   template< typename Fn>
+      void TextFile< F, H, S, I>::runChunks( size_t num_chunks,
+         Fn chunk_fn) const
+{
+
+   // like for an iterator, the statistics object is used only once
+   const ResetAtExit< S*>  rae( mpStatObject, nullptr);
+
+
+   if (mFilename.empty())
+      throw std::runtime_error( "need to specify a file name");
+
+   const auto            mapping = std::make_shared< const detail::MappedFile>(
+      mFilename);
+   const auto            boundaries = detail::lineChunkBoundaries( *mapping,
+                                                                   num_chunks);
+   const chunk_iterator  end_iter( mFilename, true);
+   std::vector< S>       chunk_stats( num_chunks);
+   std::vector< std::exception_ptr>  errors( num_chunks);
+   std::vector< std::thread>         threads;
+
+
+   threads.reserve( num_chunks);
+
+   for (size_t i = 0; i < num_chunks; ++i)
+   {
+      threads.emplace_back( [&, i]()
+      {
+         try
+         {
+            if constexpr (std::is_same_v< S, std::nullptr_t>)
+            {
+               chunk_fn( i, chunk_iterator( mFilename, mapping, boundaries[ i],
+                                            boundaries[ i + 1]),
+                         end_iter);
+            } else
+            {
+               chunk_fn( i, chunk_iterator( mFilename, mapping, boundaries[ i],
+                                            boundaries[ i + 1],
+                                            &chunk_stats[ i]),
+                         end_iter);
+            } // end if
+         } catch (...)
+         {
+            errors[ i] = std::current_exception();
+         } // end try
+      });
+   } // end for
+
+   for (auto& thread : threads)
+   {
+      thread.join();
+   } // end for
+
+   for (auto& error : errors)
+   {
+      if (error)
+         std::rethrow_exception( error);
+   } // end for
+
+   if constexpr (!std::is_same_v< S, std::nullptr_t>)
+   {
+      if (mpStatObject != nullptr)
+      {
+         for (auto const& chunk_stat : chunk_stats)
+         {
+            *mpStatObject += chunk_stat;
+         } // end for
+      } // end if
+   } // end if
+
+} // TextFile< F, H, S, I>::runChunks
 
 
 } // namespace common
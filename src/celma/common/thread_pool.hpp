@@ -0,0 +1,562 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of class celma::common::ThreadPool.
+
+
+#pragma once
+
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "celma/common/adaptive_wait.hpp"
+#include "celma/common/detail/work_stealing_deque.hpp"
+#include "celma/common/managed_thread.hpp"
+#include "celma/common/range_string.hpp"
+
+
+namespace celma::common {
+
+
+namespace detail {
+
+
+/// Base class for the tasks executed by the thread pool.
+///
+/// @since  1.47.0, 18.10.2026
+class PoolTask
+{
+public:
+   virtual ~PoolTask() = default;
+
+   /// Executes the task.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   virtual void run() = 0;
+
+}; // PoolTask
+
+
+/// Task that calls a function object.
+///
+/// @tparam  F  The type of the function object.
+/// @since  1.47.0, 18.10.2026
+template< typename F> class PoolTaskImpl final: public PoolTask
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  func  The function to call.
+   /// @since  1.47.0, 18.10.2026
+   explicit PoolTaskImpl( F&& func):
+      mFunc( std::move( func))
+   {
+   } // PoolTaskImpl< F>::PoolTaskImpl
+
+   /// Calls the function.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void run() override
+   {
+      mFunc();
+   } // PoolTaskImpl< F>::run
+
+private:
+   /// The function to call.
+   F  mFunc;
+
+}; // PoolTaskImpl< F>
+
+
+/// Counts the tasks of a parallel operation that are not finished yet and
+/// stores the first exception thrown by one of these tasks.
+///
+/// @since  1.47.0, 18.10.2026
+class TaskGroup
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  num_tasks  The number of tasks in the group.
+   /// @since  1.47.0, 18.10.2026
+   explicit TaskGroup( size_t num_tasks):
+      mRemaining( static_cast< uint32_t>( num_tasks))
+   {
+   } // TaskGroup::TaskGroup
+
+   /// Executes a task of the group and marks it as finished. An exception
+   /// thrown by the task is stored.
+   ///
+   /// @tparam  F  The type of the function to execute.
+   /// @param[in]  func  The function to execute.
+   /// @since  1.47.0, 18.10.2026
+   template< typename F> void run( F& func) noexcept;
+
+   /// Returns if all tasks of the group finished.
+   ///
+   /// @return  \c true if all tasks finished.
+   /// @since  1.47.0, 18.10.2026
+   bool finished() const noexcept
+   {
+      return mRemaining.load( std::memory_order_acquire) == 0;
+   } // TaskGroup::finished
+
+   /// Blocks until all tasks of the group finished.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void wait() noexcept;
+
+   /// Throws the first exception that was thrown by a task of the group.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void rethrow() const noexcept( false);
+
+private:
+   /// Marks one task as finished, wakes the waiting thread after the last.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void taskDone() noexcept;
+
+   /// The number of tasks that are not finished yet.
+   std::atomic< uint32_t>  mRemaining;
+   /// Protects the exception pointer.
+   std::mutex              mMutex;
+   /// The first exception that was thrown by a task.
+   std::exception_ptr      mException;
+
+}; // TaskGroup
+
+
+} // namespace detail
+
+
+/// Configuration of a thread pool.
+///
+/// @since  1.47.0, 18.10.2026
+struct ThreadPoolConfig
+{
+   /// The number of worker threads, 0 means one per processor.
+   size_t             mNumThreads = 0;
+   /// Prefix for the names of the worker threads, the number of the worker is
+   /// appended. Names longer than 15 characters are truncated. If empty, the
+   /// names of the threads are not set.
+   std::string        mThreadName = "celma-pool";
+   /// If not empty, worker \a n is bound to the CPU <code>mCpus[ n %
+   /// mCpus.size()]</code>.
+   std::vector< int>  mCpus;
+
+}; // ThreadPoolConfig
+
+
+/// Thread pool with work-stealing.<br>
+/// Each worker thread has its own deque of tasks: Tasks submitted by a worker
+/// are added to its own deque, tasks submitted by other threads are added to a
+/// global injection queue. A worker executes the tasks of its own deque
+/// first (newest first), then the tasks from the injection queue, and then
+/// steals the oldest tasks from the deques of the other workers.<br>
+/// Idle workers wait for new tasks with an AdaptiveWait object: They spin and
+/// yield for a short time and then block on a futex, so an idle pool does not
+/// use any CPU time.<br>
+/// A thread that waits for the completion of a parallel operation
+/// (parallelFor(), parallelReduce()) executes pending tasks in the meantime,
+/// therefore parallel operations may be nested.<br>
+/// When the pool is destroyed, all pending tasks are executed before the
+/// worker threads terminate.
+///
+/// @since  1.47.0, 18.10.2026
+class ThreadPool
+{
+public:
+   /// Constructor, starts the worker threads.
+   ///
+   /// @param[in]  config  The configuration of the pool.
+   /// @throw  std::invalid_argument if the list of CPUs contains an invalid
+   ///         CPU number.
+   /// @throw  std::system_error if a worker could not be bound to its CPU.
+   /// @since  1.47.0, 18.10.2026
+   explicit ThreadPool( ThreadPoolConfig config = ThreadPoolConfig())
+      noexcept( false);
+
+   ThreadPool( const ThreadPool&) = delete;
+
+   /// Destructor, executes the pending tasks and terminates the worker
+   /// threads.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   ~ThreadPool();
+
+   ThreadPool& operator =( const ThreadPool&) = delete;
+
+   /// Returns the number of worker threads.
+   ///
+   /// @return  The number of worker threads.
+   /// @since  1.47.0, 18.10.2026
+   size_t size() const noexcept
+   {
+      return mWorkers.size();
+   } // ThreadPool::size
+
+   /// Adds a task to execute.
+   ///
+   /// @tparam  F     The type of the function to call.
+   /// @tparam  Args  The types of the arguments to pass to the function.
+   /// @param[in]  func  The function to call.
+   /// @param[in]  args  The arguments to pass to the function, are copied or
+   ///                   moved.
+   /// @return  The future that returns the result of the function, or the
+   ///          exception thrown by the function.
+   /// @since  1.47.0, 18.10.2026
+   template< typename F, typename... Args>
+      auto submit( F&& func, Args&&... args)
+         -> std::future< std::invoke_result_t< std::decay_t< F>,
+                                               std::decay_t< Args>...>>;
+
+   /// Calls a function for each index in a range, in parallel.<br>
+   /// The range is split into chunks, which are processed by the workers and
+   /// the calling thread.
+   ///
+   /// @tparam  Fn  The type of the function to call.
+   /// @param[in]  first  The first index of the range.
+   /// @param[in]  last   The index after the last index of the range.
+   /// @param[in]  fn     The function to call with each index:
+   ///                    <code>void fn( size_t idx)</code>.
+   /// @param[in]  grain  The number of indices per chunk, 0 creates four
+   ///                    chunks per worker.
+   /// @throw  The first exception thrown by the function, after all chunks
+   ///         were processed.
+   /// @since  1.47.0, 18.10.2026
+   template< typename Fn>
+      void parallelFor( size_t first, size_t last, Fn fn, size_t grain = 0)
+         noexcept( false);
+
+   /// Calls a function for each value generated by a range string, in
+   /// parallel.
+   ///
+   /// @tparam  T   The type of the values.
+   /// @tparam  Fn  The type of the function to call.
+   /// @param[in]  values  The range string that generates the values.
+   /// @param[in]  fn      The function to call with each value:
+   ///                     <code>void fn( T value)</code>.
+   /// @param[in]  grain   The number of values per chunk, 0 creates four
+   ///                     chunks per worker.
+   /// @throw  The first exception thrown by the function, after all chunks
+   ///         were processed.
+   /// @since  1.47.0, 18.10.2026
+   template< typename T, typename Fn>
+      void parallelFor( const RangeString< T>& values, Fn fn, size_t grain = 0)
+         noexcept( false);
+
+   /// Computes a value from all indices in a range, in parallel.<br>
+   /// Each chunk of the range computes a partial result, starting with
+   /// \a init. The partial results are then combined in the order of the
+   /// chunks, so the result does not depend on the scheduling.
+   ///
+   /// @tparam  T         The type of the result.
+   /// @tparam  MapFn     The type of the function that computes the value for
+   ///                    an index.
+   /// @tparam  ReduceFn  The type of the function that combines two values.
+   /// @param[in]  first      The first index of the range.
+   /// @param[in]  last       The index after the last index of the range.
+   /// @param[in]  init       The initial value, must be the identity of
+   ///                        \a reduce_fn.
+   /// @param[in]  map_fn     Computes the value of an index:
+   ///                        <code>T map_fn( size_t idx)</code>.
+   /// @param[in]  reduce_fn  Combines two values:
+   ///                        <code>T reduce_fn( T a, T b)</code>.
+   /// @param[in]  grain      The number of indices per chunk, 0 creates four
+   ///                        chunks per worker.
+   /// @return  The combined value of all indices, \a init for an empty range.
+   /// @throw  The first exception thrown by one of the functions, after all
+   ///         chunks were processed.
+   /// @since  1.47.0, 18.10.2026
+   template< typename T, typename MapFn, typename ReduceFn>
+      T parallelReduce( size_t first, size_t last, T init, MapFn map_fn,
+                        ReduceFn reduce_fn, size_t grain = 0) noexcept( false);
+
+   /// Returns the statistics of the idle workers waiting for tasks.
+   ///
+   /// @return  The statistics of the wait strategy of the workers.
+   /// @since  1.47.0, 18.10.2026
+   WaitStatistics idleStatistics() const noexcept
+   {
+      return mIdleWait.statistics();
+   } // ThreadPool::idleStatistics
+
+private:
+   /// Data of a worker thread.
+   struct Worker
+   {
+      /// The tasks submitted by the worker.
+      detail::WorkStealingDeque< detail::PoolTask>  mTasks;
+   };
+
+   /// Creates a task for a function object.
+   ///
+   /// @tparam  F  The type of the function object.
+   /// @param[in]  func  The function object.
+   /// @return  The new task.
+   /// @since  1.47.0, 18.10.2026
+   template< typename F> static detail::PoolTask* makeTask( F&& func)
+   {
+      return new detail::PoolTaskImpl< std::decay_t< F>>( std::forward< F>( func));
+   } // ThreadPool::makeTask
+
+   /// Calls a function for each chunk of a range and waits until all chunks
+   /// are processed.
+   ///
+   /// @tparam  ChunkFn  The type of the function to call.
+   /// @param[in]  first       The first index of the range.
+   /// @param[in]  last        The index after the last index of the range.
+   /// @param[in]  num_chunks  The number of chunks to create.
+   /// @param[in]  chunk_fn    Processes a chunk: <code>void chunk_fn(
+   ///                         size_t chunk_idx, size_t first, size_t
+   ///                         last)</code>.
+   /// @throw  The first exception thrown by the function.
+   /// @since  1.47.0, 18.10.2026
+   template< typename ChunkFn>
+      void runChunks( size_t first, size_t last, size_t num_chunks,
+                      ChunkFn& chunk_fn) noexcept( false);
+
+   /// Returns the number of chunks to split a range into.
+   ///
+   /// @param[in]  range_size  The number of indices in the range.
+   /// @param[in]  grain       The requested number of indices per chunk, 0
+   ///                         for the default.
+   /// @return  The number of chunks, at most \a range_size.
+   /// @since  1.47.0, 18.10.2026
+   size_t numChunks( size_t range_size, size_t grain) const noexcept;
+
+   /// Adds a task: To the deque of the worker if called by a worker of this
+   /// pool, to the injection queue otherwise. Wakes a parked worker.
+   ///
+   /// @param[in]  task  The task to add, the pool takes ownership.
+   /// @since  1.47.0, 18.10.2026
+   void enqueue( detail::PoolTask* task);
+
+   /// Executes pending tasks until all tasks of the group are finished.
+   ///
+   /// @param[in]  group  The group to wait for.
+   /// @since  1.47.0, 18.10.2026
+   void helpUntil( detail::TaskGroup& group);
+
+   /// Searches a task to execute: The own deque, the injection queue and
+   /// finally the deques of the other workers.
+   ///
+   /// @param[in]  worker_idx  The index of the calling worker, -1 if called by
+   ///                         another thread.
+   /// @return  The task found, NULL if there is none.
+   /// @since  1.47.0, 18.10.2026
+   detail::PoolTask* findTask( int worker_idx);
+
+   /// Executes and deletes a task.
+   ///
+   /// @param[in]  task  The task to execute.
+   /// @since  1.47.0, 18.10.2026
+   static void runTask( detail::PoolTask* task);
+
+   /// Main function of the worker threads.
+   ///
+   /// @param[in]  worker_idx  The index of the worker.
+   /// @since  1.47.0, 18.10.2026
+   void workerLoop( int worker_idx);
+
+   /// The configuration.
+   const ThreadPoolConfig                         mConfig;
+   /// The data of the workers.
+   std::vector< std::unique_ptr< Worker>>         mWorkers;
+   /// The worker threads.
+   std::vector< std::unique_ptr< ManagedThread>>  mThreads;
+   /// Protects the injection queue.
+   mutable std::mutex                             mInjectionMutex;
+   /// Tasks submitted by threads that are not workers of this pool.
+   std::deque< detail::PoolTask*>                 mInjectionQueue;
+   /// Number of tasks in the injection queue, checked without the lock.
+   std::atomic< size_t>                           mNumInjected{ 0};
+   /// Used by idle workers to wait for new tasks.
+   AdaptiveWait                                   mIdleWait;
+   /// Set when the pool is destroyed.
+   std::atomic< bool>                             mStop{ false};
+
+}; // ThreadPool
+
+
+// inlined methods
+// ===============
+
+
+template< typename F> void detail::TaskGroup::run( F& func) noexcept
+{
+
+   try
+   {
+      func();
+   } catch (...)
+   {
+      std::lock_guard< std::mutex>  lock( mMutex);
+      if (!mException)
+         mException = std::current_exception();
+   } // end try
+
+   taskDone();
+
+} // detail::TaskGroup::run
+
+
+template< typename F, typename... Args>
+   auto ThreadPool::submit( F&& func, Args&&... args)
+      -> std::future< std::invoke_result_t< std::decay_t< F>,
+                                            std::decay_t< Args>...>>
+{
+
+   using result_t = std::invoke_result_t< std::decay_t< F>,
+                                          std::decay_t< Args>...>;
+
+   std::packaged_task< result_t()>  task(
+      [ fn = std::forward< F>( func),
+        params = std::make_tuple( std::forward< Args>( args)...)]() mutable
+      {
+         return std::apply( fn, std::move( params));
+      });
+   auto  result = task.get_future();
+
+
+   enqueue( makeTask( std::move( task)));
+
+   return result;
+} // ThreadPool::submit
+
+
+template< typename Fn>
+   void ThreadPool::parallelFor( size_t first, size_t last, Fn fn,
+                                 size_t grain) noexcept( false)
+{
+
+   if (first >= last)
+      return;
+
+   auto  chunk_fn = [ &fn]( size_t, size_t chunk_first, size_t chunk_last)
+   {
+      for (size_t idx = chunk_first; idx < chunk_last; ++idx)
+         fn( idx);
+   };
+
+
+   runChunks( first, last, numChunks( last - first, grain), chunk_fn);
+
+} // ThreadPool::parallelFor
+
+
+template< typename T, typename Fn>
+   void ThreadPool::parallelFor( const RangeString< T>& values, Fn fn,
+                                 size_t grain) noexcept( false)
+{
+
+   std::vector< T>  value_list;
+
+
+   // the range string iterator is sequential, so the values are generated
+   // first
+   for (auto it = values.begin(); it != values.end(); ++it)
+      value_list.push_back( static_cast< T>( it));
+
+   parallelFor( 0, value_list.size(), [ &fn, &value_list]( size_t idx)
+   {
+      fn( value_list[ idx]);
+   }, grain);
+
+} // ThreadPool::parallelFor
+
+
+template< typename T, typename MapFn, typename ReduceFn>
+   T ThreadPool::parallelReduce( size_t first, size_t last, T init,
+                                 MapFn map_fn, ReduceFn reduce_fn,
+                                 size_t grain) noexcept( false)
+{
+
+   if (first >= last)
+      return init;
+
+   const auto       num_chunks = numChunks( last - first, grain);
+   std::vector< T>  partial( num_chunks, init);
+   auto             chunk_fn = [ &]( size_t chunk_idx, size_t chunk_first,
+                                     size_t chunk_last)
+   {
+      T  value = init;
+      for (size_t idx = chunk_first; idx < chunk_last; ++idx)
+         value = reduce_fn( std::move( value), map_fn( idx));
+      partial[ chunk_idx] = std::move( value);
+   };
+
+
+   runChunks( first, last, num_chunks, chunk_fn);
+
+   T  result = std::move( partial[ 0]);
+   for (size_t i = 1; i < num_chunks; ++i)
+      result = reduce_fn( std::move( result), std::move( partial[ i]));
+
+   return result;
+} // ThreadPool::parallelReduce
+
+
+template< typename ChunkFn>
+   void ThreadPool::runChunks( size_t first, size_t last, size_t num_chunks,
+                               ChunkFn& chunk_fn) noexcept( false)
+{
+
+   const size_t       range_size = last - first;
+   detail::TaskGroup  group( num_chunks);
+
+
+   // the first chunk is processed by the calling thread, after the other
+   // chunks were made available to the workers
+   for (size_t chunk_idx = num_chunks - 1; chunk_idx > 0; --chunk_idx)
+   {
+      const size_t  chunk_first = first + range_size * chunk_idx / num_chunks;
+      const size_t  chunk_last = first + range_size * (chunk_idx + 1)
+                                 / num_chunks;
+      enqueue( makeTask( [ &group, &chunk_fn, chunk_idx, chunk_first,
+                           chunk_last]()
+      {
+         auto  call = [ &]() { chunk_fn( chunk_idx, chunk_first, chunk_last); };
+         group.run( call);
+      }));
+   } // end for
+
+   auto  first_chunk = [ &]()
+   {
+      chunk_fn( 0, first, first + range_size / num_chunks);
+   };
+   group.run( first_chunk);
+
+   helpUntil( group);
+   group.rethrow();
+
+} // ThreadPool::runChunks
+
+
+} // namespace celma::common
+
+
+// =====  END OF thread_pool.hpp  =====
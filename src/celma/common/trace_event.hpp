@@ -0,0 +1,391 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of classes celma::common::Tracer and
+/// celma::common::TraceScope, and the macros TRACE_SCOPE and TRACE_INSTANT.
+
+
+#pragma once
+
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include "boost/preprocessor/cat.hpp"
+#include "celma/common/tsc_clock.hpp"
+
+
+namespace celma::common {
+
+
+/// Static data of a trace call point: The name of the event and its
+/// category. Both must be string literals or otherwise live until the trace is
+/// written.
+///
+/// @since  1.47.0, 18.10.2026
+struct TraceCallSite
+{
+   /// Name of the event.
+   const char*  mName;
+   /// Category of the event, used for filtering in the trace viewer.
+   const char*  mCategory;
+
+}; // TraceCallSite
+
+
+/// One recorded trace event.
+///
+/// @since  1.47.0, 18.10.2026
+struct TraceEvent
+{
+   /// The call site that recorded the event.
+   const TraceCallSite*  mSite;
+   /// Timestamp of the event, in nanoseconds of TscClock.
+   int64_t               mTimestamp;
+   /// Duration of a scope, in nanoseconds, 0 for instant events.
+   int64_t               mDuration;
+   /// Chrome trace event phase: 'X' for complete (scope) events, 'i' for
+   /// instant events.
+   char                  mPhase;
+
+}; // TraceEvent
+
+
+namespace detail {
+
+
+/// Ring buffer for the trace events of one thread: Single producer (the
+/// thread), single consumer (the collector), lock-free.<br>
+/// When the buffer is full, new events are dropped and counted.
+///
+/// @since  1.47.0, 18.10.2026
+class TraceBuffer
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  capacity     Number of events to store, rounded up to a
+   ///                          power of two.
+   /// @param[in]  thread_id    The id of the thread (\c gettid()).
+   /// @param[in]  thread_name  The name of the thread.
+   /// @since  1.47.0, 18.10.2026
+   TraceBuffer( size_t capacity, int thread_id, std::string thread_name);
+
+   /// Stores an event. Must only be called by the owning thread.
+   ///
+   /// @param[in]  event  The event to store.
+   /// @since  1.47.0, 18.10.2026
+   void push( const TraceEvent& event) noexcept;
+
+   /// Removes all events from the buffer and passes them to a function. Must
+   /// only be called by one thread at a time.
+   ///
+   /// @tparam  F  The type of the function.
+   /// @param[in]  fun  The function to call for each event.
+   /// @since  1.47.0, 18.10.2026
+   template< typename F> void drain( F fun);
+
+   /// Returns the id of the thread.
+   ///
+   /// @return  The thread id.
+   /// @since  1.47.0, 18.10.2026
+   int threadId() const noexcept
+   {
+      return mThreadId;
+   } // TraceBuffer::threadId
+
+   /// Returns the name of the thread.
+   ///
+   /// @return  The thread name.
+   /// @since  1.47.0, 18.10.2026
+   const std::string& threadName() const noexcept
+   {
+      return mThreadName;
+   } // TraceBuffer::threadName
+
+   /// Returns the number of events that were dropped because the buffer was
+   /// full.
+   ///
+   /// @return  The number of events dropped.
+   /// @since  1.47.0, 18.10.2026
+   uint64_t numDropped() const noexcept
+   {
+      return mNumDropped.load( std::memory_order_relaxed);
+   } // TraceBuffer::numDropped
+
+   /// Called by the owning thread when it ends. Afterwards, no more events are
+   /// stored in the buffer, and it can be deleted once it is drained.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void release() noexcept
+   {
+      mReleased.store( true, std::memory_order_release);
+   } // TraceBuffer::release
+
+   /// Returns if the owning thread ended.
+   ///
+   /// @return  \c true if release() was called.
+   /// @since  1.47.0, 18.10.2026
+   bool released() const noexcept
+   {
+      return mReleased.load( std::memory_order_acquire);
+   } // TraceBuffer::released
+
+private:
+   /// The events.
+   std::vector< TraceEvent>             mEvents;
+   /// Capacity - 1, to compute the index in the buffer.
+   const uint64_t                       mMask;
+   /// The id of the thread.
+   const int                            mThreadId;
+   /// The name of the thread.
+   const std::string                    mThreadName;
+   /// Index of the next event to write, updated by the producer.
+   alignas( 64) std::atomic< uint64_t>  mHead{ 0};
+   /// Index of the next event to read, updated by the consumer.
+   alignas( 64) std::atomic< uint64_t>  mTail{ 0};
+   /// Number of events dropped.
+   std::atomic< uint64_t>               mNumDropped{ 0};
+   /// Set when the owning thread ended.
+   std::atomic< bool>                   mReleased{ false};
+
+}; // TraceBuffer
+
+
+} // namespace detail
+
+
+/// Collects trace events from all threads and writes them in the Chrome
+/// trace event JSON format, which can be loaded in \c chrome://tracing or in
+/// Perfetto (https://ui.perfetto.dev).<br>
+/// Each thread records its events into its own lock-free ring buffer, which is
+/// created on the first event of the thread. The thread name is taken from the
+/// OS at this point, so name the thread before, e.g. with ThreadOptions.<br>
+/// The buffer of a thread is deleted by writeJson() after the thread ended and
+/// its events were written. So the buffers of short-lived threads use memory
+/// until the next call of writeJson(), call it regularly when many threads
+/// are created.<br>
+/// Recording is disabled by default. When disabled, a trace point costs only
+/// the check of an atomic flag.<br>
+/// Usage:
+/// @code
+///   Tracer::enable();
+///   ...
+///   void Stage::process( Message& msg)
+///   {
+///      TRACE_SCOPE( "process", "pipeline");
+///      ...
+///      TRACE_INSTANT( "queue full", "pipeline");
+///   }
+///   ...
+///   std::ofstream  out( "trace.json");
+///   Tracer::writeJson( out);
+/// @endcode
+///
+/// @since  1.47.0, 18.10.2026
+class Tracer
+{
+public:
+   Tracer() = delete;
+
+   /// Enables the recording of events.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   static void enable() noexcept;
+
+   /// Disables the recording of events. Events recorded so far remain in the
+   /// buffers.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   static void disable() noexcept;
+
+   /// Returns if events are recorded.
+   ///
+   /// @return  \c true if recording is enabled.
+   /// @since  1.47.0, 18.10.2026
+   static bool enabled() noexcept
+   {
+      return mEnabled.load( std::memory_order_relaxed);
+   } // Tracer::enabled
+
+   /// Sets the number of events per thread buffer. Applies to buffers created
+   /// afterwards.<br>
+   /// Each thread that records an event allocates a buffer of this size times
+   /// the size of an event (32 bytes), i.e. 2 MiB by default. The buffer is
+   /// kept after the thread ended, until its events were written by
+   /// writeJson().
+   ///
+   /// @param[in]  num_events  The capacity of a thread buffer, rounded up to a
+   ///                         power of two. Default is 65536.
+   /// @throw  std::invalid_argument if \a num_events is 0.
+   /// @since  1.47.0, 18.10.2026
+   static void setBufferSize( size_t num_events);
+
+   /// Records an event of a scope that was left.
+   ///
+   /// @param[in]  site       The call site of the scope.
+   /// @param[in]  start      When the scope was entered, TscClock nanoseconds.
+   /// @param[in]  duration   How long the scope took, in nanoseconds.
+   /// @since  1.47.0, 18.10.2026
+   static void complete( const TraceCallSite& site, int64_t start,
+                         int64_t duration);
+
+   /// Records an instant event.
+   ///
+   /// @param[in]  site  The call site of the event.
+   /// @since  1.47.0, 18.10.2026
+   static void instant( const TraceCallSite& site);
+
+   /// Writes all events recorded so far in the Chrome trace event JSON format
+   /// and removes them from the buffers. Deletes the buffers of the threads
+   /// that ended.
+   ///
+   /// @param[in]  os  The stream to write into.
+   /// @return  The number of events written.
+   /// @since  1.47.0, 18.10.2026
+   static size_t writeJson( std::ostream& os);
+
+   /// Returns the number of events that were dropped because a thread buffer
+   /// was full.
+   ///
+   /// @return  The number of events dropped over all threads.
+   /// @since  1.47.0, 18.10.2026
+   static uint64_t numDropped();
+
+private:
+   /// Returns the buffer of the calling thread, creates it on the first call.
+   ///
+   /// @return  The buffer of the calling thread, NULL if the thread is ending
+   ///          and its buffer was released already.
+   /// @since  1.47.0, 18.10.2026
+   static detail::TraceBuffer* threadBuffer();
+
+   /// Flag, set when recording is enabled.
+   static inline std::atomic< bool>  mEnabled{ false};
+
+}; // Tracer
+
+
+/// Records the time between its construction and destruction as a complete
+/// event, if tracing was enabled at construction.<br>
+/// Use the macro TRACE_SCOPE to create the call site and the object.
+///
+/// @since  1.47.0, 18.10.2026
+class TraceScope
+{
+public:
+   /// Constructor, stores the start time if tracing is enabled.
+   ///
+   /// @param[in]  site  The static data of the call site.
+   /// @since  1.47.0, 18.10.2026
+   explicit TraceScope( const TraceCallSite& site) noexcept:
+      mSite( site),
+      mStart( Tracer::enabled() ? TscClock::now().time_since_epoch().count()
+                                : -1)
+   {
+   } // TraceScope::TraceScope
+
+   TraceScope( const TraceScope&) = delete;
+   TraceScope& operator =( const TraceScope&) = delete;
+
+   /// Destructor, records the event.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   ~TraceScope()
+   {
+      if (mStart >= 0)
+         Tracer::complete( mSite, mStart,
+                           TscClock::now().time_since_epoch().count() - mStart);
+   } // TraceScope::~TraceScope
+
+private:
+   /// The call site.
+   const TraceCallSite&  mSite;
+   /// Start time in nanoseconds, -1 if tracing was disabled.
+   const int64_t         mStart;
+
+}; // TraceScope
+
+
+// inlined methods
+// ===============
+
+
+inline void detail::TraceBuffer::push( const TraceEvent& event) noexcept
+{
+
+   const uint64_t  head = mHead.load( std::memory_order_relaxed);
+
+
+   if (head - mTail.load( std::memory_order_acquire) > mMask)
+   {
+      mNumDropped.store( mNumDropped.load( std::memory_order_relaxed) + 1,
+                         std::memory_order_relaxed);
+      return;
+   } // end if
+
+   mEvents[ head & mMask] = event;
+   mHead.store( head + 1, std::memory_order_release);
+
+} // detail::TraceBuffer::push
+
+
+template< typename F> void detail::TraceBuffer::drain( F fun)
+{
+
+   const uint64_t  head = mHead.load( std::memory_order_acquire);
+   uint64_t        tail = mTail.load( std::memory_order_relaxed);
+
+
+   for (; tail != head; ++tail)
+      fun( mEvents[ tail & mMask]);
+
+   mTail.store( tail, std::memory_order_release);
+
+} // detail::TraceBuffer::drain
+
+
+} // namespace celma::common
+
+
+/// Records the time spent from this macro to the end of the enclosing scope as
+/// trace event.
+///
+/// @param  name      The name of the event, a string literal.
+/// @param  category  The category of the event, a string literal.
+/// @since  1.47.0, 18.10.2026
+#define  TRACE_SCOPE( name, category) \
+   static const celma::common::TraceCallSite  BOOST_PP_CAT( tcs, __LINE__) \
+      { name, category }; \
+   const celma::common::TraceScope  BOOST_PP_CAT( ts, __LINE__)( \
+      BOOST_PP_CAT( tcs, __LINE__))
+
+
+/// Records an instant event.
+///
+/// @param  name      The name of the event, a string literal.
+/// @param  category  The category of the event, a string literal.
+/// @since  1.47.0, 18.10.2026
+#define  TRACE_INSTANT( name, category) \
+   do \
+   { \
+      static const celma::common::TraceCallSite  tcs_instant{ name, category }; \
+      if (celma::common::Tracer::enabled()) \
+         celma::common::Tracer::instant( tcs_instant); \
+   } while (false)
+
+
+// =====  END OF trace_event.hpp  =====
@@ -0,0 +1,195 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of class celma::common::TscClock.
+
+
+#pragma once
+
+
+#include <chrono>
+#include <cstdint>
+#if defined( __x86_64__) || defined( __i386__)
+#  include <x86intrin.h>
+#endif
+
+
+namespace celma::common {
+
+
+namespace detail {
+
+
+/// 128 bit unsigned integer for the conversion of ticks into nanoseconds.
+__extension__ typedef unsigned __int128  uint128_t;
+
+
+} // namespace detail
+
+
+/// Clock that reads the time stamp counter of the processor (\c rdtscp on
+/// x86) and converts the ticks into nanoseconds.<br>
+/// Reading the TSC costs only a few nanoseconds, about a fifth of a call to
+/// \c steady_clock::now(), which makes this clock suitable to time
+/// sub-microsecond operations.<br>
+/// The tick rate is calibrated once against \c std::chrono::steady_clock, on
+/// the first call to now(). The result is only reliable when the processor
+/// has an invariant TSC, check with available(). On other platforms, the clock
+/// falls back to \c steady_clock.<br>
+/// Meets the requirements of a \c std::chrono clock, so it can be used with
+/// NanoTimer, ScopeTimer etc.
+///
+/// @since  1.47.0, 18.10.2026
+class TscClock
+{
+public:
+   using rep        = int64_t;
+   using period     = std::nano;
+   using duration   = std::chrono::nanoseconds;
+   using time_point = std::chrono::time_point< TscClock>;
+
+   static constexpr bool  is_steady = true;
+
+   /// Returns the current time.
+   ///
+   /// @return  The current value of the TSC, converted into nanoseconds.
+   /// @since  1.47.0, 18.10.2026
+   static time_point now() noexcept;
+
+   /// Returns the current value of the time stamp counter, without waiting
+   /// for previous instructions to complete (\c rdtsc).
+   ///
+   /// @return  The current TSC value.
+   /// @since  1.47.0, 18.10.2026
+   static uint64_t ticks() noexcept;
+
+   /// Returns the current value of the time stamp counter after all previous
+   /// instructions completed (\c rdtscp).
+   ///
+   /// @return  The current TSC value.
+   /// @since  1.47.0, 18.10.2026
+   static uint64_t ticksOrdered() noexcept;
+
+   /// Converts a number of TSC ticks into nanoseconds.
+   ///
+   /// @param[in]  num_ticks  The number of ticks to convert.
+   /// @return  The corresponding time period.
+   /// @since  1.47.0, 18.10.2026
+   static duration toDuration( uint64_t num_ticks) noexcept;
+
+   /// Returns the number of TSC ticks per microsecond, as calibrated.
+   ///
+   /// @return  The TSC frequency in MHz, 1000 when the TSC is not used.
+   /// @since  1.47.0, 18.10.2026
+   static double ticksPerMicrosecond() noexcept;
+
+   /// Returns if the processor provides an invariant TSC, i.e. one that runs
+   /// with a constant rate, independent of the processor frequency and
+   /// sleep states.
+   ///
+   /// @return  \c true if the TSC can be used for time measurements.
+   /// @since  1.47.0, 18.10.2026
+   static bool available() noexcept;
+
+private:
+   /// Fixed point factor to convert ticks into nanoseconds:
+   /// nanos = ticks * mMultiplier >> Shift.
+   struct Calibration
+   {
+      /// The factor to multiply the ticks with.
+      uint64_t  mMultiplier;
+      /// TSC frequency in MHz.
+      double    mTicksPerMicrosecond;
+   };
+
+   /// Number of bits of the fractional part of the multiplier.
+   static constexpr int  Shift = 32;
+
+   /// Returns the calibration data, calibrates the TSC on the first call.
+   ///
+   /// @return  The calibration data.
+   /// @since  1.47.0, 18.10.2026
+   static const Calibration& calibration() noexcept;
+
+   /// Measures the TSC frequency against \c steady_clock.
+   ///
+   /// @return  The calibration data.
+   /// @since  1.47.0, 18.10.2026
+   static Calibration calibrate() noexcept;
+
+}; // TscClock
+
+
+// inlined methods
+// ===============
+
+
+inline TscClock::time_point TscClock::now() noexcept
+{
+#if defined( __x86_64__) || defined( __i386__)
+   return time_point( toDuration( ticksOrdered()));
+#else
+   return time_point( std::chrono::duration_cast< duration>(
+      std::chrono::steady_clock::now().time_since_epoch()));
+#endif
+} // TscClock::now
+
+
+inline uint64_t TscClock::ticks() noexcept
+{
+#if defined( __x86_64__) || defined( __i386__)
+   return __rdtsc();
+#else
+   return static_cast< uint64_t>( std::chrono::duration_cast< duration>(
+      std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+} // TscClock::ticks
+
+
+inline uint64_t TscClock::ticksOrdered() noexcept
+{
+#if defined( __x86_64__) || defined( __i386__)
+   unsigned int  aux;
+   return __rdtscp( &aux);
+#else
+   return ticks();
+#endif
+} // TscClock::ticksOrdered
+
+
+inline TscClock::duration TscClock::toDuration( uint64_t num_ticks) noexcept
+{
+   return duration( static_cast< rep>(
+      (static_cast< detail::uint128_t>( num_ticks)
+       * calibration().mMultiplier) >> Shift));
+} // TscClock::toDuration
+
+
+inline double TscClock::ticksPerMicrosecond() noexcept
+{
+   return calibration().mTicksPerMicrosecond;
+} // TscClock::ticksPerMicrosecond
+
+
+inline const TscClock::Calibration& TscClock::calibration() noexcept
+{
+   static const Calibration  calib = calibrate();
+   return calib;
+} // TscClock::calibration
+
+
+} // namespace celma::common
+
+
+// =====  END OF tsc_clock.hpp  =====
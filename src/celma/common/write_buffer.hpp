@@ -19,6 +19,7 @@
 #define CELMA_COMMON_WRITE_BUFFER_HPP
 
 
+#include <chrono>
 #include <cstddef>
 #include <cstring>
 #include <memory>
@@ -54,6 +55,15 @@ public:
    {
    } // EmptyWritePolicy::flushed
 
+   /// Called when appending data had to wait until a buffer was written to
+   /// the destination: Does nothing.
+   ///
+   /// @param  Ignored.
+   /// @since  1.47.0, 18.10.2026
+   void stalled( std::chrono::nanoseconds /* duration */)
+   {
+   } // EmptyWritePolicy::stalled
+
    /// Always returns 0.
    ///
    /// @return  0.
@@ -90,6 +100,24 @@ public:
       return 0;
    } // EmptyWritePolicy::bytesFlushed
 
+   /// Always returns 0.
+   ///
+   /// @return  0.
+   /// @since  1.47.0, 18.10.2026
+   size_t numStalls() const
+   {
+      return 0;
+   } // EmptyWritePolicy::numStalls
+
+   /// Always returns 0.
+   ///
+   /// @return  0.
+   /// @since  1.47.0, 18.10.2026
+   std::chrono::nanoseconds stallTime() const
+   {
+      return std::chrono::nanoseconds( 0);
+   } // EmptyWritePolicy::stallTime
+
 }; // EmptyWritePolicy
 
 
@@ -127,6 +155,18 @@ public:
       mBytesFlushed += len;
    } // WriteCountPolicy::flushed
 
+   /// Called by AsyncWriteBuffer when appending data had to wait until a
+   /// buffer was written to the destination.<br>
+   /// Counts the number of stalls and the total time spent waiting.
+   ///
+   /// @param[in]  duration  The time spent waiting for a free buffer.
+   /// @since  1.47.0, 18.10.2026
+   void stalled( std::chrono::nanoseconds duration)
+   {
+      ++mNumStalls;
+      mStallTime += duration;
+   } // WriteCountPolicy::stalled
+
    /// Returns how many times WriteBuffer::append() was called.
    ///
    /// @return
@@ -177,6 +217,25 @@ public:
       return mBytesFlushed;
    } // WriteCountPolicy::bytesFlushed
 
+   /// Returns how many times appending data had to wait for a free buffer.
+   ///
+   /// @return  Number of times that the producer stalled.
+   /// @since  1.47.0, 18.10.2026
+   size_t numStalls() const
+   {
+      return mNumStalls;
+   } // WriteCountPolicy::numStalls
+
+   /// Returns the total time that appending data had to wait for a free
+   /// buffer.
+   ///
+   /// @return  The sum of all stall times.
+   /// @since  1.47.0, 18.10.2026
+   std::chrono::nanoseconds stallTime() const
+   {
+      return mStallTime;
+   } // WriteCountPolicy::stallTime
+
 private:
    /// Counts the number of times that WriteBuffer::append() was called.
    size_t mNumAppendCalled = 0;
@@ -187,6 +246,10 @@ private:
    size_t mNumFlushCalled = 0;
    /// Counts the amount of bytes written to the destination.
    size_t mBytesFlushed = 0;
+   /// Counts the number of times that appending data had to wait.
+   size_t mNumStalls = 0;
+   /// The total time spent waiting for a free buffer.
+   std::chrono::nanoseconds  mStallTime{ 0};
 
 }; // WriteCountPolicy
 
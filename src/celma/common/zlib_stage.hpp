@@ -0,0 +1,154 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of template classes celma::common::ZlibCompressStage and
+/// celma::common::ZlibDecompressStage.<br>
+/// The compression stages are only part of the library if zlib was found
+/// when the library was built.
+
+
+#pragma once
+
+
+#include "celma/common/detail/zlib_stream.hpp"
+#include "celma/common/stream_stage.hpp"
+
+
+namespace celma::common {
+
+
+// Class ZlibCompressStage
+// =======================
+
+
+/// Write stage that compresses the data with zlib and passes the compressed
+/// data on to the next stage.
+///
+/// @tparam  P  The statistics policy to use.
+/// @since  1.47.0, 18.10.2026
+template< typename P = EmptyStagePolicy>
+   class ZlibCompressStage: public IWriteStage, public P
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  next
+   ///    The next stage to pass the compressed data to.
+   /// @param[in]  level
+   ///    The compression level, 0 (none) to 9 (best), -1 for the default.
+   /// @throw  std::runtime_error if the compression could not be initialised.
+   /// @since  1.47.0, 18.10.2026
+   explicit ZlibCompressStage( IWriteStage& next, int level = -1)
+      noexcept( false):
+         mNext( next),
+         mDeflate( level)
+   {
+   } // ZlibCompressStage::ZlibCompressStage
+
+   /// Compresses the data, passes the compressed data to the next stage as
+   /// soon as an output block is full.
+   ///
+   /// @param[in]  data  Pointer to the data to compress.
+   /// @param[in]  len   The length of the data.
+   /// @since  1.47.0, 18.10.2026
+   void write( const unsigned char* data, size_t len) override
+   {
+      const detail::StageTimer< P>  timer;
+      const auto                    bytes_out = mDeflate.compress( data, len,
+                                                                   mNext, false);
+
+      P::processed( len, bytes_out, timer.elapsed());
+   } // ZlibCompressStage::write
+
+   /// Writes the remaining compressed data, then calls finish() of the next
+   /// stage.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void finish() override
+   {
+      const detail::StageTimer< P>  timer;
+      const auto                    bytes_out = mDeflate.compress( nullptr, 0,
+                                                                   mNext, true);
+
+      P::processed( 0, bytes_out, timer.elapsed());
+      mNext.finish();
+   } // ZlibCompressStage::finish
+
+private:
+   /// The next stage.
+   IWriteStage&         mNext;
+   /// The compression state.
+   detail::ZlibDeflate  mDeflate;
+
+}; // ZlibCompressStage< P>
+
+
+// Class ZlibDecompressStage
+// =========================
+
+
+/// Read stage that reads compressed data from the previous stage and returns
+/// the decompressed data.
+///
+/// @tparam  P  The statistics policy to use.
+/// @since  1.47.0, 18.10.2026
+template< typename P = EmptyStagePolicy>
+   class ZlibDecompressStage: public IReadStage, public P
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  source  The stage to get the compressed data from.
+   /// @throw  std::runtime_error if the decompression could not be
+   ///         initialised.
+   /// @since  1.47.0, 18.10.2026
+   explicit ZlibDecompressStage( IReadStage& source) noexcept( false):
+      mSource( source),
+      mInflate()
+   {
+   } // ZlibDecompressStage::ZlibDecompressStage
+
+   /// Returns the next decompressed data.
+   ///
+   /// @param[in]  data  Pointer to the buffer to store the data in.
+   /// @param[in]  len   Maximum length of the data to return.
+   /// @return  Number of bytes returned, 0 at the end of the compressed data.
+   /// @throw  std::runtime_error if the compressed data is invalid.
+   /// @since  1.47.0, 18.10.2026
+   size_t read( unsigned char* data, size_t len) override
+   {
+      const detail::StageTimer< P>  timer;
+      size_t                        bytes_in = 0;
+      const auto                    data_read = mInflate.decompress( mSource,
+                                       data, len, bytes_in);
+
+      P::processed( bytes_in, data_read, timer.elapsed());
+
+      return data_read;
+   } // ZlibDecompressStage::read
+
+private:
+   /// The stage to get the compressed data from.
+   IReadStage&          mSource;
+   /// The decompression state.
+   detail::ZlibInflate  mInflate;
+
+}; // ZlibDecompressStage< P>
+
+
+} // namespace celma::common
+
+
+// =====  END OF zlib_stage.hpp  =====
+
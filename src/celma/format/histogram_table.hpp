@@ -0,0 +1,68 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of functions celma::format::printPercentiles() and
+/// celma::format::printBuckets().
+
+
+#pragma once
+
+
+#include <iosfwd>
+#include <vector>
+#include "celma/common/latency_histogram.hpp"
+
+
+namespace celma::format {
+
+
+/// Prints the number of values, minimum, mean, the selected percentiles and
+/// the maximum of a histogram as table, using AsciiTable.<br>
+/// Example output:
+/// <pre>
+/// Percentile       Value (ns)
+/// ----------  ---------------
+///      count            10000
+///        min              112
+///       mean              245
+///        p50              231
+///        p99              815
+///      p99.9             1471
+///        max             2003
+/// </pre>
+///
+/// @param[in]  os           The stream to print into.
+/// @param[in]  snap         The histogram to print the percentiles of.
+/// @param[in]  unit         The unit of the values, printed in the title.
+/// @param[in]  percentiles  The percentiles to print.
+/// @since  1.47.0, 18.10.2026
+void printPercentiles( std::ostream& os, const common::HistogramSnapshot& snap,
+                       const char* unit = "ns",
+                       const std::vector< double>& percentiles
+                          = { 50.0, 90.0, 99.0, 99.9, 99.99 });
+
+
+/// Prints the raw counts of all non-empty buckets of a histogram as table,
+/// using AsciiTable, together with the cumulated percentage.
+///
+/// @param[in]  os    The stream to print into.
+/// @param[in]  snap  The histogram to print the buckets of.
+/// @since  1.47.0, 18.10.2026
+void printBuckets( std::ostream& os, const common::HistogramSnapshot& snap);
+
+
+} // namespace celma::format
+
+
+// =====  END OF histogram_table.hpp  =====
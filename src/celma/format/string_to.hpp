@@ -19,7 +19,12 @@
 #define CELMA_FORMAT_STRING_TO_HPP
 
 
+#include <charconv>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
 
 
 namespace celma { namespace format {
@@ -38,7 +43,7 @@ template< typename T> T stringTo( const std::string& std);
 
 
 #define  S2( t, c) \
-   template<> t stringTo< t>( const std::string& str) \
+   template<> inline t stringTo< t>( const std::string& str) \
    { \
       return std::c( str); \
    }
@@ -61,6 +66,47 @@ S2( long double, stold)
 #undef  S2
 
 
+/// Converts the value in a string view into an integer or floating point
+/// value, using \c std::from_chars().<br>
+/// Other than the function above, this function does not need to create a
+/// string, does not depend on the locale and does not skip leading
+/// whitespace: The string must contain only the value, optionally with a
+/// sign.
+///
+/// @tparam  T  The destination type to convert the value into.
+/// @param[in]   str    The string with the value to convert.
+/// @param[out]  value  Returns the converted value.
+/// @throw  std::invalid_argument if the string does not contain a valid
+///         value.
+/// @throw  std::out_of_range if the value is out of the range of the type.
+/// @since  1.47.0, 18.10.2026
+template< typename T> void stringTo( std::string_view str, T& value)
+   noexcept( false)
+{
+
+   static_assert( std::is_arithmetic_v< T>,
+                  "only for integer and floating point types");
+
+   const char*  first = str.data();
+   const char*  last = first + str.length();
+
+
+   // std::from_chars() does not accept a plus sign
+   if ((first != last) && (*first == '+'))
+      ++first;
+
+   const auto  result = std::from_chars( first, last, value);
+
+   if (result.ec == std::errc::result_out_of_range)
+      throw std::out_of_range( "value '" + std::string( str)
+                               + "' is out of range");
+   if ((result.ec != std::errc()) || (result.ptr != last))
+      throw std::invalid_argument( "invalid value '" + std::string( str)
+                                   + "'");
+
+} // stringTo
+
+
 } // namespace format
 } // namespace celma
 
@@ -0,0 +1,126 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of class celma::log::detail::IEmergencyFlush.<br>
+/// Also contains the functions to (un-)register emergency flush objects and
+/// the async-signal-safe helper functions to use in the implementations.
+
+
+#pragma once
+
+
+#include <cstddef>
+#include <initializer_list>
+
+
+namespace celma::log::detail {
+
+
+/// Interface for log destinations that buffer log messages, and that want to
+/// write their pending log messages when the process is terminated by a
+/// signal like \c SIGSEGV or \c SIGABRT.<br>
+/// Objects that implement this interface must register themselves with
+/// registerEmergencyFlush(), and unregister before they are destroyed.<br>
+/// The emergency flush handling itself must be enabled through
+/// celma::log::Logging::enableEmergencyFlush().
+///
+/// @since  1.47.0, 18.10.2026
+class IEmergencyFlush
+{
+public:
+   /// Empty, virtual destructor.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   virtual ~IEmergencyFlush() = default;
+
+   /// Called from the signal handler: Write the pending log messages into
+   /// the destination, followed by a marker line with the number of the
+   /// signal (see writeSignalMarker()).<br>
+   /// Only async-signal-safe functions may be used here, i.e. no memory
+   /// allocation, no locking, no streams.
+   ///
+   /// @param[in]  sig_nbr  The number of the signal that was caught.
+   /// @since  1.47.0, 18.10.2026
+   virtual void emergencyFlush( int sig_nbr) noexcept = 0;
+
+}; // IEmergencyFlush
+
+
+/// Adds an object to the list of objects that are called when the process is
+/// terminated by a signal.<br>
+/// The list has a fixed size, so it can be used in the signal handler without
+/// locking.
+///
+/// @param[in]  ef  Pointer to the object to add.
+/// @return  \c true if the object could be added, \c false if the list is full.
+/// @since  1.47.0, 18.10.2026
+bool registerEmergencyFlush( IEmergencyFlush* ef) noexcept;
+
+/// Removes an object from the list of emergency flush objects.
+///
+/// @param[in]  ef  Pointer to the object to remove.
+/// @since  1.47.0, 18.10.2026
+void unregisterEmergencyFlush( IEmergencyFlush* ef) noexcept;
+
+/// Installs the signal handler for the given signals. When one of these
+/// signals is caught, all registered emergency flush objects are called, then
+/// the signal is raised again with the default handling.<br>
+/// Also installs the alternate signal stack for the calling thread, see
+/// installEmergencyAltStack().
+///
+/// @param[in]  signals  The numbers of the signals to handle.
+/// @since  1.47.0, 18.10.2026
+void installEmergencyFlushHandler( std::initializer_list< int> signals) noexcept;
+
+/// Installs an alternate signal stack for the calling thread, on which the
+/// emergency flush handler runs. Without, a stack overflow in the thread
+/// terminates the process without writing the pending log messages.<br>
+/// The stack is freed when the thread ends. Calling this function again in
+/// the same thread has no effect.
+///
+/// @return  \c true if the alternate stack is installed.
+/// @since  1.47.0, 18.10.2026
+bool installEmergencyAltStack() noexcept;
+
+/// Restores the default handling for all signals for which the emergency
+/// flush handler was installed.
+///
+/// @since  1.47.0, 18.10.2026
+void removeEmergencyFlushHandler() noexcept;
+
+/// Async-signal-safe: Writes all data into the file descriptor, retries on
+/// partial writes and interrupts.
+///
+/// @param[in]  fd    The file descriptor to write into.
+/// @param[in]  data  Pointer to the data to write.
+/// @param[in]  len   The number of bytes to write.
+/// @return  \c true if all data was written.
+/// @since  1.47.0, 18.10.2026
+bool writeAll( int fd, const char* data, size_t len) noexcept;
+
+/// Async-signal-safe: Writes the marker line with the signal number
+/// <pre>*** emergency flush: terminated by signal &lt;nbr&gt; ***</pre>
+/// into the file descriptor.
+///
+/// @param[in]  fd       The file descriptor to write into.
+/// @param[in]  sig_nbr  The number of the signal.
+/// @since  1.47.0, 18.10.2026
+void writeSignalMarker( int fd, int sig_nbr) noexcept;
+
+
+} // namespace celma::log::detail
+
+
+// =====  END OF emergency_flush.hpp  =====
+
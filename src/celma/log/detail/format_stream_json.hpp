@@ -0,0 +1,96 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of class celma::log::detail::FormatStreamJson.
+
+
+#pragma once
+
+
+#include <iosfwd>
+#include <string>
+#include "celma/log/detail/i_format_stream.hpp"
+#include "celma/log/detail/log_msg.hpp"
+
+
+namespace celma::log::detail {
+
+
+/// Formatter for stream output that creates one JSON object per log message,
+/// terminated by a newline:
+/// <pre>{"timestamp_us":...,"pid":...,"thread":...,"file":"...",
+///  "function":"...","line":...,"class":"...","level":"...","error":...,
+///  "text":"...","attributes":{"name":"value",...}}</pre>
+/// All string values are escaped according to the JSON specification.<br>
+/// The attributes object contains the attributes of the log message (including
+/// the parent attribute objects) and the global attributes. If an attribute
+/// name is defined multiple times, only the value with the highest precedence
+/// is written, i.e. the same value that would be used by the text formatter
+/// celma::log::formatting::Format.<br>
+/// The log entry is built in a per-thread buffer and then written into the
+/// stream in one call.
+///
+/// @since  1.47.0, 18.10.2026
+class FormatStreamJson final : public IFormatStream
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  with_attributes
+   ///    Set to \c false if the attributes should not be written.
+   /// @since  1.47.0, 18.10.2026
+   explicit FormatStreamJson( bool with_attributes = true);
+
+   // default destructor is fine
+   ~FormatStreamJson() override = default;
+
+   /// Appends the given string to the destination string, with all characters
+   /// escaped that must be escaped in a JSON string.<br>
+   /// The string is scanned for characters to escape in blocks of 16
+   /// characters (when SSE2 is available), sequences without such characters
+   /// are copied in one step.
+   ///
+   /// @param[out]  dest
+   ///    The string to append to.
+   /// @param[in]   str
+   ///    The string to escape.
+   /// @since  1.47.0, 18.10.2026
+   static void appendEscaped( std::string& dest, const std::string& str);
+
+private:
+   /// Implementation of the interface: Generate the log entry.
+   ///
+   /// @param[out]  out  The stream to write the log entry into.
+   /// @param[in]   msg  The log message object with the data to log.
+   /// @since  1.47.0, 18.10.2026
+   void format( std::ostream& out, const LogMsg& msg) const override;
+
+   /// Writes the attributes object into the destination string.
+   ///
+   /// @param[out]  dest  The string to append the attributes to.
+   /// @param[in]   msg   The log message to write the attributes of.
+   /// @since  1.47.0, 18.10.2026
+   void appendAttributes( std::string& dest, const LogMsg& msg) const;
+
+   /// Set if the attributes should be written.
+   const bool  mWithAttributes;
+
+}; // FormatStreamJson
+
+
+} // namespace celma::log::detail
+
+
+// =====  END OF format_stream_json.hpp  =====
+
@@ -99,6 +99,18 @@ public:
    /// @since  1.15.0, 20.03.2018
    void removeAttribute( const std::string& attr_name);
 
+   /// Calls the given function for each attribute in the container, starting
+   /// with the attribute that was added last.<br>
+   /// The function is called with the name and the value of the attribute as
+   /// parameters.
+   ///
+   /// @tparam  F
+   ///    The type of the function to call.
+   /// @param[in]  fun
+   ///    The function to call for each attribute.
+   /// @since  1.47.0, 18.10.2026
+   template< typename F> void visitAttributes( F&& fun) const;
+
 private:
    /// Value type stored in the internal container.
    using attr_pair_t = std::pair< std::string, std::string>;
@@ -122,6 +134,17 @@ template< typename T>
 } // LogAttributesContainer::addAttribute
 
 
+template< typename F>
+   void LogAttributesContainer::visitAttributes( F&& fun) const
+{
+   for (auto attr_rev_iter = mAttributes.rbegin();
+        attr_rev_iter != mAttributes.rend(); ++attr_rev_iter)
+   {
+      fun( attr_rev_iter->first, attr_rev_iter->second);
+   } // end for
+} // LogAttributesContainer::visitAttributes
+
+
 } // namespace detail
 } // namespace log
 } // namespace celma
@@ -0,0 +1,236 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of class celma::log::detail::LogDestUnixSocket.
+
+
+#pragma once
+
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "celma/log/detail/emergency_flush.hpp"
+#include "celma/log/detail/i_log_dest.hpp"
+#include "celma/log/detail/i_format_stream.hpp"
+
+
+namespace celma::log::detail {
+
+
+class LogMsg;
+
+
+/// Log destination: Local (Unix domain) socket, e.g. to pass the log messages
+/// to a journald-style collector or a sidecar process.<br>
+/// The formatted log messages are collected until a batch is complete, then
+/// the whole batch is sent with one system call (\c sendmmsg() for datagram
+/// sockets, \c sendmsg() with multiple buffers for stream sockets).<br>
+/// Sending never blocks: If the peer cannot receive the data fast enough, the
+/// remaining log messages of the batch are dropped and counted.<br>
+/// On a datagram socket, each log message is sent as one datagram. On a stream
+/// socket, the log messages are sent one after the other, so the formatter
+/// should terminate each log message with a newline (like the default
+/// formatter does). A log message that could be sent only partially is
+/// completed before the next batch is sent, so the stream stays consistent.<br>
+/// When the emergency flush is enabled (see
+/// celma::log::Logging::enableEmergencyFlush()) and the process is terminated
+/// by a signal, the log messages of the current batch and a final marker line
+/// are sent.
+///
+/// @since  1.47.0, 18.10.2026
+class LogDestUnixSocket final : public ILogDest, private IEmergencyFlush
+{
+public:
+   /// The types of sockets that are supported.
+   enum class SocketType
+   {
+      datagram,   //!< Datagram socket, \c SOCK_DGRAM.
+      stream      //!< Stream socket, \c SOCK_STREAM.
+   };
+
+   /// Constructor, creates a socket and connects it to the socket with the
+   /// given path.<br>
+   /// A default stream formatter (FormatStreamDefault) is created for
+   /// formatting the log messages. Use setFormatter() to specify another
+   /// formatter if necessary.
+   ///
+   /// @param[in]  socket_path
+   ///    The path of the socket to send the log messages to.
+   /// @param[in]  socket_type
+   ///    The type of the socket to create.
+   /// @param[in]  batch_size
+   ///    The number of log messages to collect before they are sent.
+   /// @throw  std::runtime_error when the socket could not be created or
+   ///         connected.
+   /// @since  1.47.0, 18.10.2026
+   LogDestUnixSocket( const std::string& socket_path,
+      SocketType socket_type = SocketType::datagram,
+      size_t batch_size = 16) noexcept( false);
+
+   /// Constructor for a socket that is already connected, e.g. one end of a
+   /// socket pair. The socket is switched into non-blocking mode.<br>
+   /// This object takes ownership of the socket, i.e. closes it in the
+   /// destructor.
+   ///
+   /// @param[in]  sock_fd
+   ///    The file descriptor of the connected socket.
+   /// @param[in]  batch_size
+   ///    The number of log messages to collect before they are sent.
+   /// @throw  std::invalid_argument when the file descriptor is invalid.
+   /// @since  1.47.0, 18.10.2026
+   LogDestUnixSocket( int sock_fd, size_t batch_size) noexcept( false);
+
+   LogDestUnixSocket( const LogDestUnixSocket&) = delete;
+   LogDestUnixSocket& operator =( const LogDestUnixSocket&) = delete;
+
+   /// Sends the remaining log messages and closes the socket.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   ~LogDestUnixSocket() override;
+
+   /// Sets the new formatter to use.<br>
+   /// Although the pointer type is \a IFormatBase only, objects passed here
+   /// must be derived from the \a IFormatStream class.
+   ///
+   /// @param[in]  formatter
+   ///    Pointer to the new formatter object to use. If a NULL pointer is
+   ///    passed, the previous formatter is replaced by the default stream
+   ///    formatter.
+   /// @since  1.47.0, 18.10.2026
+   void setFormatter( IFormatBase* formatter = nullptr) override;
+
+   /// Sends the log messages that are currently collected, even if the batch
+   /// is not complete yet.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void flush();
+
+   /// Returns the number of log messages that were sent successfully.
+   ///
+   /// @return  Number of log messages sent.
+   /// @since  1.47.0, 18.10.2026
+   uint64_t numSent() const;
+
+   /// Returns the number of log messages that were dropped because the peer
+   /// could not receive them (fast enough) or because of an error.
+   ///
+   /// @return  Number of log messages dropped.
+   /// @since  1.47.0, 18.10.2026
+   uint64_t numDropped() const;
+
+   /// Returns the number of send calls that failed with an error other than
+   /// "would block".
+   ///
+   /// @return  Number of failed send calls.
+   /// @since  1.47.0, 18.10.2026
+   uint64_t numErrors() const;
+
+private:
+   /// Called through the base class. Formats the log message and adds it to
+   /// the current batch. Sends the batch when it is complete.
+   ///
+   /// @param[in]  msg  The message to send.
+   /// @since  1.47.0, 18.10.2026
+   void message( const LogMsg& msg) override;
+
+   /// Implementation of the IEmergencyFlush interface: Sends the log messages
+   /// of the current batch and the marker line.
+   ///
+   /// @param[in]  sig_nbr  The number of the signal that was caught.
+   /// @since  1.47.0, 18.10.2026
+   void emergencyFlush( int sig_nbr) noexcept override;
+
+   /// Sends the current batch of log messages. Must be called with the mutex
+   /// locked.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void sendBatch();
+
+   /// Sends the current batch through a datagram socket.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void sendDatagrams();
+
+   /// Sends the current batch through a stream socket.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void sendStream();
+
+   /// The file descriptor of the socket.
+   int                              mSocket = -1;
+   /// The type of the socket.
+   SocketType                       mSocketType;
+   /// Number of log messages to collect in one batch.
+   const size_t                     mBatchSize;
+   /// The object used for formatting the log messages.
+   std::unique_ptr< IFormatStream>  mpFormatter;
+   /// Protects the batch and the counters.
+   mutable std::mutex               mMutex;
+   /// The formatted log messages of the current batch.
+   std::vector< std::string>        mBatch;
+   /// Number of valid entries in the batch. The strings are re-used, so the
+   /// vector is not cleared.
+   size_t                           mBatchUsed = 0;
+   /// The buffer descriptions for sending the batch, allocated once.
+   std::vector< struct iovec>       mIoVecs;
+   /// The message headers for sending a batch of datagrams, allocated once.
+   std::vector< struct mmsghdr>     mMsgHeaders;
+   /// Stream sockets only: Remaining part of a log message that could only be
+   /// sent partially.
+   std::string                      mPartial;
+   /// Number of log messages sent.
+   uint64_t                         mNumSent = 0;
+   /// Number of log messages dropped.
+   uint64_t                         mNumDropped = 0;
+   /// Number of failed send calls.
+   uint64_t                         mNumErrors = 0;
+
+}; // LogDestUnixSocket
+
+
+// inlined methods
+// ===============
+
+
+inline uint64_t LogDestUnixSocket::numSent() const
+{
+   const std::lock_guard< std::mutex>  lock( mMutex);
+   return mNumSent;
+} // LogDestUnixSocket::numSent
+
+
+inline uint64_t LogDestUnixSocket::numDropped() const
+{
+   const std::lock_guard< std::mutex>  lock( mMutex);
+   return mNumDropped;
+} // LogDestUnixSocket::numDropped
+
+
+inline uint64_t LogDestUnixSocket::numErrors() const
+{
+   const std::lock_guard< std::mutex>  lock( mMutex);
+   return mNumErrors;
+} // LogDestUnixSocket::numErrors
+
+
+} // namespace celma::log::detail
+
+
+// =====  END OF log_dest_unix_socket.hpp  =====
+
@@ -190,6 +190,13 @@ public:
    ///    1.15.0, 17.10.2018
    std::string getAttributeValue( const std::string& attr_name) const;
 
+   /// Returns the attributes object that was set for this log message.
+   ///
+   /// @return
+   ///    Pointer to the attributes object, NULL if no attributes were set.
+   /// @since  1.47.0, 18.10.2026
+   const LogAttributes* getAttributes() const;
+
 private:
    /// Time stamp when the log message (i.e., this object) was created.
    std::chrono::system_clock::time_point  mTimestamp;
@@ -346,6 +353,12 @@ inline std::string LogMsg::getAttributeValue( const std::string& attr_name) cons
 } // LogMsg::getAttributeValue
 
 
+inline const LogAttributes* LogMsg::getAttributes() const
+{
+   return mpAttributes;
+} // LogMsg::getAttributes
+
+
 // macros
 // ======
 
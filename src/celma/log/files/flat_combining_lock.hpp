@@ -0,0 +1,338 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of class celma::log::files::FlatCombiningLock.
+
+
+#pragma once
+
+
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include "celma/log/detail/log_msg.hpp"
+
+
+namespace celma::log::files {
+
+
+/// Lock policy for celma::log::files::Handler that uses flat combining instead
+/// of serialising all writers on one mutex:<br>
+/// Every thread adds its formatted log message to a list of pending messages.
+/// Then it tries to get the write role. The thread that gets the role writes
+/// all pending messages in one batch, including the messages that are added by
+/// other threads while it is writing. All threads that do not get the write
+/// role return immediately, their messages are written by the current writer
+/// before it gives up the write role.<br>
+/// So the messages of one thread are always written in the order in which they
+/// were created, and when the log call returns, the message is either written
+/// or will be written by the thread that currently has the write role.<br>
+/// Note that the log message object is not stored for the writer: The message
+/// is formatted before it is added to the list, and the file policies only use
+/// the timestamp of the message object. So the writer is called with a
+/// message object that contains only the timestamp of the original message.
+/// <br>
+/// When the writer throws, the exception is passed to the thread that has the
+/// write role at that time. The message that could not be written is dropped
+/// (see numDropped()), all other unwritten messages are put back into the
+/// list of pending messages and are written together with the next log
+/// message.
+///
+/// @since  1.47.0, 18.10.2026
+class FlatCombiningLock
+{
+public:
+   /// Constructor.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   FlatCombiningLock();
+
+   FlatCombiningLock( const FlatCombiningLock&) = delete;
+   ~FlatCombiningLock() = default;
+   FlatCombiningLock& operator =( const FlatCombiningLock&) = delete;
+
+   /// Adds the log message to the list of pending messages and writes all
+   /// pending messages when this thread gets the write role.
+   ///
+   /// @tparam  W
+   ///    The type of the function to call to write a log message.
+   /// @param[in]  msg
+   ///    The log message object.
+   /// @param[in]  msg_text
+   ///    The formatted text of the log message.
+   /// @param[in]  writer
+   ///    The function to call for each log message to write, with the log
+   ///    message object and the formatted text as parameters. Only the
+   ///    timestamp of the log message object is set.
+   /// @throw  The exception thrown by \a writer, see class description.
+   /// @since  1.47.0, 18.10.2026
+   template< typename W>
+      void write( const detail::LogMsg& msg, std::string&& msg_text,
+                  W&& writer);
+
+   /// Same as above, additionally calls \a end_batch after all messages of a
+   /// batch were written, e.g. to flush the file only once per batch.
+   ///
+   /// @tparam  W
+   ///    The type of the function to call to write a log message.
+   /// @tparam  E
+   ///    The type of the function to call after a batch was written.
+   /// @param[in]  msg
+   ///    The log message object.
+   /// @param[in]  msg_text
+   ///    The formatted text of the log message.
+   /// @param[in]  writer
+   ///    The function to call for each log message to write, with the log
+   ///    message object and the formatted text as parameters. Only the
+   ///    timestamp of the log message object is set.
+   /// @param[in]  end_batch
+   ///    The function to call, without parameters, after the last message of
+   ///    a batch was written.
+   /// @throw  The exception thrown by \a writer or \a end_batch.
+   /// @since  1.47.0, 18.10.2026
+   template< typename W, typename E>
+      void write( const detail::LogMsg& msg, std::string&& msg_text,
+                  W&& writer, E&& end_batch);
+
+   /// Returns the number of batches that were written, i.e. how often a thread
+   /// took the write role and found at least one pending message.
+   ///
+   /// @return  The number of batches written.
+   /// @since  1.47.0, 18.10.2026
+   uint64_t numBatches() const;
+
+   /// Returns the number of log messages that were written in addition to the
+   /// first message of each batch, i.e. the number of writes that were
+   /// combined into a batch.
+   ///
+   /// @return  The number of log messages combined into batches.
+   /// @since  1.47.0, 18.10.2026
+   uint64_t numCombined() const;
+
+   /// Returns the number of log messages that were dropped because the writer
+   /// threw an exception.
+   ///
+   /// @return  The number of log messages that could not be written.
+   /// @since  1.47.0, 18.10.2026
+   uint64_t numDropped() const;
+
+   /// Calls the given function with the formatted text of each log message
+   /// that is not written yet.<br>
+   /// Intended for the emergency flush when the process is terminated by a
+   /// signal: No locks are used, the lists are accessed as they are.<br>
+   /// The messages of the batch that is currently written are all visited,
+   /// since the messages written so far may still be buffered until the end
+   /// of the batch.
+   ///
+   /// @tparam  F
+   ///    The type of the function to call.
+   /// @param[in]  fun
+   ///    The function to call with the text of each pending log message.
+   /// @since  1.47.0, 18.10.2026
+   template< typename F> void visitPending( F&& fun) const noexcept;
+
+private:
+   /// Entry in the list of pending messages: The data of the log message that
+   /// is needed to write it.
+   struct Entry
+   {
+      /// The timestamp of the log message, used by the file policies.
+      time_t       mTimestamp;
+      /// The formatted text of the log message.
+      std::string  mText;
+   }; // Entry
+
+   /// Puts the entries of the current batch that were not written back into
+   /// the list of pending messages, except the entry whose write failed.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void requeueUnwritten();
+
+   /// Protects the list of pending log messages.
+   std::mutex                 mPendingMutex;
+   /// The list of pending messages.
+   std::vector< Entry>        mPending;
+   /// The number of pending log messages.
+   std::atomic< size_t>       mNumPending { 0 };
+   /// Set while a thread has the write role.
+   std::atomic< bool>         mWriting { false };
+   /// The list of messages that are currently written, only used by the
+   /// thread with the write role. Kept as member to re-use the memory.
+   std::vector< Entry>        mWriteBatch;
+   /// Number of entries in the current batch that are written already.
+   std::atomic< size_t>       mNumBatchWritten { 0 };
+   /// Number of batches written.
+   std::atomic< uint64_t>     mNumBatches { 0 };
+   /// Number of log messages combined into batches.
+   std::atomic< uint64_t>     mNumCombined { 0 };
+   /// Number of log messages dropped because the writer threw.
+   std::atomic< uint64_t>     mNumDropped { 0 };
+   /// Message object passed to the writer, only used by the thread with the
+   /// write role.
+   detail::LogMsg             mWriteMsg;
+
+}; // FlatCombiningLock
+
+
+// inlined methods
+// ===============
+
+
+inline FlatCombiningLock::FlatCombiningLock():
+   mWriteMsg( LOG_MSG_OBJECT_INIT)
+{
+} // FlatCombiningLock::FlatCombiningLock
+
+
+template< typename W>
+   void FlatCombiningLock::write( const detail::LogMsg& msg,
+                                  std::string&& msg_text, W&& writer)
+{
+   write( msg, std::move( msg_text), std::forward< W>( writer), []() {});
+} // FlatCombiningLock::write
+
+
+template< typename W, typename E>
+   void FlatCombiningLock::write( const detail::LogMsg& msg,
+                                  std::string&& msg_text, W&& writer,
+                                  E&& end_batch)
+{
+   Entry  entry{ msg.getTimestamp(), std::move( msg_text) };
+
+   {
+      const std::lock_guard< std::mutex>  lock( mPendingMutex);
+      mPending.push_back( std::move( entry));
+   } // end scope
+   mNumPending.fetch_add( 1);
+
+   // a message that is added after the writer checked the list for the last
+   // time, but before it gave up the write role, is detected by the writer
+   // through the counter of pending messages (sequentially consistent)
+   while (!mWriting.exchange( true))
+   {
+      try
+      {
+         for (;;)
+         {
+            {
+               const std::lock_guard< std::mutex>  lock( mPendingMutex);
+               mWriteBatch.swap( mPending);
+            } // end scope
+
+            if (mWriteBatch.empty())
+               break;   // for
+
+            mNumPending.fetch_sub( mWriteBatch.size());
+            mNumBatches.fetch_add( 1, std::memory_order_relaxed);
+            mNumCombined.fetch_add( mWriteBatch.size() - 1,
+                                    std::memory_order_relaxed);
+
+            for (auto const& batch_entry : mWriteBatch)
+            {
+               mWriteMsg.setTimestamp( batch_entry.mTimestamp);
+               writer( mWriteMsg, batch_entry.mText);
+               mNumBatchWritten.fetch_add( 1, std::memory_order_relaxed);
+            } // end for
+
+            end_batch();
+            mNumBatchWritten.store( 0, std::memory_order_relaxed);
+            mWriteBatch.clear();
+         } // end for
+      } catch (...)
+      {
+         // keep the messages of the other threads, and give up the write role,
+         // otherwise no message would be written anymore
+         requeueUnwritten();
+         mWriting.store( false);
+         throw;
+      } // end try
+
+      mWriting.store( false);
+
+      if (mNumPending.load() == 0)
+         break;   // while
+   } // end while
+
+} // FlatCombiningLock::write
+
+
+inline uint64_t FlatCombiningLock::numBatches() const
+{
+   return mNumBatches.load( std::memory_order_relaxed);
+} // FlatCombiningLock::numBatches
+
+
+inline uint64_t FlatCombiningLock::numCombined() const
+{
+   return mNumCombined.load( std::memory_order_relaxed);
+} // FlatCombiningLock::numCombined
+
+
+inline uint64_t FlatCombiningLock::numDropped() const
+{
+   return mNumDropped.load( std::memory_order_relaxed);
+} // FlatCombiningLock::numDropped
+
+
+inline void FlatCombiningLock::requeueUnwritten()
+{
+   // the entry at the current index is the one whose write failed
+   const auto  num_written = mNumBatchWritten.load( std::memory_order_relaxed);
+
+   if (num_written < mWriteBatch.size())
+   {
+      mNumDropped.fetch_add( 1, std::memory_order_relaxed);
+
+      const auto  num_unwritten = mWriteBatch.size() - num_written - 1;
+
+      if (num_unwritten > 0)
+      {
+         const std::lock_guard< std::mutex>  lock( mPendingMutex);
+         mPending.insert( mPending.begin(),
+                          std::make_move_iterator( mWriteBatch.begin()
+                                                   + num_written + 1),
+                          std::make_move_iterator( mWriteBatch.end()));
+         mNumPending.fetch_add( num_unwritten);
+      } // end if
+   } // end if
+
+   mNumBatchWritten.store( 0, std::memory_order_relaxed);
+   mWriteBatch.clear();
+} // FlatCombiningLock::requeueUnwritten
+
+
+template< typename F>
+   void FlatCombiningLock::visitPending( F&& fun) const noexcept
+{
+   if (mWriting.load())
+   {
+      for (auto const& entry : mWriteBatch)
+         fun( entry.mText);
+   } // end if
+
+   for (auto const& entry : mPending)
+      fun( entry.mText);
+} // FlatCombiningLock::visitPending
+
+
+} // namespace celma::log::files
+
+
+// =====  END OF flat_combining_lock.hpp  =====
+
@@ -18,14 +18,19 @@
 #pragma once
 
 
+#include <fcntl.h>
+#include <unistd.h>
 #include <memory>
 #include <mutex>
 #include <sstream>
+#include <type_traits>
 #include "celma/common/no_lock.hpp"
+#include "celma/log/detail/emergency_flush.hpp"
 #include "celma/log/detail/format_stream_default.hpp"
 #include "celma/log/detail/i_format_base.hpp"
 #include "celma/log/detail/i_log_dest.hpp"
 #include "celma/log/detail/log_msg.hpp"
+#include "celma/log/files/flat_combining_lock.hpp"
 
 
 namespace celma::log::files {
@@ -39,7 +44,11 @@ namespace celma::log::files {
 /// roll the log file generations, if necessary.<br>
 /// The formatting for the log messages is defined through classes that
 /// implement the celma::log::detail::IFormatBase interface.<br>
-/// This class finally brings all this together.
+/// This class finally brings all this together.<br>
+/// When the emergency flush is enabled (see
+/// celma::log::Logging::enableEmergencyFlush()) and the process is terminated
+/// by a signal, the log messages that are not written yet (only possible with
+/// FlatCombiningLock) and a final marker line are appended to the log file.
 ///
 /// @tparam  P
 ///    The policy used to generate and handle the log files.
@@ -47,12 +56,18 @@ namespace celma::log::files {
 ///    The lock type to use when writing into the logfile.<br>
 ///    The default \a NoLock type provides no real locking. If multiple threads
 ///    write into the logfile, provide an appropriate locking mechanism (i.e.
-///    a mutex).
+///    a mutex).<br>
+///    With many threads writing into the same logfile, use
+///    celma::log::files::FlatCombiningLock to write the log messages of
+///    multiple threads in one batch instead of locking a mutex for each log
+///    message.
+/// @since  1.47.0, 18.10.2026
+///    (support for FlatCombiningLock and emergency flush)
 /// @since  1.15.1, 01.01.2018
 ///    (added lock policy for writing into the file)
 /// @since  1.0.0, 13.12.2017
 template< typename P, typename L = common::NoLock> class Handler final :
-   public detail::ILogDest
+   public detail::ILogDest, private detail::IEmergencyFlush
 {
 public:
    /// Constructor. Tries to open the current log file according to the given
@@ -65,7 +80,12 @@ public:
    explicit Handler( P* file_policy);
 
    Handler( const Handler&) = delete;
-   ~Handler() override = default;
+
+   /// Destructor, unregisters from the emergency flush handling.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   ~Handler() override;
+
    Handler& operator =( const Handler&) = delete;
 
    /// Sets the new formatter to use.<br>
@@ -79,6 +99,12 @@ public:
    /// @since  1.0.0, 14.12.2017
    void setFormatter( detail::IFormatBase* formatter = nullptr) override;
 
+   /// Returns the lock object, e.g. to query statistics.
+   ///
+   /// @return  The lock object used by this handler.
+   /// @since  1.47.0, 18.10.2026
+   const L& lockObject() const;
+
 private:
    /// Implementation of the ILogDest interface: Formats the given log message
    /// and writes the log message text into the log file.
@@ -87,6 +113,13 @@ private:
    /// @since  1.0.0, 13.12.2017
    void message( const detail::LogMsg& msg) override;
 
+   /// Implementation of the IEmergencyFlush interface: Appends the pending log
+   /// messages and the marker line to the current log file.
+   ///
+   /// @param[in]  sig_nbr  The number of the signal that was caught.
+   /// @since  1.47.0, 18.10.2026
+   void emergencyFlush( int sig_nbr) noexcept override;
+
    /// The policy object to handle the log file(s).
    std::unique_ptr< P>  mpFilePolicy;
    /// The object used for formatting stream output.
@@ -107,9 +140,16 @@ template< typename P, typename L> Handler< P, L>::Handler( P* file_policy):
    mLockType()
 {
    mpFilePolicy->open();
+   detail::registerEmergencyFlush( this);
 } // Handler< P, L>::Handler
 
 
+template< typename P, typename L> Handler< P, L>::~Handler()
+{
+   detail::unregisterEmergencyFlush( this);
+} // Handler< P, L>::~Handler
+
+
 template< typename P, typename L>
    void Handler< P, L>::setFormatter( detail::IFormatBase* formatter)
 {
@@ -119,6 +159,13 @@ template< typename P, typename L>
 } // Handler< P, L>::setFormatter
 
 
+template< typename P, typename L>
+   const L& Handler< P, L>::lockObject() const
+{
+   return mLockType;
+} // Handler< P, L>::lockObject
+
+
 template< typename P, typename L>
    void Handler< P, L>::message( const detail::LogMsg& msg)
 {
@@ -126,11 +173,48 @@ template< typename P, typename L>
 
    mpFormatter->formatMsg( msg_text, msg);
 
-   const std::lock_guard< L>  lock( mLockType);
-   mpFilePolicy->writeMessage( msg, msg_text.str());
+   if constexpr (std::is_same_v< L, FlatCombiningLock>)
+   {
+      mLockType.write( msg, msg_text.str(),
+         [this]( const detail::LogMsg& m, const std::string& text)
+         {
+            mpFilePolicy->appendMessage( m, text);
+         },
+         [this]()
+         {
+            mpFilePolicy->flush();
+         });
+   } else
+   {
+      const std::lock_guard< L>  lock( mLockType);
+      mpFilePolicy->writeMessage( msg, msg_text.str());
+   } // end if
 } // Handler< P, L>::message
 
 
+template< typename P, typename L>
+   void Handler< P, L>::emergencyFlush( int sig_nbr) noexcept
+{
+   const int  fd = ::open( mpFilePolicy->logFileName().c_str(),
+                           O_WRONLY | O_APPEND);
+
+   if (fd == -1)
+      return;
+
+   if constexpr (std::is_same_v< L, FlatCombiningLock>)
+   {
+      mLockType.visitPending( [fd]( const std::string& text)
+         {
+            detail::writeAll( fd, text.data(), text.length());
+            detail::writeAll( fd, "\n", 1);
+         });
+   } // end if
+
+   detail::writeSignalMarker( fd, sig_nbr);
+   ::close( fd);
+} // Handler< P, L>::emergencyFlush
+
+
 } // namespace celma::log::files
 
 
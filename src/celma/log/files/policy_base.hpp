@@ -102,6 +102,25 @@ public:
    /// @since  1.0.0, 13.12.2017
    void writeMessage( const detail::LogMsg& msg, const std::string& msg_text);
 
+   /// Same as writeMessage(), but does not flush the log file.<br>
+   /// Used to write a batch of log messages: The checks are still done for
+   /// each log message, but the file is flushed only once by calling flush()
+   /// after the last log message of the batch.
+   ///
+   /// @param[in]  msg
+   ///    The log message object with the data of the log message to write
+   ///    into the file.
+   /// @param[in]  msg_text
+   ///    The formatted text of the log message to write.
+   /// @since  1.47.0, 18.10.2026
+   void appendMessage( const detail::LogMsg& msg, const std::string& msg_text);
+
+   /// Flushes the log file, i.e. writes the log messages that were written
+   /// with appendMessage() into the file.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void flush();
+
    /// Returns the path and file name of the currently open log file.
    ///
    /// @return  The path and file name of the currently open log file.
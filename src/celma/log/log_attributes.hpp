@@ -83,6 +83,17 @@ public:
    /// @since  1.15.0, 16.10.2018
    std::string getAttribute( const std::string& attr_name) const;
 
+   /// Calls the given function for each attribute in this object, starting
+   /// with the attribute that was added last, and then for the attributes of
+   /// the parent/master log attributes object(s).
+   ///
+   /// @tparam  F
+   ///    The type of the function to call.
+   /// @param[in]  fun
+   ///    The function to call with the name and the value of each attribute.
+   /// @since  1.47.0, 18.10.2026
+   template< typename F> void visitAttributes( F&& fun) const;
+
 private:
    /// Pointer to the optional parent/master log attributes object.
    const LogAttributes* const  mpOuter = nullptr;
@@ -90,6 +101,18 @@ private:
 }; // LogAttributes
 
 
+// inlined methods
+// ===============
+
+
+template< typename F> void LogAttributes::visitAttributes( F&& fun) const
+{
+   detail::LogAttributesContainer::visitAttributes( fun);
+   if (mpOuter != nullptr)
+      mpOuter->visitAttributes( fun);
+} // LogAttributes::visitAttributes
+
+
 } // namespace log
 } // namespace celma
 
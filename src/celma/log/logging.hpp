@@ -18,6 +18,8 @@
 #pragma once
 
 
+#include <csignal>
+#include <initializer_list>
 #include <iosfwd>
 #include <vector>
 #include "celma/common/singleton.hpp"
@@ -160,6 +162,51 @@ public:
    /// @since  1.15.0, 11.10.2018
    void removeAttribute( const std::string& attr_name);
 
+   /// Calls the given function for each global attribute, starting with the
+   /// attribute that was added last.
+   ///
+   /// @tparam  F
+   ///    The type of the function to call.
+   /// @param[in]  fun
+   ///    The function to call with the name and the value of each attribute.
+   /// @since  1.47.0, 18.10.2026
+   template< typename F> void visitAttributes( F&& fun) const;
+
+   /// Enables the emergency flush: Installs a signal handler for the given
+   /// signals that writes the pending log messages of all log destinations
+   /// that buffer log messages, followed by a marker line with the number of
+   /// the signal.<br>
+   /// Afterwards, the signal is raised again with the default handling, i.e.
+   /// the process terminates (and creates a core dump) as it would without
+   /// the handler.<br>
+   /// The signal handler only uses async-signal-safe functions. If multiple
+   /// threads crash at the same time, only the first writes the pending log
+   /// messages, the other threads wait until it terminated the process.<br>
+   /// The handler runs on an alternate signal stack, which is set up only for
+   /// the calling thread. Call installEmergencyStack() in every other thread
+   /// that should be able to write the pending log messages after a stack
+   /// overflow, otherwise a stack overflow in such a thread terminates the
+   /// process without the emergency flush.
+   ///
+   /// @param[in]  signals  The signals to install the handler for.
+   /// @since  1.47.0, 18.10.2026
+   void enableEmergencyFlush( std::initializer_list< int> signals =
+      { SIGSEGV, SIGABRT, SIGBUS, SIGFPE, SIGILL });
+
+   /// Sets up the alternate signal stack, on which the emergency flush handler
+   /// runs, for the calling thread. See enableEmergencyFlush().<br>
+   /// The stack is freed when the thread ends.
+   ///
+   /// @return  \c true if the alternate signal stack could be set up.
+   /// @since  1.47.0, 18.10.2026
+   bool installEmergencyStack();
+
+   /// Disables the emergency flush again, i.e. restores the previous handling
+   /// of the signals.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void disableEmergencyFlush();
+
    /// Dumps information about the logging framework.
    ///
    /// @param[in]  os
@@ -200,6 +247,12 @@ inline std::string Logging::getAttribute( const std::string& attr_name) const
 } // Logging::getAtribute
 
 
+template< typename F> void Logging::visitAttributes( F&& fun) const
+{
+   mAttributes.visitAttributes( fun);
+} // Logging::visitAttributes
+
+
 } // namespace celma::log
 
 
@@ -0,0 +1,393 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Replaces the global operators new and delete in a test program to count
+**    the allocations of each thread.
+**
+--*/
+
+
+/// @file
+/// See documentation of class celma::test::AllocationScope and the macros
+/// CHECK_NO_ALLOCATIONS, REQUIRE_NO_ALLOCATIONS and CHECK_ALLOCATIONS.<br>
+/// This file defines the replacements of the global operators new and delete,
+/// so it must be included in exactly one source file of a test program.<br>
+/// Like check_return.hpp, this file does not include the Boost.Test include
+/// files: Define the test module, include the Boost.Test include file(s), and
+/// then include this file.
+
+
+#ifndef CELMA_TEST_ALLOCATION_COUNTER_HPP
+#define CELMA_TEST_ALLOCATION_COUNTER_HPP
+
+
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+
+namespace celma { namespace test {
+
+
+/// Allocation statistics of a thread.
+///
+/// @since  1.47.0, 18.10.2026
+struct AllocationCounts
+{
+   /// Number of calls of an operator new.
+   uint64_t  mAllocations;
+   /// Number of calls of an operator delete with a non-null pointer.
+   uint64_t  mDeallocations;
+   /// Number of bytes requested by the operator new calls.
+   uint64_t  mBytes;
+};
+
+
+namespace detail {
+
+
+/// The allocation statistics of the current thread. Constant initialised, so
+/// it can be used by operator new before any dynamic initialisation.
+inline thread_local AllocationCounts  threadAllocationCounts{ 0, 0, 0 };
+
+
+/// Counts an allocation and returns the memory.
+///
+/// @param[in]  size       Number of bytes to allocate.
+/// @param[in]  alignment  The alignment of the memory, 0 for the default
+///                        alignment.
+/// @return  Pointer to the memory, NULL if the allocation failed.
+/// @since  1.47.0, 18.10.2026
+inline void* countedAlloc( std::size_t size, std::size_t alignment) noexcept
+{
+
+   auto&  counts = threadAllocationCounts;
+   void*  ptr = nullptr;
+
+
+   ++counts.mAllocations;
+   counts.mBytes += size;
+
+   if (size == 0)
+      size = 1;
+
+   if (alignment <= alignof( std::max_align_t))
+   {
+      ptr = std::malloc( size);
+   } else if (::posix_memalign( &ptr, alignment, size) != 0)
+   {
+      ptr = nullptr;
+   } // end if
+
+   return ptr;
+} // countedAlloc
+
+
+/// Counts an allocation and returns the memory, throws if the allocation
+/// failed.
+///
+/// @param[in]  size       Number of bytes to allocate.
+/// @param[in]  alignment  The alignment of the memory, 0 for the default
+///                        alignment.
+/// @return  Pointer to the memory.
+/// @throw  std::bad_alloc if the allocation failed.
+/// @since  1.47.0, 18.10.2026
+inline void* countedAllocThrow( std::size_t size, std::size_t alignment)
+{
+
+   void*  ptr = countedAlloc( size, alignment);
+
+
+   if (ptr == nullptr)
+      throw std::bad_alloc();
+
+   return ptr;
+} // countedAllocThrow
+
+
+/// Counts a deallocation and frees the memory.
+///
+/// @param[in]  ptr  Pointer to the memory to free, may be NULL.
+/// @since  1.47.0, 18.10.2026
+inline void countedFree( void* ptr) noexcept
+{
+
+   if (ptr == nullptr)
+      return;
+
+   ++threadAllocationCounts.mDeallocations;
+   std::free( ptr);
+
+} // countedFree
+
+
+} // namespace detail
+
+
+/// Returns the allocation statistics of the current thread since it was
+/// started.
+///
+/// @return  The allocation statistics of the calling thread.
+/// @since  1.47.0, 18.10.2026
+inline AllocationCounts threadAllocations() noexcept
+{
+   return detail::threadAllocationCounts;
+} // threadAllocations
+
+
+/// Counts the allocations of the current thread while the object exists, or
+/// until stop() is called.<br>
+/// Allocations of other threads are not counted.
+///
+/// @since  1.47.0, 18.10.2026
+class AllocationScope
+{
+public:
+   /// Constructor, starts counting.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   AllocationScope() noexcept:
+      mStart( threadAllocations()),
+      mEnd{ 0, 0, 0 }
+   {
+   } // AllocationScope::AllocationScope
+
+   AllocationScope( const AllocationScope&) = delete;
+   AllocationScope& operator =( const AllocationScope&) = delete;
+
+   /// Stops counting. Afterwards, the methods return the values of the
+   /// block between construction and this call.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void stop() noexcept
+   {
+      mEnd = threadAllocations();
+      mStopped = true;
+   } // AllocationScope::stop
+
+   /// Returns the number of allocations made so far in the scope.
+   ///
+   /// @return  Number of calls of an operator new.
+   /// @since  1.47.0, 18.10.2026
+   uint64_t allocations() const noexcept
+   {
+      return current().mAllocations - mStart.mAllocations;
+   } // AllocationScope::allocations
+
+   /// Returns the number of deallocations made so far in the scope.
+   ///
+   /// @return  Number of calls of an operator delete.
+   /// @since  1.47.0, 18.10.2026
+   uint64_t deallocations() const noexcept
+   {
+      return current().mDeallocations - mStart.mDeallocations;
+   } // AllocationScope::deallocations
+
+   /// Returns the number of bytes allocated so far in the scope.
+   ///
+   /// @return  Number of bytes requested.
+   /// @since  1.47.0, 18.10.2026
+   uint64_t bytes() const noexcept
+   {
+      return current().mBytes - mStart.mBytes;
+   } // AllocationScope::bytes
+
+private:
+   /// Returns the current counts, or the counts when stop() was called.
+   ///
+   /// @return  The counts to compute the differences with.
+   /// @since  1.47.0, 18.10.2026
+   AllocationCounts current() const noexcept
+   {
+      return mStopped ? mEnd : threadAllocations();
+   } // AllocationScope::current
+
+   /// The counts when the scope was started.
+   const AllocationCounts  mStart;
+   /// The counts when stop() was called.
+   AllocationCounts        mEnd;
+   /// Set by stop().
+   bool                    mStopped = false;
+
+}; // AllocationScope
+
+
+} // namespace test
+} // namespace celma
+
+
+// replacements of the global operators new and delete
+// ===================================================
+
+
+void* operator new( std::size_t size)
+{
+   return celma::test::detail::countedAllocThrow( size, 0);
+}
+
+void* operator new[]( std::size_t size)
+{
+   return celma::test::detail::countedAllocThrow( size, 0);
+}
+
+void* operator new( std::size_t size, const std::nothrow_t&) noexcept
+{
+   return celma::test::detail::countedAlloc( size, 0);
+}
+
+void* operator new[]( std::size_t size, const std::nothrow_t&) noexcept
+{
+   return celma::test::detail::countedAlloc( size, 0);
+}
+
+void* operator new( std::size_t size, std::align_val_t al)
+{
+   return celma::test::detail::countedAllocThrow( size,
+      static_cast< std::size_t>( al));
+}
+
+void* operator new[]( std::size_t size, std::align_val_t al)
+{
+   return celma::test::detail::countedAllocThrow( size,
+      static_cast< std::size_t>( al));
+}
+
+void* operator new( std::size_t size, std::align_val_t al,
+                    const std::nothrow_t&) noexcept
+{
+   return celma::test::detail::countedAlloc( size,
+      static_cast< std::size_t>( al));
+}
+
+void* operator new[]( std::size_t size, std::align_val_t al,
+                      const std::nothrow_t&) noexcept
+{
+   return celma::test::detail::countedAlloc( size,
+      static_cast< std::size_t>( al));
+}
+
+void operator delete( void* ptr) noexcept
+{
+   celma::test::detail::countedFree( ptr);
+}
+
+void operator delete[]( void* ptr) noexcept
+{
+   celma::test::detail::countedFree( ptr);
+}
+
+void operator delete( void* ptr, std::size_t) noexcept
+{
+   celma::test::detail::countedFree( ptr);
+}
+
+void operator delete[]( void* ptr, std::size_t) noexcept
+{
+   celma::test::detail::countedFree( ptr);
+}
+
+void operator delete( void* ptr, const std::nothrow_t&) noexcept
+{
+   celma::test::detail::countedFree( ptr);
+}
+
+void operator delete[]( void* ptr, const std::nothrow_t&) noexcept
+{
+   celma::test::detail::countedFree( ptr);
+}
+
+void operator delete( void* ptr, std::align_val_t) noexcept
+{
+   celma::test::detail::countedFree( ptr);
+}
+
+void operator delete[]( void* ptr, std::align_val_t) noexcept
+{
+   celma::test::detail::countedFree( ptr);
+}
+
+void operator delete( void* ptr, std::size_t, std::align_val_t) noexcept
+{
+   celma::test::detail::countedFree( ptr);
+}
+
+void operator delete[]( void* ptr, std::size_t, std::align_val_t) noexcept
+{
+   celma::test::detail::countedFree( ptr);
+}
+
+void operator delete( void* ptr, std::align_val_t,
+                      const std::nothrow_t&) noexcept
+{
+   celma::test::detail::countedFree( ptr);
+}
+
+void operator delete[]( void* ptr, std::align_val_t,
+                        const std::nothrow_t&) noexcept
+{
+   celma::test::detail::countedFree( ptr);
+}
+
+
+/// Executes the statements passed as parameter and checks that the current
+/// thread made no allocation meanwhile. The test continues if the check
+/// fails.<br>
+/// Usage:
+/// @code
+///   CHECK_NO_ALLOCATIONS( bitset.set( 5); bitset.flip());
+/// @endcode
+///
+/// @param  ...  The statements to execute.
+/// @since  1.47.0, 18.10.2026
+#define  CHECK_NO_ALLOCATIONS( ...) \
+   CHECK_ALLOCATIONS_IMPL( BOOST_CHECK_MESSAGE, 0, __VA_ARGS__)
+
+
+/// Like CHECK_NO_ALLOCATIONS, but aborts the test case if the check fails.
+///
+/// @param  ...  The statements to execute.
+/// @since  1.47.0, 18.10.2026
+#define  REQUIRE_NO_ALLOCATIONS( ...) \
+   CHECK_ALLOCATIONS_IMPL( BOOST_REQUIRE_MESSAGE, 0, __VA_ARGS__)
+
+
+/// Executes the statements passed as parameter and checks that the current
+/// thread made exactly the given number of allocations meanwhile.
+///
+/// @param  n    The expected number of allocations.
+/// @param  ...  The statements to execute.
+/// @since  1.47.0, 18.10.2026
+#define  CHECK_ALLOCATIONS( n, ...) \
+   CHECK_ALLOCATIONS_IMPL( BOOST_CHECK_MESSAGE, n, __VA_ARGS__)
+
+
+/// Implementation of the allocation check macros.
+///
+/// @param  c    The Boost.Test macro to use for the check.
+/// @param  n    The expected number of allocations.
+/// @param  ...  The statements to execute.
+/// @since  1.47.0, 18.10.2026
+#define  CHECK_ALLOCATIONS_IMPL( c, n, ...) \
+   { \
+      celma::test::AllocationScope  allocScope; \
+      __VA_ARGS__; \
+      allocScope.stop(); \
+      c( allocScope.allocations() == static_cast< uint64_t>( n), \
+         "expected " << (n) << " allocations, got " \
+         << allocScope.allocations() << " (" << allocScope.bytes() \
+         << " bytes)"); \
+   }
+
+
+#endif   // CELMA_TEST_ALLOCATION_COUNTER_HPP
+
+
+// =====  END OF allocation_counter.hpp  =====
@@ -0,0 +1,390 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of classes celma::test::BenchmarkRegistry and
+/// celma::test::BenchmarkRunner, and of the macro BENCHMARK.<br>
+/// A benchmark is a function that is registered with the macro BENCHMARK.
+/// The benchmark program (target \c celma-benchmarks) is linked with the
+/// library \c celma-bench-main, which provides the main function that runs
+/// the registered benchmarks:
+/// @code
+///   BENCHMARK( format, int2string)
+///   {
+///      char  buffer[ 32];
+///      celma::test::doNotOptimize( celma::format::int2string( buffer, 4711));
+///   }
+/// @endcode
+/// For each benchmark, the runner
+/// - runs the function for the warm-up time,
+/// - determines the number of iterations that take about the sample time,
+/// - measures the given number of samples,
+/// - and computes the median, mean, standard deviation and the confidence
+///   interval of the median of the time per iteration.
+///
+/// Optionally, the hardware performance counters are measured during the
+/// samples, to print the instructions per cycle and the cache miss rate of
+/// each benchmark.<br>
+/// The results can be printed as table, CSV or JSON. The CSV output can be
+/// stored as baseline and later be compared with a new run.
+
+
+#ifndef CELMA_TEST_BENCHMARK_HPP
+#define CELMA_TEST_BENCHMARK_HPP
+
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace celma { namespace test {
+
+
+/// Prevents that the compiler optimises away the computation of a value.
+///
+/// @tparam  T  The type of the value.
+/// @param[in]  value  The value that must be computed.
+/// @since  1.47.0, 18.10.2026
+template< typename T> inline void doNotOptimize( const T& value)
+{
+   asm volatile( "" : : "r,m" (value) : "memory");
+} // doNotOptimize
+
+
+/// Prevents that the compiler optimises away the computation of a value, or
+/// that it assumes that the value is not modified.
+///
+/// @tparam  T  The type of the value.
+/// @param[in]  value  The value that must be computed.
+/// @since  1.47.0, 18.10.2026
+template< typename T> inline void doNotOptimize( T& value)
+{
+   asm volatile( "" : "+r,m" (value) : : "memory");
+} // doNotOptimize
+
+
+/// Forces the compiler to write all pending values to memory, and to read
+/// them again afterwards.
+///
+/// @since  1.47.0, 18.10.2026
+inline void clobberMemory()
+{
+   asm volatile( "" : : : "memory");
+} // clobberMemory
+
+
+/// A registered benchmark.
+///
+/// @since  1.47.0, 18.10.2026
+struct Benchmark
+{
+   /// Type of the function that runs the benchmark code the given number of
+   /// times.
+   using function_t = std::function< void( uint64_t)>;
+
+   /// The name of the benchmark, "group/name".
+   std::string  mName;
+   /// The function to call.
+   function_t   mFunction;
+
+}; // Benchmark
+
+
+/// Stores all benchmarks registered in a program.
+///
+/// @since  1.47.0, 18.10.2026
+class BenchmarkRegistry
+{
+public:
+   /// Returns the registry.
+   ///
+   /// @return  The one and only registry object.
+   /// @since  1.47.0, 18.10.2026
+   static BenchmarkRegistry& instance();
+
+   /// Adds a benchmark.
+   ///
+   /// @param[in]  name  The name of the benchmark.
+   /// @param[in]  fun   The function that runs the benchmark code the given
+   ///                   number of times.
+   /// @throw  std::invalid_argument if the name is empty or already used.
+   /// @since  1.47.0, 18.10.2026
+   void add( const std::string& name, Benchmark::function_t fun)
+      noexcept( false);
+
+   /// Returns the registered benchmarks, sorted by name.
+   ///
+   /// @return  The benchmarks.
+   /// @since  1.47.0, 18.10.2026
+   std::vector< Benchmark> benchmarks() const;
+
+private:
+   BenchmarkRegistry() = default;
+
+   /// The benchmarks in the order of registration.
+   std::vector< Benchmark>  mBenchmarks;
+
+}; // BenchmarkRegistry
+
+
+/// Helper class to register a benchmark during static initialisation.
+///
+/// @since  1.47.0, 18.10.2026
+class BenchmarkRegistrar
+{
+public:
+   /// Constructor, adds the benchmark to the registry.
+   ///
+   /// @param[in]  name  The name of the benchmark.
+   /// @param[in]  fun   The function that runs the benchmark code the given
+   ///                   number of times.
+   /// @since  1.47.0, 18.10.2026
+   BenchmarkRegistrar( const std::string& name, Benchmark::function_t fun)
+   {
+      BenchmarkRegistry::instance().add( name, std::move( fun));
+   } // BenchmarkRegistrar::BenchmarkRegistrar
+
+}; // BenchmarkRegistrar
+
+
+/// Statistics computed from the samples of a benchmark. All values are in
+/// nanoseconds per iteration.
+///
+/// @since  1.47.0, 18.10.2026
+struct BenchmarkStatistics
+{
+   /// Number of samples.
+   size_t  mNumSamples = 0;
+   /// The median.
+   double  mMedian = 0.0;
+   /// The arithmetic mean.
+   double  mMean = 0.0;
+   /// The standard deviation.
+   double  mStdDev = 0.0;
+   /// The smallest sample.
+   double  mMin = 0.0;
+   /// The largest sample.
+   double  mMax = 0.0;
+   /// Lower bound of the 95 % confidence interval of the median.
+   double  mCiLow = 0.0;
+   /// Upper bound of the 95 % confidence interval of the median.
+   double  mCiHigh = 0.0;
+
+}; // BenchmarkStatistics
+
+
+/// Computes the statistics of the samples.<br>
+/// The confidence interval of the median is determined from the order
+/// statistics, i.e. without assuming a normal distribution of the samples.
+/// With less than 6 samples, it is the range of the samples.
+///
+/// @param[in]  samples  The samples, in nanoseconds per iteration.
+/// @return  The statistics, all 0 if \a samples is empty.
+/// @since  1.47.0, 18.10.2026
+BenchmarkStatistics computeStatistics( std::vector< double> samples);
+
+
+/// The result of a benchmark.
+///
+/// @since  1.47.0, 18.10.2026
+struct BenchmarkResult
+{
+   /// The name of the benchmark.
+   std::string          mName;
+   /// Number of iterations per sample.
+   uint64_t             mIterations = 0;
+   /// The statistics of the samples.
+   BenchmarkStatistics  mStatistics;
+   /// Set when the performance counters were measured during the samples.
+   bool                 mPerfMeasured = false;
+   /// Instructions per cycle, negative if not available.
+   double               mIpc = -1.0;
+   /// Percentage of last level cache accesses that missed, negative if not
+   /// available.
+   double               mCacheMissRate = -1.0;
+
+}; // BenchmarkResult
+
+
+/// Options that control how the benchmarks are run.
+///
+/// @since  1.47.0, 18.10.2026
+struct BenchmarkOptions
+{
+   /// How long to run a benchmark before measuring.
+   std::chrono::nanoseconds  mWarmUpTime = std::chrono::milliseconds( 100);
+   /// The target time of one sample, used to determine the number of
+   /// iterations per sample.
+   std::chrono::nanoseconds  mSampleTime = std::chrono::milliseconds( 10);
+   /// Number of samples to measure.
+   size_t                    mNumSamples = 20;
+   /// Set to measure the hardware performance counters during the samples,
+   /// see celma::common::PerfCounters.
+   bool                      mPerfCounters = false;
+
+}; // BenchmarkOptions
+
+
+/// Runs benchmarks.
+///
+/// @since  1.47.0, 18.10.2026
+class BenchmarkRunner
+{
+public:
+   /// Constructor.
+   ///
+   /// @param[in]  options  The options to use.
+   /// @throw  std::invalid_argument if the number of samples or the sample
+   ///         time is 0.
+   /// @since  1.47.0, 18.10.2026
+   explicit BenchmarkRunner( const BenchmarkOptions& options) noexcept( false);
+
+   /// Determines the number of iterations that take about the sample time.
+   ///
+   /// @param[in]  bench  The benchmark to determine the iterations of.
+   /// @return  The number of iterations per sample, at least 1.
+   /// @since  1.47.0, 18.10.2026
+   uint64_t calibrate( const Benchmark& bench) const;
+
+   /// Runs a benchmark: Warm-up, calibration and the samples. If requested,
+   /// the performance counters are measured over all samples.
+   ///
+   /// @param[in]  bench  The benchmark to run.
+   /// @return  The result of the benchmark.
+   /// @since  1.47.0, 18.10.2026
+   BenchmarkResult run( const Benchmark& bench) const;
+
+private:
+   /// The options.
+   const BenchmarkOptions  mOptions;
+
+}; // BenchmarkRunner
+
+
+/// Prints the results as table. The columns with the IPC and the cache miss
+/// rate are only printed when the performance counters were measured.
+///
+/// @param[in]  os       The stream to print into.
+/// @param[in]  results  The results to print.
+/// @since  1.47.0, 18.10.2026
+void printTable( std::ostream& os, const std::vector< BenchmarkResult>& results);
+
+/// Writes the results in CSV format, with a header line. This format is also
+/// used for the baseline files.<br>
+/// The fields with the IPC and the cache miss rate are empty when the values
+/// are not available.
+///
+/// @param[in]  os       The stream to write into.
+/// @param[in]  results  The results to write.
+/// @since  1.47.0, 18.10.2026
+void writeCsv( std::ostream& os, const std::vector< BenchmarkResult>& results);
+
+/// Writes the results in JSON format. The IPC and the cache miss rate are
+/// \c null when the values are not available.
+///
+/// @param[in]  os       The stream to write into.
+/// @param[in]  results  The results to write.
+/// @since  1.47.0, 18.10.2026
+void writeJson( std::ostream& os, const std::vector< BenchmarkResult>& results);
+
+
+/// The comparison of a benchmark result with the baseline.
+///
+/// @since  1.47.0, 18.10.2026
+struct BenchmarkComparison
+{
+   /// The name of the benchmark.
+   std::string  mName;
+   /// The median of the baseline, in nanoseconds per iteration.
+   double       mBaseline = 0.0;
+   /// The median of the current result, in nanoseconds per iteration.
+   double       mCurrent = 0.0;
+   /// The change in percent, positive values mean slower.
+   double       mChange = 0.0;
+   /// Set if the benchmark got slower by more than the threshold, also when
+   /// taking the confidence interval into account.
+   bool         mRegression = false;
+
+}; // BenchmarkComparison
+
+
+/// Compares results with a baseline file, which was written by writeCsv().
+/// Benchmarks that are not contained in the baseline are ignored.<br>
+/// A benchmark is flagged as regression when the lower bound of the
+/// confidence interval of the median is larger than the median of the
+/// baseline plus the threshold.
+///
+/// @param[in]  results    The current results.
+/// @param[in]  fname      The (path and) name of the baseline file.
+/// @param[in]  threshold  The tolerated slowdown, in percent.
+/// @return  The comparisons, in the order of the results.
+/// @throw  std::runtime_error if the baseline file cannot be read.
+/// @since  1.47.0, 18.10.2026
+std::vector< BenchmarkComparison>
+   compareBaseline( const std::vector< BenchmarkResult>& results,
+                    const std::string& fname, double threshold)
+      noexcept( false);
+
+/// Prints the comparisons with the baseline as table.
+///
+/// @param[in]  os           The stream to print into.
+/// @param[in]  comparisons  The comparisons to print.
+/// @since  1.47.0, 18.10.2026
+void printComparison( std::ostream& os,
+                      const std::vector< BenchmarkComparison>& comparisons);
+
+
+/// Main function of a benchmark program: Evaluates the program arguments,
+/// runs the selected benchmarks and prints the results. Called by the main
+/// function in the library \c celma-bench-main.
+///
+/// @param[in]  argc  Number of arguments passed to the program.
+/// @param[in]  argv  List of argument strings.
+/// @return  EXIT_SUCCESS if all benchmarks were run and no regression was
+///          found, EXIT_FAILURE otherwise.
+/// @since  1.47.0, 18.10.2026
+int benchmarkMain( int argc, char* argv[]);
+
+
+} // namespace test
+} // namespace celma
+
+
+/// Defines a benchmark function and registers it.<br>
+/// The body of the function follows the macro, it contains the code for one
+/// iteration.
+///
+/// @param  group  The group of the benchmark, e.g. the module name.
+/// @param  name   The name of the benchmark.
+/// @since  1.47.0, 18.10.2026
+#define  BENCHMARK( group, name) \
+   static void benchmark_ ## group ## _ ## name(); \
+   static const celma::test::BenchmarkRegistrar \
+      benchmark_registrar_ ## group ## _ ## name( #group "/" #name, \
+         []( uint64_t num_iterations) \
+         { \
+            for (uint64_t i = 0; i < num_iterations; ++i) \
+               benchmark_ ## group ## _ ## name(); \
+         }); \
+   static void benchmark_ ## group ## _ ## name()
+
+
+#endif   // CELMA_TEST_BENCHMARK_HPP
+
+
+// =====  END OF benchmark.hpp  =====
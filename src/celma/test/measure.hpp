@@ -12,7 +12,10 @@
 
 
 /// @file
-/// See documentation of template function celma::test::measure.
+/// See documentation of template functions celma::test::measure,
+/// celma::test::measureEach and celma::test::measurePerf.<br>
+/// These functions measure a single run. For benchmarks with warm-up,
+/// repeated samples and statistics, see benchmark.hpp.
 
 
 #ifndef CELMA_TEST_MEASURE_HPP
@@ -20,47 +23,138 @@
 
 
 #include <sched.h>
+#include <chrono>
 #include <iostream>
 #include <iomanip>
-#include "celma/common/micro_timer.hpp"
+#include "celma/common/nano_timer.hpp"
+#include "celma/common/perf_counters.hpp"
 
 
 namespace celma { namespace test {
 
 
 /// Standard function for performance tests.
+/// @tparam  C  The clock to use for the time measurement,
+///             \c std::chrono::steady_clock or common::TscClock.
 /// @tparam  F  The type of the function to execute in the test loop.
 /// @param[in]  num_loops  Number of times to perform the test loop.
 /// @param[in]  func_name  The name of the function to display in the result
 ///                        output.
 /// @param[in]  fun        The function to execute.
-/// @return  The time measured for this function.
+/// @return  The time measured for this function in microseconds.
+/// @since  1.47.0, 18.10.2026
+///    (uses NanoTimer, prints the time per call in nanoseconds)
 /// @since  0.13.5, 28.02.2017
-template< typename F> uint64_t measure( uint64_t num_loops,
-                                        const char* func_name, F fun)
+template< typename C = std::chrono::steady_clock, typename F>
+   uint64_t measure( uint64_t num_loops, const char* func_name, F fun)
 {
 
-   common::MicroTimer  mt;
+   common::NanoTimer< C>  nt;
 
 
    ::sched_yield();
 
-   mt.start();
+   nt.start();
 
    for (uint64_t i = 0; i < num_loops; ++i)
    {
       fun();
    } // end for
 
-   mt.stop();
+   nt.stop();
 
-   std::cout << std::setw( 25) << std::left << func_name
-             << " = " << mt.timed() << " [us]" << std::endl;
+   const auto  nanos = nt.timed().count();
 
-   return mt.timed();
+   std::cout << std::setw( 25) << std::left << func_name
+             << " = " << nanos / 1000 << " [us]";
+   if (num_loops > 0)
+      std::cout << ", " << static_cast< double>( nanos)
+                           / static_cast< double>( num_loops)
+                << " [ns/call]";
+   std::cout << std::endl;
+
+   return static_cast< uint64_t>( nanos / 1000);
 } // measure
 
 
+/// Performance test that measures each call of the function separately and
+/// returns the statistics.<br>
+/// Use this for sub-microsecond operations together with common::TscClock,
+/// the overhead of reading \c steady_clock would otherwise dominate the
+/// result.
+/// @tparam  C  The clock to use for the time measurement.
+/// @tparam  F  The type of the function to execute in the test loop.
+/// @param[in]  num_loops  Number of times to call the function.
+/// @param[in]  func_name  The name of the function to display in the result
+///                        output.
+/// @param[in]  fun        The function to execute.
+/// @return  The statistics of the calls.
+/// @since  1.47.0, 18.10.2026
+template< typename C = std::chrono::steady_clock, typename F>
+   common::TimerStatistics measureEach( uint64_t num_loops,
+                                        const char* func_name, F fun)
+{
+
+   common::TimerStatistics  stats;
+
+
+   ::sched_yield();
+
+   for (uint64_t i = 0; i < num_loops; ++i)
+   {
+      common::ScopeTimer< C>  st( stats);
+      fun();
+   } // end for
+
+   std::cout << std::setw( 25) << std::left << func_name
+             << " = mean " << stats.mean() << ", stddev " << stats.stddev()
+             << ", min " << stats.min().count() << ", max "
+             << stats.max().count() << " [ns]" << std::endl;
+
+   return stats;
+} // measureEach
+
+
+/// Performance test that reads the hardware performance counters around the
+/// test loop and prints the time together with the IPC, cache miss rate etc.,
+/// which tells if the function is bound by memory or by computation.<br>
+/// Counters that are not available (e.g. in a virtual machine or when
+/// \c perf_event_paranoid forbids the access) are printed as "n/a".<br>
+/// Needs the Celma library.
+/// @tparam  F  The type of the function to execute in the test loop.
+/// @param[in]  num_loops  Number of times to perform the test loop.
+/// @param[in]  func_name  The name of the function to display in the result
+///                        output.
+/// @param[in]  fun        The function to execute.
+/// @return  The counter values (differences) of the test loop.
+/// @since  1.47.0, 18.10.2026
+template< typename F>
+   common::PerfCounterValues measurePerf( uint64_t num_loops,
+                                          const char* func_name, F fun)
+{
+
+   const common::PerfCounters  counters;
+   common::PerfCounterValues   result;
+
+
+   ::sched_yield();
+
+   {
+      const common::PerfScope  ps( counters, result);
+
+      for (uint64_t i = 0; i < num_loops; ++i)
+      {
+         fun();
+      } // end for
+   } // end scope
+
+   std::cout << std::setw( 25) << std::left << func_name
+             << " = " << result << std::endl;
+
+   return result;
+} // measurePerf
+
+
 } // namespace test
 } // namespace celma
 
@@ -79,6 +79,18 @@ public:
    /// @since  1.11.0, 27.08.2018
    void writeMessage( const detail::LogMsg& msg, const std::string& msg_text);
 
+   /// Same as writeMessage(), the stub does not buffer anything.
+   ///
+   /// @param[in]  msg       The log message object.
+   /// @param[in]  msg_text  The formatted text of the log message.
+   /// @since  1.47.0, 18.10.2026
+   void appendMessage( const detail::LogMsg& msg, const std::string& msg_text);
+
+   /// Nothing to flush in the stub.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   void flush();
+
    /// Returns the path and file name of the currently open log file.
    ///
    /// @return  The path and file name of the currently open log file.
@@ -283,6 +295,18 @@ inline void PolicyBaseStub::writeMessage( const detail::LogMsg& msg,
 } // PolicyBaseStub::writeMessage
 
 
+inline void PolicyBaseStub::appendMessage( const detail::LogMsg& msg,
+   const std::string& msg_text)
+{
+   writeMessage( msg, msg_text);
+} // PolicyBaseStub::appendMessage
+
+
+inline void PolicyBaseStub::flush()
+{
+} // PolicyBaseStub::flush
+
+
 inline void PolicyBaseStub::rollFiles()
 {
 } // PolicyBaseStub::rollFiles
@@ -0,0 +1,170 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of class celma::common::AdaptiveWait.
+
+
+// module headerfile include
+#include "celma/common/adaptive_wait.hpp"
+
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <climits>
+
+
+namespace celma::common {
+
+
+
+/// Constructor.
+///
+/// @param[in]  spin_time   How long to spin before yielding, converted into a
+///                         number of \c pause iterations.
+/// @param[in]  num_yields  How often to call \c sched_yield() before parking.
+/// @since  1.47.0, 18.10.2026
+AdaptiveWait::AdaptiveWait( std::chrono::nanoseconds spin_time,
+                            int num_yields):
+   mSpinIterations( static_cast< uint32_t>( std::max< int64_t>(
+      spin_time.count() * pausesPerMicrosecond() / 1000, 0))),
+   mNumYields( std::max( num_yields, 0))
+{
+} // AdaptiveWait::AdaptiveWait
+
+
+
+/// Wakes all parked threads. Must be called after the condition of the
+/// waiting threads was changed.
+///
+/// @since  1.47.0, 18.10.2026
+void AdaptiveWait::notifyAll() noexcept
+{
+
+   std::atomic_thread_fence( std::memory_order_seq_cst);
+
+   if (mNumParked.load( std::memory_order_seq_cst) > 0)
+   {
+      mEpoch.fetch_add( 1, std::memory_order_seq_cst);
+      detail::futexWake( mEpoch, INT_MAX);
+   } // end if
+
+} // AdaptiveWait::notifyAll
+
+
+
+/// Returns the statistics.
+///
+/// @return  The current statistics.
+/// @since  1.47.0, 18.10.2026
+WaitStatistics AdaptiveWait::statistics() const noexcept
+{
+
+   WaitStatistics  stats;
+
+
+   stats.mNumWaits = mNumWaits.load( std::memory_order_relaxed);
+   stats.mNumSpinDone = mSpinStat.mNumDone.load( std::memory_order_relaxed);
+   stats.mNumYieldDone = mYieldStat.mNumDone.load( std::memory_order_relaxed);
+   stats.mNumParkDone = mParkStat.mNumDone.load( std::memory_order_relaxed);
+   stats.mNumParks = mNumParks.load( std::memory_order_relaxed);
+   stats.mSpinTime = std::chrono::nanoseconds(
+      mSpinStat.mNanos.load( std::memory_order_relaxed));
+   stats.mYieldTime = std::chrono::nanoseconds(
+      mYieldStat.mNanos.load( std::memory_order_relaxed));
+   stats.mParkTime = std::chrono::nanoseconds(
+      mParkStat.mNanos.load( std::memory_order_relaxed));
+
+   return stats;
+} // AdaptiveWait::statistics
+
+
+
+/// Resets the statistics.
+///
+/// @since  1.47.0, 18.10.2026
+void AdaptiveWait::resetStatistics() noexcept
+{
+
+   mNumWaits.store( 0, std::memory_order_relaxed);
+   mNumParks.store( 0, std::memory_order_relaxed);
+
+   for (auto stat : { &mSpinStat, &mYieldStat, &mParkStat })
+   {
+      stat->mNumDone.store( 0, std::memory_order_relaxed);
+      stat->mNanos.store( 0, std::memory_order_relaxed);
+   } // end for
+
+} // AdaptiveWait::resetStatistics
+
+
+
+/// Returns how many \c pause instructions are executed per microsecond.
+/// Measured once, on the first call.
+///
+/// @return  The number of \c pause instructions per microsecond, at least 1.
+/// @since  1.47.0, 18.10.2026
+uint32_t AdaptiveWait::pausesPerMicrosecond() noexcept
+{
+
+   static const uint32_t  pauses_per_us = []()
+   {
+      constexpr int64_t  NumPauses = 10'000;
+      const auto         start = Clock::now();
+
+      for (int64_t i = 0; i < NumPauses; ++i)
+         detail::cpuRelax();
+
+      const auto  nanos = std::chrono::duration_cast< std::chrono::nanoseconds>(
+         Clock::now() - start).count();
+
+      return static_cast< uint32_t>( std::max< int64_t>(
+         NumPauses * 1000 / std::max< int64_t>( nanos, 1), 1));
+   }();
+
+
+   return pauses_per_us;
+} // AdaptiveWait::pausesPerMicrosecond
+
+
+
+/// Adds the time spent in a phase to its statistics.
+///
+/// @param[in]  stat         The statistics of the phase.
+/// @param[in]  phase_start  When the phase started.
+/// @param[in]  done         Set if the wait ended in this phase.
+/// @return  The current time, i.e. the start of the next phase.
+/// @since  1.47.0, 18.10.2026
+AdaptiveWait::Clock::time_point
+   AdaptiveWait::endPhase( PhaseStat& stat, Clock::time_point phase_start,
+                           bool done) noexcept
+{
+
+   const auto  now = Clock::now();
+
+
+   stat.mNanos.fetch_add( std::chrono::duration_cast< std::chrono::nanoseconds>(
+                             now - phase_start).count(),
+                          std::memory_order_relaxed);
+   if (done)
+      stat.mNumDone.fetch_add( 1, std::memory_order_relaxed);
+
+   return now;
+} // AdaptiveWait::endPhase
+
+
+
+} // namespace celma::common
+
+
+// =====  END OF adaptive_wait.cpp  =====
@@ -0,0 +1,153 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of function celma::common::crc32c().
+
+
+// module headerfile include
+#include "celma/common/crc32c.hpp"
+
+
+// C++ Standard Library includes
+#include <array>
+#include <cstring>
+
+
+#if defined( __x86_64__)
+#  include <nmmintrin.h>
+#endif
+
+
+namespace celma::common {
+
+
+namespace {
+
+
+/// The CRC32C polynomial, reversed.
+constexpr uint32_t  Polynomial = 0x82F63B78;
+
+
+/// Creates the lookup table for the table-driven implementation.
+///
+/// @return  The lookup table.
+/// @since  1.47.0, 18.10.2026
+constexpr std::array< uint32_t, 256> createTable()
+{
+
+   std::array< uint32_t, 256>  table{};
+
+   for (uint32_t i = 0; i < 256; ++i)
+   {
+      uint32_t  crc = i;
+      for (int bit = 0; bit < 8; ++bit)
+         crc = (crc & 1) ? (crc >> 1) ^ Polynomial : crc >> 1;
+      table[ i] = crc;
+   } // end for
+
+   return table;
+} // createTable
+
+
+/// The lookup table for the table-driven implementation.
+constexpr auto  crc_table = createTable();
+
+
+/// Table-driven computation of the checksum.
+///
+/// @param[in]  crc   The inverted checksum so far.
+/// @param[in]  data  Pointer to the data.
+/// @param[in]  len   The length of the data.
+/// @return  The inverted checksum including the data.
+/// @since  1.47.0, 18.10.2026
+uint32_t crc32cTable( uint32_t crc, const unsigned char* data, size_t len) noexcept
+{
+
+   while (len-- > 0)
+      crc = crc_table[ (crc ^ *data++) & 0xff] ^ (crc >> 8);
+
+   return crc;
+} // crc32cTable
+
+
+#if defined( __x86_64__)
+
+/// Computes the checksum with the SSE4.2 \c crc32 instruction, 8 bytes at a
+/// time.
+///
+/// @param[in]  crc   The inverted checksum so far.
+/// @param[in]  data  Pointer to the data.
+/// @param[in]  len   The length of the data.
+/// @return  The inverted checksum including the data.
+/// @since  1.47.0, 18.10.2026
+__attribute__(( target( "sse4.2")))
+   uint32_t crc32cHardware( uint32_t crc, const unsigned char* data,
+                            size_t len) noexcept
+{
+
+   uint64_t  crc64 = crc;
+
+   while (len >= sizeof( uint64_t))
+   {
+      uint64_t  value;
+      ::memcpy( &value, data, sizeof( value));
+      crc64 = _mm_crc32_u64( crc64, value);
+      data += sizeof( value);
+      len  -= sizeof( value);
+   } // end while
+
+   crc = static_cast< uint32_t>( crc64);
+   while (len-- > 0)
+      crc = _mm_crc32_u8( crc, *data++);
+
+   return crc;
+} // crc32cHardware
+
+#endif
+
+
+} // namespace
+
+
+
+/// Computes the CRC32C (Castagnoli) checksum of a data block.
+///
+/// @param[in]  data  Pointer to the data.
+/// @param[in]  len   The length of the data.
+/// @param[in]  crc   The checksum of the preceding data, 0 to start.
+/// @return  The checksum of the data.
+/// @since  1.47.0, 18.10.2026
+uint32_t crc32c( const void* data, size_t len, uint32_t crc) noexcept
+{
+
+   auto  bytes = static_cast< const unsigned char*>( data);
+
+
+#if defined( __x86_64__)
+   static const bool  has_sse42 = __builtin_cpu_supports( "sse4.2");
+
+   if (has_sse42)
+      return ~crc32cHardware( ~crc, bytes, len);
+#endif
+
+   return ~crc32cTable( ~crc, bytes, len);
+} // crc32c
+
+
+
+} // namespace celma::common
+
+
+// =====  END OF crc32c.cpp  =====
+
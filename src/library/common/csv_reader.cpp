@@ -0,0 +1,576 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of classes celma::common::CsvReader,
+/// celma::common::CsvTable and celma::common::CsvStringColumn.
+
+
+// module headerfile include
+#include "celma/common/csv_reader.hpp"
+
+
+// C++ Standard Library includes
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+
+// project includes
+#include "celma/common/string_view_tokenizer.hpp"
+#include "celma/common/text_file.hpp"
+#include "celma/format/string_to.hpp"
+
+
+namespace celma::common {
+
+
+namespace {
+
+
+/// Result of one chunk when a file is read in parallel.<br>
+/// The first line of a chunk is only stored, since it could be the header of
+/// the file. This is decided when the results of the chunks are merged.
+///
+/// @since  1.47.0, 18.10.2026
+struct ChunkResult
+{
+   /// Set when the first line of the chunk was found.
+   bool         mHaveFirstLine = false;
+   /// The first line of the chunk.
+   std::string  mFirstLine;
+   /// The data of the remaining lines of the chunk.
+   CsvTable     mTable;
+
+}; // ChunkResult
+
+
+} // namespace
+
+
+
+/// Appends a value.
+///
+/// @param[in]  value  The value to append.
+/// @since  1.47.0, 18.10.2026
+void CsvStringColumn::push_back( std::string_view value)
+{
+
+   mData.append( value);
+   mEnds.push_back( mData.length());
+
+} // CsvStringColumn::push_back
+
+
+
+/// Appends all values of another column.
+///
+/// @param[in]  other  The column to copy the values from.
+/// @since  1.47.0, 18.10.2026
+void CsvStringColumn::append( const CsvStringColumn& other)
+{
+
+   const auto  offset = mData.length();
+
+
+   mData.append( other.mData);
+   mEnds.reserve( mEnds.size() + other.mEnds.size());
+
+   for (auto end_pos : other.mEnds)
+   {
+      mEnds.push_back( end_pos + offset);
+   } // end for
+
+} // CsvStringColumn::append
+
+
+
+/// Returns a value.
+///
+/// @param[in]  idx  The index of the value to return.
+/// @return  The value, remains valid until the column is modified.
+/// @since  1.47.0, 18.10.2026
+std::string_view CsvStringColumn::operator []( size_t idx) const
+{
+
+   const size_t  start = (idx == 0) ? 0 : mEnds[ idx - 1];
+
+
+   return std::string_view( mData).substr( start, mEnds[ idx] - start);
+} // CsvStringColumn::operator []
+
+
+
+/// Reserves memory for the given number of values and characters.
+///
+/// @param[in]  num_values  The expected number of values.
+/// @param[in]  num_chars   The expected total length of all values.
+/// @since  1.47.0, 18.10.2026
+void CsvStringColumn::reserve( size_t num_values, size_t num_chars)
+{
+
+   mData.reserve( num_chars);
+   mEnds.reserve( num_values);
+
+} // CsvStringColumn::reserve
+
+
+
+/// Constructor, creates the (empty) columns for the given schema.
+///
+/// @param[in]  schema  The definitions of the columns.
+/// @since  1.47.0, 18.10.2026
+CsvTable::CsvTable( const CsvSchema& schema)
+{
+
+   mNames.reserve( schema.size());
+   mColumns.reserve( schema.size());
+
+   for (auto const& column_def : schema)
+   {
+      mNames.push_back( column_def.name);
+
+      switch (column_def.type)
+      {
+      case CsvColumnType::int64:
+         mColumns.emplace_back( std::vector< int64_t>());
+         break;
+      case CsvColumnType::float64:
+         mColumns.emplace_back( std::vector< double>());
+         break;
+      case CsvColumnType::string:
+         mColumns.emplace_back( CsvStringColumn());
+         break;
+      case CsvColumnType::ignore:
+         mColumns.emplace_back( std::monostate());
+         break;
+      } // end switch
+   } // end for
+
+} // CsvTable::CsvTable
+
+
+
+/// Returns the index of a column.
+///
+/// @param[in]  name  The name of the column.
+/// @return  The index of the column.
+/// @throw  std::invalid_argument if there is no column with this name.
+/// @since  1.47.0, 18.10.2026
+size_t CsvTable::columnIndex( std::string_view name) const
+{
+
+   for (size_t idx = 0; idx < mNames.size(); ++idx)
+   {
+      if (mNames[ idx] == name)
+         return idx;
+   } // end for
+
+   throw std::invalid_argument( "unknown column '" + std::string( name) + "'");
+} // CsvTable::columnIndex
+
+
+
+/// Returns the values of an integer column.
+///
+/// @param[in]  name  The name of the column.
+/// @return  The values of the column.
+/// @throw  std::invalid_argument for an unknown column name or if the column
+///         has a different type.
+/// @since  1.47.0, 18.10.2026
+const std::vector< int64_t>& CsvTable::int64Column( std::string_view name) const
+{
+
+   return column< std::vector< int64_t>>( name);
+} // CsvTable::int64Column
+
+
+
+/// Returns the values of a floating point column.
+///
+/// @param[in]  name  The name of the column.
+/// @return  The values of the column.
+/// @throw  std::invalid_argument for an unknown column name or if the column
+///         has a different type.
+/// @since  1.47.0, 18.10.2026
+const std::vector< double>& CsvTable::float64Column( std::string_view name) const
+{
+
+   return column< std::vector< double>>( name);
+} // CsvTable::float64Column
+
+
+
+/// Returns the values of a string column.
+///
+/// @param[in]  name  The name of the column.
+/// @return  The values of the column.
+/// @throw  std::invalid_argument for an unknown column name or if the column
+///         has a different type.
+/// @since  1.47.0, 18.10.2026
+const CsvStringColumn& CsvTable::stringColumn( std::string_view name) const
+{
+
+   return column< CsvStringColumn>( name);
+} // CsvTable::stringColumn
+
+
+
+/// Appends all rows of another table with the same schema.
+///
+/// @param[in]  other  The table to copy the rows from.
+/// @since  1.47.0, 18.10.2026
+void CsvTable::append( const CsvTable& other)
+{
+
+   if (mColumns.empty())
+   {
+      *this = other;
+      return;
+   } // end if
+
+   if (mNames != other.mNames)
+      throw std::invalid_argument( "cannot append table with different columns");
+
+   for (size_t idx = 0; idx < mColumns.size(); ++idx)
+   {
+      std::visit( [&]( auto& dest)
+      {
+         using column_t = std::decay_t< decltype( dest)>;
+         auto const&  src = std::get< column_t>( other.mColumns[ idx]);
+
+         if constexpr (std::is_same_v< column_t, CsvStringColumn>)
+            dest.append( src);
+         else if constexpr (!std::is_same_v< column_t, std::monostate>)
+            dest.insert( dest.end(), src.begin(), src.end());
+      }, mColumns[ idx]);
+   } // end for
+
+   mNumRows += other.mNumRows;
+
+} // CsvTable::append
+
+
+
+/// Returns the column with the given name and type.
+///
+/// @tparam  T  The type of the column storage.
+/// @param[in]  name  The name of the column.
+/// @return  The column.
+/// @throw  std::invalid_argument for an unknown column name or if the column
+///         has a different type.
+/// @since  1.47.0, 18.10.2026
+template< typename T> const T& CsvTable::column( std::string_view name) const
+{
+
+   auto const  column_data = std::get_if< T>( &mColumns[ columnIndex( name)]);
+
+
+   if (column_data == nullptr)
+      throw std::invalid_argument( "column '" + std::string( name)
+                                   + "' has a different type");
+
+   return *column_data;
+} // CsvTable::column
+
+
+
+/// Constructor.
+///
+/// @param[in]  schema      The definitions of the columns in the file.
+/// @param[in]  delimiter   The field delimiter.
+/// @param[in]  has_header  Set if the first line contains the column names and
+///                         should be skipped.
+/// @param[in]  quote       The quote character.
+/// @throw  std::invalid_argument if the schema is empty, or if delimiter and
+///         quote character are the same.
+/// @since  1.47.0, 18.10.2026
+CsvReader::CsvReader( CsvSchema schema, char delimiter, bool has_header,
+                      char quote):
+   mSchema( std::move( schema)),
+   mDelimiter( delimiter),
+   mHasHeader( has_header),
+   mQuote( quote)
+{
+
+   if (mSchema.empty())
+      throw std::invalid_argument( "schema must contain at least one column");
+   if (mDelimiter == mQuote)
+      throw std::invalid_argument( "delimiter and quote must be different");
+
+} // CsvReader::CsvReader
+
+
+
+/// Reads a file.
+///
+/// @param[in]  fname
+///    The (path and) name of the file to read.
+/// @param[in]  num_threads
+///    The number of threads to use: 1 reads the file sequentially, 0 uses one
+///    thread per processor. The rows are stored in the order of the file in
+///    any case.
+/// @return  The data read from the file.
+/// @throw  std::runtime_error if the file could not be read or contains
+///         invalid data.
+/// @since  1.47.0, 18.10.2026
+CsvTable CsvReader::readFile( const std::string& fname,
+                              size_t num_threads) const
+{
+
+   if (num_threads == 1)
+   {
+      const MmapTextFile< EmptyLineFilter>  text_file( fname);
+      CsvTable                              table( mSchema);
+      bool                                  skip_line = mHasHeader;
+
+
+      for (auto iter = text_file.begin(); iter != text_file.end(); ++iter)
+      {
+         if (skip_line)
+         {
+            skip_line = false;
+            continue;   // for
+         } // end if
+
+         try
+         {
+            parseLine( *iter, table);
+         } catch (const std::exception& e)
+         {
+            throw std::runtime_error( "line "
+                                      + std::to_string( iter.lineNbr() + 1)
+                                      + ": " + e.what());
+         } // end try
+      } // end for
+
+      return table;
+   } // end if
+
+   const TextFile< EmptyLineFilter>  text_file( fname);
+   CsvTable                          table( mSchema);
+   bool                              is_first_line = true;
+
+
+   text_file.processParallelOrdered< ChunkResult>(
+      [&]( ChunkResult& result, std::string_view line)
+      {
+         if (!result.mHaveFirstLine)
+         {
+            result.mHaveFirstLine = true;
+            result.mFirstLine = line;
+            result.mTable = CsvTable( mSchema);
+         } else
+         {
+            parseLine( line, result.mTable);
+         } // end if
+      },
+      [&]( ChunkResult&& result)
+      {
+         if (!result.mHaveFirstLine)
+            return;
+
+         if (!is_first_line || !mHasHeader)
+            parseLine( result.mFirstLine, table);
+         is_first_line = false;
+
+         if (table.numRows() == 0)
+            table = std::move( result.mTable);
+         else
+            table.append( result.mTable);
+      },
+      num_threads);
+
+   return table;
+} // CsvReader::readFile
+
+
+
+/// Parses one line and adds its values to the table.
+///
+/// @param[in]   line   The line to parse.
+/// @param[out]  table  The table to add the values to.
+/// @throw  std::runtime_error if the line contains invalid data.
+/// @since  1.47.0, 18.10.2026
+void CsvReader::parseLine( std::string_view line, CsvTable& table) const
+{
+
+   if (!line.empty() && (line.back() == '\r'))
+      line.remove_suffix( 1);
+
+   if (line.empty())
+      return;
+
+   size_t  num_fields = 0;
+
+
+   if (line.find( mQuote) == std::string_view::npos)
+   {
+      const StringViewTokenizer  tokenizer( line, CharDelimiter( mDelimiter),
+                                            true);
+
+      for (auto const& field : tokenizer)
+      {
+         if (num_fields < mSchema.size())
+            storeValue( table, num_fields, field);
+         ++num_fields;
+      } // end for
+   } else
+   {
+      num_fields = parseQuotedLine( line, table);
+   } // end if
+
+   if (num_fields != mSchema.size())
+      throw std::runtime_error( "expected " + std::to_string( mSchema.size())
+                                + " fields but found "
+                                + std::to_string( num_fields));
+
+   ++table.mNumRows;
+
+} // CsvReader::parseLine
+
+
+
+/// Stores a field value in a column.
+///
+/// @param[in]  table    The table to store the value in.
+/// @param[in]  col_idx  The index of the column.
+/// @param[in]  value    The value to store.
+/// @throw  std::runtime_error if the value cannot be converted.
+/// @since  1.47.0, 18.10.2026
+void CsvReader::storeValue( CsvTable& table, size_t col_idx,
+                            std::string_view value) const
+{
+
+   auto&  column = table.mColumns[ col_idx];
+
+
+   try
+   {
+      switch (mSchema[ col_idx].type)
+      {
+      case CsvColumnType::int64:
+         {
+            int64_t  int_value;
+            format::stringTo( value, int_value);
+            std::get< std::vector< int64_t>>( column).push_back( int_value);
+         } // end scope
+         break;
+      case CsvColumnType::float64:
+         {
+            double  double_value;
+            format::stringTo( value, double_value);
+            std::get< std::vector< double>>( column).push_back( double_value);
+         } // end scope
+         break;
+      case CsvColumnType::string:
+         std::get< CsvStringColumn>( column).push_back( value);
+         break;
+      case CsvColumnType::ignore:
+         break;
+      } // end switch
+   } catch (const std::logic_error& e)
+   {
+      throw std::runtime_error( "column '" + mSchema[ col_idx].name + "': "
+                                + e.what());
+   } // end try
+
+} // CsvReader::storeValue
+
+
+
+/// Parses a line that contains quotes.
+///
+/// @param[in]   line   The line to parse.
+/// @param[out]  table  The table to add the values to.
+/// @return  The number of fields found in the line.
+/// @throw  std::runtime_error if the line contains invalid data.
+/// @since  1.47.0, 18.10.2026
+size_t CsvReader::parseQuotedLine( std::string_view line, CsvTable& table) const
+{
+
+   size_t       num_fields = 0;
+   size_t       pos = 0;
+   std::string  unquoted;
+
+
+   for (;;)
+   {
+      std::string_view  field;
+
+      if ((pos < line.length()) && (line[ pos] == mQuote))
+      {
+         unquoted.clear();
+         ++pos;
+
+         for (;;)
+         {
+            const auto  quote_pos = line.find( mQuote, pos);
+            if (quote_pos == std::string_view::npos)
+               throw std::runtime_error( "missing closing quote");
+
+            unquoted.append( line.substr( pos, quote_pos - pos));
+            pos = quote_pos + 1;
+
+            // a doubled quote is part of the value
+            if ((pos < line.length()) && (line[ pos] == mQuote))
+            {
+               unquoted.push_back( mQuote);
+               ++pos;
+            } else
+            {
+               break;   // for
+            } // end if
+         } // end for
+
+         if ((pos < line.length()) && (line[ pos] != mDelimiter))
+            throw std::runtime_error( "unexpected character after closing"
+                                      " quote");
+
+         field = unquoted;
+      } else
+      {
+         const auto  delim_pos = line.find( mDelimiter, pos);
+
+         if (delim_pos == std::string_view::npos)
+         {
+            field = line.substr( pos);
+            pos = line.length();
+         } else
+         {
+            field = line.substr( pos, delim_pos - pos);
+            pos = delim_pos;
+         } // end if
+      } // end if
+
+      if (num_fields < mSchema.size())
+         storeValue( table, num_fields, field);
+      ++num_fields;
+
+      if (pos >= line.length())
+         break;   // for
+
+      // skip the delimiter
+      ++pos;
+   } // end for
+
+   return num_fields;
+} // CsvReader::parseQuotedLine
+
+
+
+} // namespace celma::common
+
+
+// =====  END OF csv_reader.cpp  =====
+
@@ -0,0 +1,210 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of class celma::common::detail::CharSet and function
+/// celma::common::detail::findFirstOf().
+
+
+// module headerfile include
+#include "celma/common/detail/char_search.hpp"
+
+
+// C++ Standard Library includes
+#include <cstring>
+
+
+#if defined( __x86_64__)
+#  include <immintrin.h>
+#endif
+
+
+namespace celma::common::detail {
+
+
+namespace {
+
+
+/// Maximum number of characters in a set for which the SIMD search is used.
+/// Each character costs one compare per block.
+constexpr size_t  MaxSimdChars = 8;
+
+
+/// Searches the characters of the set using the lookup table.
+///
+/// @param[in]  first  Pointer to the first character of the range.
+/// @param[in]  last   Pointer behind the last character of the range.
+/// @param[in]  set    The characters to search for.
+/// @return  Pointer to the first character found, \a last if none was found.
+/// @since  1.47.0, 18.10.2026
+const char* findFirstOfTable( const char* first, const char* last,
+                              const CharSet& set) noexcept
+{
+
+   while ((first != last) && !set.contains( *first))
+      ++first;
+
+   return first;
+} // findFirstOfTable
+
+
+#if defined( __x86_64__)
+
+/// Searches the characters of the set with SSE2, 16 characters at a time.
+///
+/// @param[in]  first  Pointer to the first character of the range.
+/// @param[in]  last   Pointer behind the last character of the range.
+/// @param[in]  set    The characters to search for, at most MaxSimdChars.
+/// @return  Pointer to the first character found, \a last if none was found.
+/// @since  1.47.0, 18.10.2026
+const char* findFirstOfSse2( const char* first, const char* last,
+                             const CharSet& set) noexcept
+{
+
+   const auto&  chars = set.chars();
+   __m128i      needles[ MaxSimdChars];
+
+
+   for (size_t i = 0; i < chars.length(); ++i)
+      needles[ i] = _mm_set1_epi8( chars[ i]);
+
+   while (last - first >= 16)
+   {
+      const __m128i  block = _mm_loadu_si128(
+         reinterpret_cast< const __m128i*>( first));
+      __m128i        match = _mm_cmpeq_epi8( block, needles[ 0]);
+
+      for (size_t i = 1; i < chars.length(); ++i)
+         match = _mm_or_si128( match, _mm_cmpeq_epi8( block, needles[ i]));
+
+      if (const int mask = _mm_movemask_epi8( match); mask != 0)
+         return first + __builtin_ctz( mask);
+
+      first += 16;
+   } // end while
+
+   return findFirstOfTable( first, last, set);
+} // findFirstOfSse2
+
+
+/// Searches the characters of the set with AVX2, 32 characters at a time.
+///
+/// @param[in]  first  Pointer to the first character of the range.
+/// @param[in]  last   Pointer behind the last character of the range.
+/// @param[in]  set    The characters to search for, at most MaxSimdChars.
+/// @return  Pointer to the first character found, \a last if none was found.
+/// @since  1.47.0, 18.10.2026
+__attribute__(( target( "avx2")))
+   const char* findFirstOfAvx2( const char* first, const char* last,
+                                const CharSet& set) noexcept
+{
+
+   const auto&  chars = set.chars();
+   __m256i      needles[ MaxSimdChars];
+
+
+   for (size_t i = 0; i < chars.length(); ++i)
+      needles[ i] = _mm256_set1_epi8( chars[ i]);
+
+   while (last - first >= 32)
+   {
+      const __m256i  block = _mm256_loadu_si256(
+         reinterpret_cast< const __m256i*>( first));
+      __m256i        match = _mm256_cmpeq_epi8( block, needles[ 0]);
+
+      for (size_t i = 1; i < chars.length(); ++i)
+         match = _mm256_or_si256( match, _mm256_cmpeq_epi8( block, needles[ i]));
+
+      if (const auto mask = static_cast< unsigned>( _mm256_movemask_epi8( match));
+          mask != 0)
+         return first + __builtin_ctz( mask);
+
+      first += 32;
+   } // end while
+
+   return findFirstOfSse2( first, last, set);
+} // findFirstOfAvx2
+
+#endif
+
+
+} // namespace
+
+
+
+/// Constructor.
+///
+/// @param[in]  chars  The characters of the set, duplicates are ignored.
+/// @since  1.47.0, 18.10.2026
+CharSet::CharSet( std::string_view chars)
+{
+
+   for (auto c : chars)
+   {
+      if (!contains( c))
+      {
+         mTable[ static_cast< unsigned char>( c)] = true;
+         mChars.push_back( c);
+      } // end if
+   } // end for
+
+} // CharSet::CharSet
+
+
+
+/// Returns the position of the first character in the range that is contained
+/// in the set.
+///
+/// @param[in]  first  Pointer to the first character of the range.
+/// @param[in]  last   Pointer behind the last character of the range.
+/// @param[in]  set    The characters to search for.
+/// @return  Pointer to the first character found, \a last if none was found.
+/// @since  1.47.0, 18.10.2026
+const char* findFirstOf( const char* first, const char* last,
+                         const CharSet& set) noexcept
+{
+
+   const auto  num_chars = set.chars().length();
+
+
+   if ((num_chars == 0) || (first == last))
+      return last;
+
+   // memchr() is already vectorised by the C library
+   if (num_chars == 1)
+   {
+      const auto  found = ::memchr( first, set.chars()[ 0], last - first);
+      return (found != nullptr) ? static_cast< const char*>( found) : last;
+   } // end if
+
+#if defined( __x86_64__)
+   if (num_chars <= MaxSimdChars)
+   {
+      static const bool  has_avx2 = __builtin_cpu_supports( "avx2");
+
+      if (has_avx2)
+         return findFirstOfAvx2( first, last, set);
+      return findFirstOfSse2( first, last, set);
+   } // end if
+#endif
+
+   return findFirstOfTable( first, last, set);
+} // findFirstOf
+
+
+
+} // namespace celma::common::detail
+
+
+// =====  END OF char_search.cpp  =====
+
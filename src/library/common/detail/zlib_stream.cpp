@@ -0,0 +1,218 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of classes celma::common::detail::ZlibDeflate and
+/// celma::common::detail::ZlibInflate.
+
+
+// module headerfile include
+#include "celma/common/detail/zlib_stream.hpp"
+
+
+// OS/C lib includes
+#include <zlib.h>
+
+
+// C++ Standard Library includes
+#include <stdexcept>
+#include <string>
+
+
+// project includes
+#include "celma/common/stream_stage.hpp"
+
+
+namespace celma::common::detail {
+
+
+namespace {
+
+
+/// Size of the internal buffers for the compressed data.
+constexpr size_t  ZlibBufferSize = 64 * 1024;
+
+
+/// Returns the error message for a zlib result code.
+///
+/// @param[in]  stream  The zlib stream state.
+/// @param[in]  rc      The result code.
+/// @return  The error message.
+/// @since  1.47.0, 18.10.2026
+std::string zlibError( const z_stream& stream, int rc)
+{
+   return (stream.msg != nullptr) ? std::string( stream.msg)
+                                  : "error code " + std::to_string( rc);
+} // zlibError
+
+
+} // namespace
+
+
+
+/// Constructor, initialises the compression.
+///
+/// @param[in]  level
+///    The compression level, 0 (none) to 9 (best), -1 for the default.
+/// @throw  std::runtime_error if the initialisation failed.
+/// @since  1.47.0, 18.10.2026
+ZlibDeflate::ZlibDeflate( int level):
+   mpStream( std::make_unique< z_stream>()),
+   mpOutput( new unsigned char[ ZlibBufferSize])
+{
+
+   if (const auto rc = ::deflateInit( mpStream.get(), level); rc != Z_OK)
+      throw std::runtime_error( "could not initialise compression: "
+                                + zlibError( *mpStream, rc));
+
+} // ZlibDeflate::ZlibDeflate
+
+
+
+/// Destructor, frees the resources.
+///
+/// @since  1.47.0, 18.10.2026
+ZlibDeflate::~ZlibDeflate()
+{
+
+   ::deflateEnd( mpStream.get());
+
+} // ZlibDeflate::~ZlibDeflate
+
+
+
+/// Compresses the data and passes the compressed data to the next stage.
+///
+/// @param[in]  data    Pointer to the data to compress.
+/// @param[in]  len     The length of the data.
+/// @param[in]  next    The stage to pass the compressed data to.
+/// @param[in]  finish  Set to write the remaining compressed data.
+/// @return  Number of bytes passed to the next stage.
+/// @since  1.47.0, 18.10.2026
+size_t ZlibDeflate::compress( const unsigned char* data, size_t len,
+                              IWriteStage& next, bool finish)
+{
+
+   size_t  bytes_out = 0;
+   int     rc = Z_OK;
+
+
+   mpStream->next_in  = const_cast< Bytef*>( data);
+   mpStream->avail_in = static_cast< uInt>( len);
+
+   do
+   {
+      mpStream->next_out  = mpOutput.get();
+      mpStream->avail_out = ZlibBufferSize;
+
+      rc = ::deflate( mpStream.get(), finish ? Z_FINISH : Z_NO_FLUSH);
+      if (rc == Z_STREAM_ERROR)
+         throw std::runtime_error( "compression failed: "
+                                   + zlibError( *mpStream, rc));
+
+      const size_t  have = ZlibBufferSize - mpStream->avail_out;
+      if (have > 0)
+      {
+         next.write( mpOutput.get(), have);
+         bytes_out += have;
+      } // end if
+   } while ((mpStream->avail_out == 0) || (finish && (rc != Z_STREAM_END)));
+
+   return bytes_out;
+} // ZlibDeflate::compress
+
+
+
+/// Constructor, initialises the decompression.
+///
+/// @throw  std::runtime_error if the initialisation failed.
+/// @since  1.47.0, 18.10.2026
+ZlibInflate::ZlibInflate():
+   mpStream( std::make_unique< z_stream>()),
+   mpInput( new unsigned char[ ZlibBufferSize])
+{
+
+   if (const auto rc = ::inflateInit( mpStream.get()); rc != Z_OK)
+      throw std::runtime_error( "could not initialise decompression: "
+                                + zlibError( *mpStream, rc));
+
+} // ZlibInflate::ZlibInflate
+
+
+
+/// Destructor, frees the resources.
+///
+/// @since  1.47.0, 18.10.2026
+ZlibInflate::~ZlibInflate()
+{
+
+   ::inflateEnd( mpStream.get());
+
+} // ZlibInflate::~ZlibInflate
+
+
+
+/// Reads compressed data from the source and returns the decompressed data.
+///
+/// @param[in]   source    The stage to get the compressed data from.
+/// @param[out]  data      Pointer to the buffer for the decompressed data.
+/// @param[in]   len       Maximum length of the data to return.
+/// @param[out]  bytes_in  Incremented by the number of bytes read from the
+///                        source.
+/// @return  Number of bytes returned, 0 at the end of the compressed data.
+/// @throw  std::runtime_error if the compressed data is invalid or truncated.
+/// @since  1.47.0, 18.10.2026
+size_t ZlibInflate::decompress( IReadStage& source, unsigned char* data,
+                                size_t len, size_t& bytes_in)
+{
+
+   if (mEnd || (len == 0))
+      return 0;
+
+   mpStream->next_out  = data;
+   mpStream->avail_out = static_cast< uInt>( len);
+
+   // return as soon as some data could be decompressed
+   while (mpStream->avail_out == len)
+   {
+      if (mpStream->avail_in == 0)
+      {
+         const size_t  data_read = source.read( mpInput.get(), ZlibBufferSize);
+         if (data_read == 0)
+            throw std::runtime_error( "compressed data is truncated");
+         bytes_in += data_read;
+         mpStream->next_in  = mpInput.get();
+         mpStream->avail_in = static_cast< uInt>( data_read);
+      } // end if
+
+      const auto  rc = ::inflate( mpStream.get(), Z_NO_FLUSH);
+      if (rc == Z_STREAM_END)
+      {
+         mEnd = true;
+         break;   // while
+      } // end if
+      if ((rc != Z_OK) && (rc != Z_BUF_ERROR))
+         throw std::runtime_error( "decompression failed: "
+                                   + zlibError( *mpStream, rc));
+   } // end while
+
+   return len - mpStream->avail_out;
+} // ZlibInflate::decompress
+
+
+
+} // namespace celma::common::detail
+
+
+// =====  END OF zlib_stream.cpp  =====
+
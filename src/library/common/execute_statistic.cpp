@@ -0,0 +1,335 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of classes celma::common::ExecuteStatistic and
+/// celma::common::ExecuteCallPoint.
+
+
+// module headerfile include
+#include "celma/common/execute_statistic.hpp"
+
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+
+// project includes
+#include "celma/common/string_util.hpp"
+
+
+namespace celma { namespace common {
+
+
+
+/// Returns the number of executions.
+///
+/// @return  The sum of the executions counted by all threads.
+/// @since  1.47.0, 18.10.2026
+size_t ExecuteCallPoint::executions() const noexcept
+{
+
+   const auto  histogram = timeHistogram();
+   uint64_t    result = std::accumulate( histogram.begin(), histogram.end(),
+                                         uint64_t( 0));
+
+
+   for (const auto& shard : mShards)
+      result += shard.mCount.load( std::memory_order_relaxed);
+
+   return static_cast< size_t>( result);
+} // ExecuteCallPoint::executions
+
+
+
+/// Returns the total time spent in the profiled scope.
+///
+/// @return  The sum of the times recorded by all threads.
+/// @since  1.47.0, 18.10.2026
+std::chrono::nanoseconds ExecuteCallPoint::totalTime() const noexcept
+{
+
+   uint64_t  nanos = 0;
+
+
+   for (const auto& shard : mShards)
+      nanos += shard.mNanos.load( std::memory_order_relaxed);
+
+   return std::chrono::nanoseconds( nanos);
+} // ExecuteCallPoint::totalTime
+
+
+
+/// Returns the histogram of the times recorded.
+///
+/// @return  The number of time periods per bucket.
+/// @since  1.47.0, 18.10.2026
+std::array< uint64_t, ExecuteCallPoint::NumTimeBuckets>
+   ExecuteCallPoint::timeHistogram() const noexcept
+{
+
+   std::array< uint64_t, NumTimeBuckets>  result{};
+
+
+   for (const auto& shard : mShards)
+   {
+      for (size_t idx = 0; idx < NumTimeBuckets; ++idx)
+         result[ idx] += shard.mTimeBuckets[ idx].load( std::memory_order_relaxed);
+   } // end for
+
+   return result;
+} // ExecuteCallPoint::timeHistogram
+
+
+
+/// Returns the upper bound of the histogram bucket that contains the given
+/// percentile of the times recorded.
+///
+/// @param[in]  percent  The percentile to return, 0 .. 100.
+/// @return  The percentile in nanoseconds, 0 if no time was recorded.
+/// @since  1.47.0, 18.10.2026
+uint64_t ExecuteCallPoint::timePercentile( double percent) const noexcept
+{
+
+   const auto      histogram = timeHistogram();
+   const uint64_t  num_values = std::accumulate( histogram.begin(),
+                                                 histogram.end(), uint64_t( 0));
+
+
+   if (num_values == 0)
+      return 0;
+
+   const double    fraction = std::clamp( percent, 0.0, 100.0) / 100.0;
+   const uint64_t  rank = std::max< uint64_t>( static_cast< uint64_t>(
+      std::ceil( fraction * static_cast< double>( num_values))), 1);
+   uint64_t        cumulated = 0;
+
+   for (size_t idx = 0; idx < NumTimeBuckets; ++idx)
+   {
+      cumulated += histogram[ idx];
+      if (cumulated >= rank)
+         return (idx == 64) ? UINT64_MAX : (uint64_t( 1) << idx) - 1;
+   } // end for
+
+   return UINT64_MAX;
+} // ExecuteCallPoint::timePercentile
+
+
+
+/// Resets all counters to 0.
+///
+/// @since  1.47.0, 18.10.2026
+void ExecuteCallPoint::reset() noexcept
+{
+
+   for (auto& shard : mShards)
+   {
+      shard.mCount.store( 0, std::memory_order_relaxed);
+      shard.mNanos.store( 0, std::memory_order_relaxed);
+      for (auto& bucket : shard.mTimeBuckets)
+         bucket.store( 0, std::memory_order_relaxed);
+   } // end for
+
+} // ExecuteCallPoint::reset
+
+
+
+/// Returns the current execute counter for the given call point.<br>
+/// Since the "current" call point is not known, returns the counter of the
+/// last call point defined before.
+///
+/// @param[in]  file_name
+///    The name of the file.
+/// @param[in]  func_name
+///    The name of the function or method.
+/// @param[in]  line_nbr
+///    The line number in the source file where the call point is defined.
+/// @return
+///    Current number of executions of the call point, 0 if the call point
+///    was never passed yet.
+/// @since  1.47.0, 18.10.2026
+///    (thread-safe)
+/// @since  1.30.0, 23.06.2019
+size_t ExecuteStatistic::getExecutions( std::string file_name,
+   const std::string& func_name, int line_nbr) const
+{
+
+   if (startsWith( file_name, mPrefix, false))
+   {
+      file_name.erase( 0, mPrefix.length());
+   } // end if
+
+   auto const                          fname = extractFuncname( func_name);
+   auto const                          upper_bound = make_tuple( file_name,
+                                                                 fname,
+                                                                 line_nbr);
+   const std::lock_guard< std::mutex>  guard( mMutex);
+   auto                                it = mStats.upper_bound( upper_bound);
+
+
+   if (it == mStats.begin())
+      return 0;
+
+   return (--it)->second->executions();
+} // ExecuteStatistic::getExecutions
+
+
+
+/// Resets all counters to 0.
+///
+/// @since  1.47.0, 18.10.2026
+///    (thread-safe)
+/// @since  1.30.0, 23.06.2019
+void ExecuteStatistic::reset()
+{
+
+   const std::lock_guard< std::mutex>  guard( mMutex);
+
+
+   for (auto& it : mStats)
+      it.second->reset();
+
+} // ExecuteStatistic::reset
+
+
+
+/// Prints the profile report: All call points, sorted by the total time
+/// spent, with the number of executions, the total and mean time and the
+/// 50th and 99th percentile (upper bound of the power of two bucket).
+///
+/// @param[in]  os  The stream to write into.
+/// @since  1.47.0, 18.10.2026
+void ExecuteStatistic::printProfile( std::ostream& os) const
+{
+
+   // the total time is read once, the counters may change while sorting
+   std::vector< std::tuple< int64_t, const map_key_t*,
+                            const ExecuteCallPoint*>>  call_points;
+   const auto                                          old_flags = os.flags();
+   const auto                                          old_precision
+                                                          = os.precision();
+   const std::lock_guard< std::mutex>                  guard( mMutex);
+
+
+   for (auto const& it : mStats)
+      call_points.emplace_back( it.second->totalTime().count(), &it.first,
+                                it.second.get());
+
+   std::stable_sort( call_points.begin(), call_points.end(),
+                     []( const auto& lhs, const auto& rhs)
+                     {
+                        return std::get< 0>( lhs) > std::get< 0>( rhs);
+                     });
+
+   os << "  Total [ms]       Calls   Mean [ns]    p50 [ns]    p99 [ns]  Call point\n"
+      << "------------  ----------  ----------  ----------  ----------  ----------\n";
+
+   for (auto const& [ total, key, cp] : call_points)
+   {
+      const auto      histogram = cp->timeHistogram();
+      const uint64_t  num_timed = std::accumulate( histogram.begin(),
+                                                   histogram.end(),
+                                                   uint64_t( 0));
+
+      os << std::fixed << std::setprecision( 3) << std::setw( 12)
+         << static_cast< double>( total) / 1'000'000.0
+         << "  " << std::setw( 10) << cp->executions()
+         << "  " << std::setw( 10)
+         << ((num_timed == 0) ? 0 : total / static_cast< int64_t>( num_timed))
+         << "  " << std::setw( 10) << cp->timePercentile( 50.0)
+         << "  " << std::setw( 10) << cp->timePercentile( 99.0)
+         << "  " << std::get< 0>( *key) << ": " << std::get< 1>( *key)
+         << "[" << std::get< 2>( *key) << "]\n";
+   } // end for
+
+   os.flags( old_flags);
+   os.precision( old_precision);
+
+} // ExecuteStatistic::printProfile
+
+
+
+/// Returns the counters for the given call point, creates them if the call
+/// point is new.
+///
+/// @param[in]  file_name
+///    The name of the file.
+/// @param[in]  func_name
+///    The name of the function or method.
+/// @param[in]  line_nbr
+///    The line number in the source file where the call point is defined.
+/// @return
+///    The counters of this call point.
+/// @since  1.47.0, 18.10.2026
+///    (thread-safe, returns the counters)
+/// @since  1.30.0, 23.06.2019
+ExecuteCallPoint& ExecuteStatistic::callpoint( std::string file_name,
+   const std::string& func_name, int line_nbr)
+{
+
+   if (startsWith( file_name, mPrefix, false))
+   {
+      file_name.erase( 0, mPrefix.length());
+   } // end if
+
+   const std::lock_guard< std::mutex>  guard( mMutex);
+   auto&                               entry = mStats[ { file_name, func_name,
+                                                         line_nbr }];
+
+
+   if (!entry)
+      entry = std::make_unique< ExecuteCallPoint>();
+
+   return *entry;
+} // ExecuteStatistic::callpoint
+
+
+
+/// Insertion operator for objects of this class, prints the current list of
+/// call points and their counters.
+///
+/// @param[in]  os
+///    The stream to write into.
+/// @param[in]  es
+///    The object to print the statistic of.
+/// @return  The stream as passed in.
+/// @since  1.30.0, 23.06.2019
+std::ostream& operator <<( std::ostream& os, const ExecuteStatistic& es)
+{
+
+   const std::lock_guard< std::mutex>  guard( es.mMutex);
+
+
+   for (auto const& it : es.mStats)
+   {
+      os << std::get< 0>( it.first) << ": " << std::get< 1>( it.first)
+         << "[" << std::get< 2>( it.first) << "] = "
+         << it.second->executions() << std::endl;
+   } // end for
+
+   return os;
+} // operator <<
+
+
+
+} // namespace common
+} // namespace celma
+
+
+// =====  END OF execute_statistic.cpp  =====
@@ -0,0 +1,206 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of classes celma::common::LatencyHistogram and
+/// celma::common::HistogramSnapshot.
+
+
+// module headerfile include
+#include "celma/common/latency_histogram.hpp"
+
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <cmath>
+
+
+namespace celma::common {
+
+
+
+/// Constructor, creates an empty snapshot.
+///
+/// @since  1.47.0, 18.10.2026
+HistogramSnapshot::HistogramSnapshot():
+   mCounts( HistogramBuckets::NumBuckets, 0)
+{
+} // HistogramSnapshot::HistogramSnapshot
+
+
+
+/// Adds the current values of a recorder. The recorder may be in use by
+/// another thread.<br>
+/// The total count is computed from the bucket counts, so that the
+/// percentiles are consistent even if values are recorded concurrently.
+/// For the same reason, minimum and maximum are taken from the buckets if the
+/// recorder did not store them yet.
+///
+/// @param[in]  recorder  The recorder to add the values of.
+/// @since  1.47.0, 18.10.2026
+void HistogramSnapshot::merge( const HistogramRecorder& recorder)
+{
+
+   uint64_t  num_values = 0;
+   size_t    first_idx = HistogramBuckets::NumBuckets;
+   size_t    last_idx = 0;
+
+
+   for (size_t idx = 0; idx < HistogramBuckets::NumBuckets; ++idx)
+   {
+      const auto  count = recorder.mCounts[ idx].load( std::memory_order_relaxed);
+      if (count == 0)
+         continue;
+      mCounts[ idx] += count;
+      num_values += count;
+      first_idx = std::min( first_idx, idx);
+      last_idx = idx;
+   } // end for
+
+   if (num_values == 0)
+      return;
+
+   const auto  rec_min = recorder.mMin.load( std::memory_order_relaxed);
+   const auto  rec_max = recorder.mMax.load( std::memory_order_relaxed);
+
+   mTotalCount += num_values;
+   mSum += recorder.mSum.load( std::memory_order_relaxed);
+   mMin = std::min( mMin, (rec_min <= rec_max)
+                          ? rec_min : HistogramBuckets::lowerBound( first_idx));
+   mMax = std::max( mMax, (rec_min <= rec_max)
+                          ? rec_max : HistogramBuckets::upperBound( last_idx));
+
+} // HistogramSnapshot::merge
+
+
+
+/// Adds the values of another snapshot.
+///
+/// @param[in]  other  The snapshot to add the values of.
+/// @since  1.47.0, 18.10.2026
+void HistogramSnapshot::merge( const HistogramSnapshot& other)
+{
+
+   if (other.mTotalCount == 0)
+      return;
+
+   for (size_t idx = 0; idx < HistogramBuckets::NumBuckets; ++idx)
+      mCounts[ idx] += other.mCounts[ idx];
+
+   mTotalCount += other.mTotalCount;
+   mSum += other.mSum;
+   mMin = std::min( mMin, other.mMin);
+   mMax = std::max( mMax, other.mMax);
+
+} // HistogramSnapshot::merge
+
+
+
+/// Returns the value below or at which the given percentage of the values
+/// lies, e.g. 99.9 for p99.9.<br>
+/// The result is the upper bound of the bucket, limited to the maximum.
+///
+/// @param[in]  percent  The percentile to return, 0 .. 100.
+/// @return  The value of the percentile, 0 if the snapshot is empty.
+/// @since  1.47.0, 18.10.2026
+uint64_t HistogramSnapshot::percentile( double percent) const noexcept
+{
+
+   if (mTotalCount == 0)
+      return 0;
+
+   if (percent <= 0.0)
+      return mMin;
+
+   const double    fraction = std::min( percent, 100.0) / 100.0;
+   const uint64_t  rank = std::max< uint64_t>( static_cast< uint64_t>(
+      std::ceil( fraction * static_cast< double>( mTotalCount))), 1);
+   uint64_t        cumulated = 0;
+
+
+   for (size_t idx = 0; idx < HistogramBuckets::NumBuckets; ++idx)
+   {
+      cumulated += mCounts[ idx];
+      if (cumulated >= rank)
+         return std::clamp( HistogramBuckets::upperBound( idx), mMin, mMax);
+   } // end for
+
+   return mMax;
+} // HistogramSnapshot::percentile
+
+
+
+/// Returns the range and number of values of all buckets that contain
+/// values.
+///
+/// @return  The non-empty buckets, sorted by value.
+/// @since  1.47.0, 18.10.2026
+std::vector< HistogramBucket> HistogramSnapshot::buckets() const
+{
+
+   std::vector< HistogramBucket>  result;
+
+
+   for (size_t idx = 0; idx < HistogramBuckets::NumBuckets; ++idx)
+   {
+      if (mCounts[ idx] > 0)
+         result.push_back( { HistogramBuckets::lowerBound( idx),
+                             HistogramBuckets::upperBound( idx),
+                             mCounts[ idx] });
+   } // end for
+
+   return result;
+} // HistogramSnapshot::buckets
+
+
+
+/// Creates a new recorder. The recorder remains valid as long as the
+/// histogram exists.
+///
+/// @return  The new recorder, for use by one thread.
+/// @since  1.47.0, 18.10.2026
+HistogramRecorder& LatencyHistogram::createRecorder()
+{
+
+   std::lock_guard< std::mutex>  guard( mMutex);
+
+
+   mRecorders.push_back( std::make_unique< HistogramRecorder>());
+   return *mRecorders.back();
+} // LatencyHistogram::createRecorder
+
+
+
+/// Merges the current values of all recorders.
+///
+/// @return  The snapshot with the values of all recorders.
+/// @since  1.47.0, 18.10.2026
+HistogramSnapshot LatencyHistogram::snapshot() const
+{
+
+   HistogramSnapshot             snap;
+   std::lock_guard< std::mutex>  guard( mMutex);
+
+
+   for (const auto& recorder : mRecorders)
+      snap.merge( *recorder);
+
+   return snap;
+} // LatencyHistogram::snapshot
+
+
+
+} // namespace celma::common
+
+
+// =====  END OF latency_histogram.cpp  =====
@@ -0,0 +1,138 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of class celma::common::ManagedThread.
+
+
+// module headerfile include
+#include "celma/common/managed_thread.hpp"
+
+
+// OS/C lib includes
+#include <linux/mempolicy.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+
+// C++ Standard Library includes
+#include <cerrno>
+#include <stdexcept>
+#include <system_error>
+
+
+namespace celma { namespace common {
+
+
+
+/// Applies thread options to the calling thread.
+///
+/// @param[in]  options  The options to apply.
+/// @throw  std::invalid_argument if a CPU number is invalid.
+/// @throw  std::system_error if an option could not be applied.
+/// @since  1.47.0, 18.10.2026
+void ManagedThread::applyOptions( const ThreadOptions& options) noexcept( false)
+{
+
+   if (!options.mName.empty())
+   {
+      // thread names are limited to 15 characters
+      const int  rc = ::pthread_setname_np( ::pthread_self(),
+                                            options.mName.substr( 0, 15).c_str());
+      if (rc != 0)
+         throw std::system_error( rc, std::system_category(),
+                                  "could not set thread name");
+   } // end if
+
+   if (!options.mCpus.empty())
+   {
+      cpu_set_t  cpus;
+
+      CPU_ZERO( &cpus);
+      for (auto const cpu : options.mCpus)
+      {
+         if ((cpu < 0) || (cpu >= CPU_SETSIZE))
+            throw std::invalid_argument( "invalid CPU number "
+                                         + std::to_string( cpu));
+         CPU_SET( cpu, &cpus);
+      } // end for
+
+      const int  rc = ::pthread_setaffinity_np( ::pthread_self(), sizeof( cpus),
+                                                &cpus);
+      if (rc != 0)
+         throw std::system_error( rc, std::system_category(),
+                                  "could not set CPU affinity");
+   } // end if
+
+   if (options.mSchedPolicy != -1)
+   {
+      sched_param  param{};
+
+      param.sched_priority = options.mSchedPriority;
+
+      const int  rc = ::pthread_setschedparam( ::pthread_self(),
+                                               options.mSchedPolicy, &param);
+      if (rc != 0)
+         throw std::system_error( rc, std::system_category(),
+                                  "could not set scheduling policy");
+   } // end if
+
+   if (options.mNumaLocal)
+   {
+      if (::syscall( SYS_set_mempolicy, MPOL_LOCAL, nullptr, 0) != 0)
+         throw std::system_error( errno, std::system_category(),
+                                  "could not set NUMA memory policy");
+   } // end if
+
+} // ManagedThread::applyOptions
+
+
+
+/// Returns the CPU that the calling thread currently runs on.
+///
+/// @return  The number of the CPU, -1 if it could not be determined.
+/// @since  1.47.0, 18.10.2026
+int ManagedThread::currentCpu() noexcept
+{
+
+   return ::sched_getcpu();
+} // ManagedThread::currentCpu
+
+
+
+/// Returns the NUMA node that the calling thread currently runs on.
+///
+/// @return  The number of the NUMA node, -1 if it could not be determined.
+/// @since  1.47.0, 18.10.2026
+int ManagedThread::currentNumaNode() noexcept
+{
+
+   unsigned int  cpu = 0;
+   unsigned int  node = 0;
+
+
+   if (::getcpu( &cpu, &node) != 0)
+      return -1;
+
+   return static_cast< int>( node);
+} // ManagedThread::currentNumaNode
+
+
+
+} // namespace common
+} // namespace celma
+
+
+// =====  END OF managed_thread.cpp  =====
@@ -0,0 +1,320 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of classes celma::common::PerfCounters and
+/// celma::common::PerfCounterValues.
+
+
+// module headerfile include
+#include "celma/common/perf_counters.hpp"
+
+
+// OS/C lib includes
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+
+// C++ Standard Library includes
+#include <cstring>
+#include <iomanip>
+#include <ostream>
+#include <utility>
+
+
+namespace celma::common {
+
+
+namespace {
+
+
+/// Type and configuration of the perf events, in the order of PerfEvent.
+constexpr std::array< std::pair< uint32_t, uint64_t>,
+                      PerfCounterValues::NumEvents>  EventConfig =
+{{
+   { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+   { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+   { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES },
+   { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+   { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+   { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES }
+}};
+
+
+/// Opens a counter for the calling thread.
+///
+/// @param[in]  type            The type of the event.
+/// @param[in]  config          The event.
+/// @param[in]  exclude_kernel  Set to count only user space.
+/// @return  The file descriptor of the counter, -1 on error.
+/// @since  1.47.0, 18.10.2026
+int openCounter( uint32_t type, uint64_t config, bool exclude_kernel)
+{
+
+   perf_event_attr  attr;
+
+
+   std::memset( &attr, 0, sizeof( attr));
+   attr.size = sizeof( attr);
+   attr.type = type;
+   attr.config = config;
+   attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED
+                      | PERF_FORMAT_TOTAL_TIME_RUNNING;
+   attr.exclude_kernel = exclude_kernel ? 1 : 0;
+   attr.exclude_hv = 1;
+
+   return static_cast< int>( ::syscall( SYS_perf_event_open, &attr, 0, -1, -1,
+                                        PERF_FLAG_FD_CLOEXEC));
+} // openCounter
+
+
+/// Prints a counter value or "n/a".
+///
+/// @param[in]  os      The stream to write into.
+/// @param[in]  name    The name of the counter.
+/// @param[in]  values  The counter values.
+/// @param[in]  event   The event to print the value of.
+/// @since  1.47.0, 18.10.2026
+void printValue( std::ostream& os, const char* name,
+                 const PerfCounterValues& values, PerfEvent event)
+{
+
+   os << ", " << name << ' ';
+
+   if (values.available( event))
+      os << values.value( event);
+   else
+      os << "n/a";
+
+} // printValue
+
+
+} // namespace
+
+
+
+/// Returns the instructions per cycle.
+///
+/// @return  The IPC, a negative value if not available.
+/// @since  1.47.0, 18.10.2026
+double PerfCounterValues::ipc() const noexcept
+{
+
+   if (!available( PerfEvent::cycles) || !available( PerfEvent::instructions)
+       || (value( PerfEvent::cycles) == 0))
+      return -1.0;
+
+   return static_cast< double>( value( PerfEvent::instructions))
+          / static_cast< double>( value( PerfEvent::cycles));
+} // PerfCounterValues::ipc
+
+
+
+/// Returns the percentage of last level cache accesses that missed.
+///
+/// @return  The cache miss rate in percent, a negative value if not
+///          available.
+/// @since  1.47.0, 18.10.2026
+double PerfCounterValues::cacheMissRate() const noexcept
+{
+
+   if (!available( PerfEvent::cacheReferences)
+       || !available( PerfEvent::cacheMisses)
+       || (value( PerfEvent::cacheReferences) == 0))
+      return -1.0;
+
+   return static_cast< double>( value( PerfEvent::cacheMisses)) * 100.0
+          / static_cast< double>( value( PerfEvent::cacheReferences));
+} // PerfCounterValues::cacheMissRate
+
+
+
+/// Returns the difference between two readings.
+///
+/// @param[in]  earlier  The earlier reading.
+/// @return  The counter differences, an event is available only when it is
+///          available in both readings.
+/// @since  1.47.0, 18.10.2026
+PerfCounterValues PerfCounterValues::operator -(
+   const PerfCounterValues& earlier) const noexcept
+{
+
+   PerfCounterValues  result;
+
+
+   for (size_t idx = 0; idx < NumEvents; ++idx)
+   {
+      result.mAvailable[ idx] = mAvailable[ idx] && earlier.mAvailable[ idx];
+      if (result.mAvailable[ idx])
+         result.mValues[ idx] = mValues[ idx] - earlier.mValues[ idx];
+   } // end for
+
+   result.mTime = mTime - earlier.mTime;
+
+   return result;
+} // PerfCounterValues::operator -
+
+
+
+/// Prints the time and the available counters, IPC and cache miss rate in one
+/// line.
+///
+/// @param[in]  os      The stream to write into.
+/// @param[in]  values  The values to print.
+/// @return  The stream as passed in.
+/// @since  1.47.0, 18.10.2026
+std::ostream& operator <<( std::ostream& os, const PerfCounterValues& values)
+{
+
+   const auto  old_flags = os.flags();
+   const auto  old_precision = os.precision();
+
+
+   os << "time " << values.time().count() << " ns";
+   printValue( os, "cycles", values, PerfEvent::cycles);
+   printValue( os, "instructions", values, PerfEvent::instructions);
+
+   os << std::fixed << std::setprecision( 2) << ", IPC ";
+   if (values.ipc() >= 0.0)
+      os << values.ipc();
+   else
+      os << "n/a";
+
+   os << ", cache misses ";
+   if (values.cacheMissRate() >= 0.0)
+      os << values.cacheMissRate() << " %";
+   else
+      os << "n/a";
+
+   printValue( os, "branch misses", values, PerfEvent::branchMisses);
+   printValue( os, "context switches", values, PerfEvent::contextSwitches);
+
+   os.flags( old_flags);
+   os.precision( old_precision);
+
+   return os;
+} // operator <<
+
+
+
+/// Constructor, opens and starts the counters.<br>
+/// Software events are first opened including the kernel, since e.g. context
+/// switches happen there, then only for user space.
+///
+/// @since  1.47.0, 18.10.2026
+PerfCounters::PerfCounters()
+{
+
+   for (size_t idx = 0; idx < PerfCounterValues::NumEvents; ++idx)
+   {
+      const auto [ type, config] = EventConfig[ idx];
+
+      mFds[ idx] = (type == PERF_TYPE_SOFTWARE)
+                   ? openCounter( type, config, false) : -1;
+      if (mFds[ idx] < 0)
+         mFds[ idx] = openCounter( type, config, true);
+   } // end for
+
+} // PerfCounters::PerfCounters
+
+
+
+/// Destructor, closes the counters.
+///
+/// @since  1.47.0, 18.10.2026
+PerfCounters::~PerfCounters()
+{
+
+   for (auto fd : mFds)
+   {
+      if (fd >= 0)
+         ::close( fd);
+   } // end for
+
+} // PerfCounters::~PerfCounters
+
+
+
+/// Returns if at least one counter could be opened.
+///
+/// @return  \c true if any counter is available.
+/// @since  1.47.0, 18.10.2026
+bool PerfCounters::available() const noexcept
+{
+
+   for (auto fd : mFds)
+   {
+      if (fd >= 0)
+         return true;
+   } // end for
+
+   return false;
+} // PerfCounters::available
+
+
+
+/// Returns if the counter of an event could be opened.
+///
+/// @param[in]  event  The event to check.
+/// @return  \c true if the event is counted.
+/// @since  1.47.0, 18.10.2026
+bool PerfCounters::available( PerfEvent event) const noexcept
+{
+   return mFds[ static_cast< size_t>( event)] >= 0;
+} // PerfCounters::available
+
+
+
+/// Reads the current values of all counters and the time.<br>
+/// If the kernel multiplexed a counter, its value is scaled to the time the
+/// counter was enabled.
+///
+/// @return  The current values.
+/// @since  1.47.0, 18.10.2026
+PerfCounterValues PerfCounters::read() const noexcept
+{
+
+   PerfCounterValues  result;
+
+
+   for (size_t idx = 0; idx < PerfCounterValues::NumEvents; ++idx)
+   {
+      if (mFds[ idx] < 0)
+         continue;
+
+      // value, time enabled, time running
+      uint64_t  data[ 3];
+      if (::read( mFds[ idx], data, sizeof( data)) != sizeof( data))
+         continue;
+
+      result.mAvailable[ idx] = true;
+      result.mValues[ idx] = ((data[ 2] == 0) || (data[ 1] == data[ 2]))
+         ? data[ 0]
+         : static_cast< uint64_t>( static_cast< double>( data[ 0])
+                                   * static_cast< double>( data[ 1])
+                                   / static_cast< double>( data[ 2]));
+   } // end for
+
+   result.mTime = std::chrono::duration_cast< std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch());
+
+   return result;
+} // PerfCounters::read
+
+
+
+} // namespace celma::common
+
+
+// =====  END OF perf_counters.cpp  =====
@@ -0,0 +1,193 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the module AdaptiveWait using the Boost.Test module.
+**
+--*/
+
+
+// module to test header file include
+#include "celma/common/adaptive_wait.hpp"
+
+
+// C++ Standard Library includes
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE TestAdaptiveWait
+#include <boost/test/unit_test.hpp>
+
+
+using celma::common::AdaptiveWait;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+
+
+/// The condition is already true: The wait must end while spinning.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( no_wait)
+{
+
+   AdaptiveWait  aw;
+
+
+   BOOST_REQUIRE_GE( AdaptiveWait::pausesPerMicrosecond(), 1);
+   BOOST_REQUIRE_EQUAL( aw.spinIterations(),
+                        5 * AdaptiveWait::pausesPerMicrosecond());
+
+   int  calls = 0;
+   aw.wait( [ &]() { return ++calls == 3; });
+   BOOST_REQUIRE_EQUAL( calls, 3);
+
+   auto  stats = aw.statistics();
+   BOOST_REQUIRE_EQUAL( stats.mNumWaits, 1);
+   BOOST_REQUIRE_EQUAL( stats.mNumSpinDone, 1);
+   BOOST_REQUIRE_EQUAL( stats.mNumYieldDone, 0);
+   BOOST_REQUIRE_EQUAL( stats.mNumParkDone, 0);
+   BOOST_REQUIRE_EQUAL( stats.mNumParks, 0);
+
+   // nobody is waiting
+   aw.notifyOne();
+   aw.notifyAll();
+
+   aw.resetStatistics();
+   stats = aw.statistics();
+   BOOST_REQUIRE_EQUAL( stats.mNumWaits, 0);
+   BOOST_REQUIRE_EQUAL( stats.mNumSpinDone, 0);
+   BOOST_REQUIRE_EQUAL( stats.mSpinTime.count(), 0);
+
+} // no_wait
+
+
+
+/// Without spinning and yielding, the consumer must park and be woken by the
+/// producer.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( park_and_notify)
+{
+
+   AdaptiveWait        aw( microseconds( 0), 0);
+   std::atomic< bool>  ready{ false};
+
+
+   BOOST_REQUIRE_EQUAL( aw.spinIterations(), 0);
+
+   std::thread  producer( [ &]()
+   {
+      std::this_thread::sleep_for( milliseconds( 50));
+      ready = true;
+      aw.notifyOne();
+   });
+
+   aw.wait( [ &]() { return ready.load(); });
+   producer.join();
+
+   const auto  stats = aw.statistics();
+   BOOST_REQUIRE_EQUAL( stats.mNumWaits, 1);
+   BOOST_REQUIRE_EQUAL( stats.mNumParkDone, 1);
+   BOOST_REQUIRE_GE( stats.mNumParks, 1);
+   BOOST_REQUIRE( stats.mParkTime >= milliseconds( 40));
+
+} // park_and_notify
+
+
+
+/// The wait ends after some yields.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( yield)
+{
+
+   AdaptiveWait  aw( microseconds( 0), 100);
+   int           calls = 0;
+
+
+   aw.wait( [ &]() { return ++calls == 10; });
+
+   const auto  stats = aw.statistics();
+   BOOST_REQUIRE_EQUAL( stats.mNumYieldDone, 1);
+   BOOST_REQUIRE_EQUAL( stats.mNumParks, 0);
+
+} // yield
+
+
+
+/// Multiple consumers, all woken by notifyAll(), then a stress test with
+/// producer and consumer.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( many_waiters)
+{
+
+   AdaptiveWait                                aw( microseconds( 1), 2);
+   std::atomic< bool>                          go{ false};
+   std::atomic< int>                           done{ 0};
+   std::vector< std::unique_ptr< std::thread>>  consumers;
+
+
+   for (int i = 0; i < 4; ++i)
+   {
+      consumers.push_back( std::make_unique< std::thread>( [ &]()
+      {
+         aw.wait( [ &]() { return go.load(); });
+         ++done;
+      }));
+   } // end for
+
+   std::this_thread::sleep_for( milliseconds( 20));
+   go = true;
+   aw.notifyAll();
+
+   for (auto& consumer : consumers)
+      consumer->join();
+
+   BOOST_REQUIRE_EQUAL( done.load(), 4);
+   BOOST_REQUIRE_EQUAL( aw.statistics().mNumWaits, 4);
+
+   // ping-pong: each value must be seen by the consumer
+   std::atomic< int>  value{ 0};
+   std::atomic< int>  seen{ 0};
+   AdaptiveWait       aw_back;
+   constexpr int      NumRounds = 10'000;
+
+   std::thread  consumer( [ &]()
+   {
+      for (int i = 1; i <= NumRounds; ++i)
+      {
+         aw.wait( [ &]() { return value.load() == i; });
+         seen = i;
+         aw_back.notifyOne();
+      } // end for
+   });
+
+   for (int i = 1; i <= NumRounds; ++i)
+   {
+      value = i;
+      aw.notifyOne();
+      aw_back.wait( [ &]() { return seen.load() == i; });
+   } // end for
+
+   consumer.join();
+   BOOST_REQUIRE_EQUAL( seen.load(), NumRounds);
+
+} // many_waiters
+
+
+
+// =====  END OF test_adaptive_wait_c.cpp  =====
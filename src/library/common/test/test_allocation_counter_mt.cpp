@@ -0,0 +1,129 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the allocation counter test helper, using the
+**    Boost.Test module.
+**
+--*/
+
+
+// C++ Standard Library includes
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE TestAllocationCounter
+#include <boost/test/unit_test.hpp>
+
+
+// project includes
+#include "celma/test/allocation_counter.hpp"
+
+
+using celma::test::AllocationScope;
+
+
+namespace {
+
+
+/// Keeps the allocated objects, so the compiler cannot omit the allocations.
+std::vector< std::unique_ptr< std::string>>  keep;
+
+
+} // namespace
+
+
+
+/// Allocations and their sizes must be counted.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( count_allocations)
+{
+
+   keep.reserve( 10);
+
+   AllocationScope  as;
+
+
+   BOOST_REQUIRE_EQUAL( as.allocations(), 0);
+
+   keep.push_back( std::make_unique< std::string>());
+   BOOST_REQUIRE_EQUAL( as.allocations(), 1);
+   BOOST_REQUIRE_EQUAL( as.bytes(), sizeof( std::string));
+
+   keep.push_back( std::make_unique< std::string>( 100, 'x'));
+   BOOST_REQUIRE_EQUAL( as.allocations(), 3);
+   BOOST_REQUIRE_GE( as.bytes(), sizeof( std::string) * 2 + 100);
+   BOOST_REQUIRE_EQUAL( as.deallocations(), 0);
+
+   keep.clear();
+   BOOST_REQUIRE_EQUAL( as.deallocations(), 3);
+
+   as.stop();
+   keep.push_back( std::make_unique< std::string>());
+   BOOST_REQUIRE_EQUAL( as.allocations(), 3);
+   keep.clear();
+
+} // count_allocations
+
+
+
+/// Test the check macros.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( check_macros)
+{
+
+   int  value = 0;
+
+
+   CHECK_NO_ALLOCATIONS( ++value);
+   REQUIRE_NO_ALLOCATIONS( ++value; value *= 2);
+   BOOST_REQUIRE_EQUAL( value, 4);
+
+   CHECK_ALLOCATIONS( 2, keep.push_back( std::make_unique< std::string>());
+                         keep.push_back( std::make_unique< std::string>()));
+   keep.clear();
+
+   CHECK_ALLOCATIONS( 1, auto  data = std::make_unique< int[]>( 10);
+                         data[ 0] = 1);
+
+} // check_macros
+
+
+
+/// Allocations of other threads must not be counted.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( other_thread)
+{
+
+   std::thread  worker;
+
+
+   CHECK_ALLOCATIONS( 1, worker = std::thread( []()
+   {
+      for (int i = 0; i < 10; ++i)
+         keep.push_back( std::make_unique< std::string>());
+   });
+                      worker.join());
+
+   BOOST_REQUIRE_EQUAL( keep.size(), 10);
+   keep.clear();
+
+} // other_thread
+
+
+
+// =====  END OF test_allocation_counter_mt.cpp  =====
@@ -0,0 +1,222 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the template celma::common::AsyncWriteBuffer, using the
+**    Boost.Test module.
+**
+--*/
+
+
+// module to test header file include
+#include "celma/common/async_write_buffer.hpp"
+
+
+// C++ Standard Library includes
+#include <chrono>
+#include <string>
+#include <thread>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE AsyncWriteBufferTest
+#include <boost/test/unit_test.hpp>
+
+
+using celma::common::AsyncWriteBuffer;
+using celma::common::WriteCountPolicy;
+
+
+namespace {
+
+
+/// Helper class to test the asynchronous write buffer: Collects all written
+/// data in a string.
+///
+/// @tparam  N  The size of the buffers.
+/// @tparam  B  The number of buffers.
+/// @since  1.47.0, 18.10.2026
+template< size_t N, size_t B = 2>
+   class TestAsyncWriteBuffer: public AsyncWriteBuffer< N, WriteCountPolicy, B>
+{
+public:
+   /// Destructor, has to call drain() to write the remaining data.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   ~TestAsyncWriteBuffer() override
+   {
+      try
+      {
+         this->drain();
+      } catch (...)
+      {
+      } // end try
+   } // TestAsyncWriteBuffer::~TestAsyncWriteBuffer
+
+   /// The data written so far, only access after drain().
+   mutable std::string            mWritten;
+   /// Number of times writeData() was called.
+   mutable int                    mWriteCalled = 0;
+   /// If set, each call of writeData() waits this long.
+   std::chrono::milliseconds      mDelay{ 0};
+   /// If set, the next call of writeData() throws.
+   mutable bool                   mFail = false;
+
+private:
+   /// Called to write the data to the destination.
+   ///
+   /// @param[in]  data  Pointer to the data to write.
+   /// @param[in]  len   The length of the data to write.
+   /// @since  1.47.0, 18.10.2026
+   void writeData( const unsigned char* const data, size_t len) const override
+   {
+      if (mDelay.count() > 0)
+         std::this_thread::sleep_for( mDelay);
+      if (mFail)
+      {
+         mFail = false;
+         throw std::runtime_error( "write failed");
+      } // end if
+      mWritten.append( reinterpret_cast< const char*>( data), len);
+      ++mWriteCalled;
+   } // TestAsyncWriteBuffer::writeData
+
+}; // TestAsyncWriteBuffer
+
+
+} // namespace
+
+
+
+/// Nothing is written when nothing was appended.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( empty_buffer)
+{
+
+   TestAsyncWriteBuffer< 100>  buff;
+
+
+   BOOST_REQUIRE_EQUAL( buff.buffered(), 0);
+   BOOST_REQUIRE_NO_THROW( buff.append( "huhu", 0));
+
+   char* dummy = nullptr;
+   BOOST_REQUIRE_THROW( buff.append( dummy, 10), std::runtime_error);
+
+   buff.drain();
+   BOOST_REQUIRE_EQUAL( buff.mWriteCalled, 0);
+   BOOST_REQUIRE_EQUAL( buff.numFlushCalled(), 0);
+
+} // empty_buffer
+
+
+
+/// Full buffers are written, the data must arrive in the order in which it was
+/// appended.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( data_in_order)
+{
+
+   TestAsyncWriteBuffer< 16, 3>  buff;
+   std::string                   expected;
+
+
+   for (int i = 0; i < 1'000; ++i)
+   {
+      const auto  text = std::to_string( i) + ",";
+      buff.append( text.c_str(), text.length());
+      expected.append( text);
+   } // end for
+
+   buff.drain();
+   BOOST_REQUIRE_EQUAL( buff.buffered(), 0);
+   BOOST_REQUIRE_EQUAL( buff.mWritten, expected);
+   BOOST_REQUIRE_EQUAL( buff.bytesAppended(), expected.length());
+   BOOST_REQUIRE_EQUAL( buff.bytesFlushed(), expected.length());
+   BOOST_REQUIRE_EQUAL( buff.numFlushCalled(), buff.mWriteCalled);
+
+} // data_in_order
+
+
+
+/// A data block larger than a buffer is split up.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( append_large)
+{
+
+   TestAsyncWriteBuffer< 10>  buff;
+   const std::string          data( "0123456789012345678901234567890123456789"
+                                    "01234");
+
+
+   buff.append( "ab", 2);
+   buff.append( data.c_str(), data.length());
+   BOOST_REQUIRE_EQUAL( buff.buffered(), 7);
+
+   buff.flush();
+   BOOST_REQUIRE_EQUAL( buff.buffered(), 0);
+
+   buff.drain();
+   BOOST_REQUIRE_EQUAL( buff.mWritten, "ab" + data);
+   BOOST_REQUIRE_EQUAL( buff.mWriteCalled, 5);
+
+} // append_large
+
+
+
+/// When the flusher is slower than the producer, the producer has to wait,
+/// which must be reported to the policy.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( stall_time)
+{
+
+   TestAsyncWriteBuffer< 10>  buff;
+
+
+   buff.mDelay = std::chrono::milliseconds( 20);
+
+   buff.append( "01234567890123456789012345678901234567890123456789", 50);
+   buff.drain();
+
+   BOOST_REQUIRE_EQUAL( buff.mWritten.length(), 50);
+   BOOST_REQUIRE_GE( buff.numStalls(), 1);
+   BOOST_REQUIRE( buff.stallTime() >= std::chrono::milliseconds( 10));
+
+} // stall_time
+
+
+
+/// An exception thrown by writeData() is reported to the producer.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( write_error)
+{
+
+   TestAsyncWriteBuffer< 10>  buff;
+
+
+   buff.mFail = true;
+   buff.append( "0123456789", 10);
+   BOOST_REQUIRE_THROW( buff.drain(), std::runtime_error);
+
+   // error was reported, following data is written again
+   buff.append( "abc", 3);
+   BOOST_REQUIRE_NO_THROW( buff.drain());
+   BOOST_REQUIRE_EQUAL( buff.mWritten, "abc");
+
+} // write_error
+
+
+
+// =====  END OF test_async_write_buffer_mt.cpp  =====
+
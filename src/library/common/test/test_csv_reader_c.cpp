@@ -0,0 +1,223 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the module CsvReader using the Boost.Test module.
+**
+--*/
+
+
+// module to test header file include
+#include "celma/common/csv_reader.hpp"
+
+
+// OS/C lib includes
+#include <unistd.h>
+
+
+// C++ Standard Library includes
+#include <fstream>
+#include <string>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE TestCsvReader
+#include <boost/test/unit_test.hpp>
+
+
+using celma::common::CsvColumnType;
+using celma::common::CsvReader;
+using celma::common::CsvSchema;
+using celma::common::CsvTable;
+
+
+namespace {
+
+
+/// The schema used for most tests.
+const CsvSchema  TestSchema = {
+   { "id",    CsvColumnType::int64 },
+   { "name",  CsvColumnType::string },
+   { "skip",  CsvColumnType::ignore },
+   { "value", CsvColumnType::float64 }
+};
+
+
+/// Creates a temporary file with the given contents, deletes the file at the
+/// end.
+///
+/// @since  1.47.0, 18.10.2026
+class TempFile
+{
+public:
+   /// Constructor, writes the file.
+   ///
+   /// @param[in]  contents  The data to write into the file.
+   /// @since  1.47.0, 18.10.2026
+   explicit TempFile( const std::string& contents):
+      mFileName( "/tmp/celma_csv_reader_" + std::to_string( ::getpid())
+                 + ".csv")
+   {
+      std::ofstream  ofs( mFileName);
+      ofs << contents;
+   } // TempFile::TempFile
+
+   /// Destructor, deletes the file.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   ~TempFile()
+   {
+      ::unlink( mFileName.c_str());
+   } // TempFile::~TempFile
+
+   /// The name of the file.
+   const std::string  mFileName;
+
+}; // TempFile
+
+
+} // namespace
+
+
+
+/// Parse single lines, with and without quotes.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( parse_lines)
+{
+
+   const CsvReader  reader( TestSchema);
+   CsvTable         table( TestSchema);
+
+
+   reader.parseLine( "1,first,x,1.5", table);
+   reader.parseLine( "+2,\"with, comma\",\"\",-2e3\r", table);
+   reader.parseLine( "3,\"quote \"\"inside\"\"\",,0", table);
+   reader.parseLine( "4,,,7", table);
+   reader.parseLine( "", table);
+
+   BOOST_REQUIRE_EQUAL( table.numRows(), 4);
+   BOOST_REQUIRE( table.int64Column( "id")
+                  == std::vector< int64_t>( { 1, 2, 3, 4 }));
+   BOOST_REQUIRE( table.float64Column( "value")
+                  == std::vector< double>( { 1.5, -2000.0, 0.0, 7.0 }));
+
+   auto const&  names = table.stringColumn( "name");
+   BOOST_REQUIRE_EQUAL( names.size(), 4);
+   BOOST_REQUIRE_EQUAL( names[ 0], "first");
+   BOOST_REQUIRE_EQUAL( names[ 1], "with, comma");
+   BOOST_REQUIRE_EQUAL( names[ 2], "quote \"inside\"");
+   BOOST_REQUIRE_EQUAL( names[ 3], "");
+
+   BOOST_REQUIRE_THROW( table.int64Column( "skip"), std::invalid_argument);
+   BOOST_REQUIRE_THROW( table.int64Column( "value"), std::invalid_argument);
+   BOOST_REQUIRE_THROW( table.stringColumn( "unknown"), std::invalid_argument);
+
+} // parse_lines
+
+
+
+/// Invalid data must be detected.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( errors)
+{
+
+   BOOST_REQUIRE_THROW( CsvReader{ CsvSchema()}, std::invalid_argument);
+   BOOST_REQUIRE_THROW( CsvReader( TestSchema, '"'), std::invalid_argument);
+
+   const CsvReader  reader( TestSchema);
+   CsvTable         table( TestSchema);
+
+   BOOST_REQUIRE_THROW( reader.parseLine( "1,a,b", table), std::runtime_error);
+   BOOST_REQUIRE_THROW( reader.parseLine( "1,a,b,2,3", table),
+                        std::runtime_error);
+   BOOST_REQUIRE_THROW( reader.parseLine( "x,a,b,2", table),
+                        std::runtime_error);
+   BOOST_REQUIRE_THROW( reader.parseLine( "1,a,b,2.5x", table),
+                        std::runtime_error);
+   BOOST_REQUIRE_THROW( reader.parseLine( "1,\"a,b,2", table),
+                        std::runtime_error);
+   BOOST_REQUIRE_THROW( reader.parseLine( "1,\"a\"b,c,2", table),
+                        std::runtime_error);
+
+   const TempFile  file( "1,a,b,2\n2,a,b\n");
+   try
+   {
+      reader.readFile( file.mFileName);
+      BOOST_FAIL( "exception expected");
+   } catch (const std::runtime_error& e)
+   {
+      BOOST_REQUIRE_EQUAL( std::string( e.what()).substr( 0, 7), "line 2:");
+   } // end try
+
+   BOOST_REQUIRE_THROW( reader.readFile( file.mFileName, 4), std::runtime_error);
+   BOOST_REQUIRE_THROW( reader.readFile( "/there/is/no/such/file"),
+                        std::runtime_error);
+
+} // errors
+
+
+
+/// Read a file sequentially and in parallel, the results must be the same.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( read_file)
+{
+
+   constexpr int  NumRows = 50'000;
+   std::string    contents( "id;name;skip;value\r\n");
+
+
+   for (int i = 0; i < NumRows; ++i)
+   {
+      contents.append( std::to_string( i)).append( ";");
+      if (i % 10 == 0)
+         contents.append( "\"name;").append( std::to_string( i)).append( "\"");
+      else
+         contents.append( "name").append( std::to_string( i));
+      contents.append( ";ignored;").append( std::to_string( i * 0.5));
+      contents.append( (i % 3 == 0) ? "\r\n" : "\n");
+      if (i % 1000 == 0)
+         contents.append( "\n");
+   } // end for
+
+   const TempFile   file( contents);
+   const CsvReader  reader( TestSchema, ';', true);
+
+   for (size_t num_threads : { 1, 2, 7, 0 })
+   {
+      const auto  table = reader.readFile( file.mFileName, num_threads);
+
+      BOOST_REQUIRE_EQUAL( table.numRows(), NumRows);
+
+      auto const&  ids = table.int64Column( "id");
+      auto const&  names = table.stringColumn( "name");
+      auto const&  values = table.float64Column( "value");
+
+      BOOST_REQUIRE_EQUAL( ids.size(), NumRows);
+      BOOST_REQUIRE_EQUAL( names.size(), NumRows);
+      BOOST_REQUIRE_EQUAL( values.size(), NumRows);
+
+      for (int i = 0; i < NumRows; ++i)
+      {
+         BOOST_REQUIRE_EQUAL( ids[ i], i);
+         BOOST_REQUIRE_EQUAL( names[ i], ((i % 10 == 0) ? "name;" : "name")
+                                         + std::to_string( i));
+         BOOST_REQUIRE_EQUAL( values[ i], i * 0.5);
+      } // end for
+   } // end for
+
+} // read_file
+
+
+
+// =====  END OF test_csv_reader_c.cpp  =====
+
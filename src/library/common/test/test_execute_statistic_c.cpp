@@ -20,7 +20,10 @@
 
 
 // C++ Standard Library includes
+#include <chrono>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 
 // Boost includes
@@ -193,13 +196,101 @@ BOOST_AUTO_TEST_CASE( check_output)
    if (TestEnvironment::object().argC() > 1)
    {
       BOOST_REQUIRE( celma::test::multilineStringCompare( oss.str(),
-         "src/library/common/test/test_execute_statistic_c.cpp: basic_execute_statistic::test_method[104] = 0\n"
-         "src/library/common/test/test_execute_statistic_c.cpp: two_call_points::test_method[129] = 1\n"
-         "src/library/common/test/test_execute_statistic_c.cpp: two_call_points::test_method[138] = 3\n"));
+         "src/library/common/test/test_execute_statistic_c.cpp: basic_execute_statistic::test_method[107] = 0\n"
+         "src/library/common/test/test_execute_statistic_c.cpp: two_call_points::test_method[132] = 1\n"
+         "src/library/common/test/test_execute_statistic_c.cpp: two_call_points::test_method[141] = 3\n"));
    } // end if
 
 } // check_output
 
 
 
+/// Count executions in multiple threads: No execution must get lost.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( multiple_threads)
+{
+
+   constexpr int              NumThreads = 8;
+   constexpr int              NumLoops = 100'000;
+   std::vector< std::thread>  threads;
+
+
+   ExecuteStatistic::instance().reset();
+
+   for (int i = 0; i < NumThreads; ++i)
+   {
+      threads.emplace_back( []()
+      {
+         for (int j = 0; j < NumLoops; ++j)
+         {
+            COUNT_EXECUTIONS;
+         } // end for
+      });
+   } // end for
+
+   for (auto& t : threads)
+      t.join();
+
+   // the call point is in the lambda, which has its own function name
+   size_t  max_executions = 0;
+   for (auto it = ExecuteStatistic::instance().begin();
+        it != ExecuteStatistic::instance().end(); ++it)
+   {
+      max_executions = std::max( max_executions, (*it).second);
+   } // end for
+
+   BOOST_REQUIRE_EQUAL( max_executions, NumThreads * NumLoops);
+
+} // multiple_threads
+
+
+
+/// Profile a scope: Counts and times must be recorded, the report must list
+/// the slowest call point first.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( profile_scope)
+{
+
+   for (int i = 0; i < 5; ++i)
+   {
+      PROFILE_SCOPE;
+      std::this_thread::sleep_for( std::chrono::milliseconds( 2));
+   } // end for
+
+   const auto  executions = GET_EXECUTIONS();
+   BOOST_REQUIRE_EQUAL( executions, 5);
+
+   const celma::common::ExecuteCallPoint*  profiled = nullptr;
+   for (auto it = ExecuteStatistic::instance().begin();
+        it != ExecuteStatistic::instance().end(); ++it)
+   {
+      if (std::get< 1>( it.key()) == "profile_scope::test_method")
+         profiled = &it.callPoint();
+   } // end for
+
+   BOOST_REQUIRE( profiled != nullptr);
+   BOOST_REQUIRE_EQUAL( profiled->executions(), 5);
+   BOOST_REQUIRE( profiled->totalTime() >= std::chrono::milliseconds( 9));
+   BOOST_REQUIRE_GE( profiled->timePercentile( 50.0), 1'000'000);
+   BOOST_REQUIRE_LE( profiled->timePercentile( 50.0),
+                     profiled->timePercentile( 99.0));
+
+   std::ostringstream  oss;
+   ExecuteStatistic::instance().printProfile( oss);
+   BOOST_TEST_MESSAGE( oss.str());
+
+   std::istringstream  iss( oss.str());
+   std::string         line;
+   std::getline( iss, line);
+   BOOST_REQUIRE_EQUAL( line.substr( 0, 12), "  Total [ms]");
+   std::getline( iss, line);
+   std::getline( iss, line);
+   BOOST_REQUIRE( line.find( "profile_scope") != std::string::npos);
+
+} // profile_scope
+
+
+
 // =====  END OF test_execute_statistic.cpp  =====
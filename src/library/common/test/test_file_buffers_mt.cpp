@@ -0,0 +1,211 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the templates celma::common::FileReadBuffer and
+**    celma::common::FileWriteBuffer, using the Boost.Test module.
+**
+--*/
+
+
+// module to test header file includes
+#include "celma/common/file_read_buffer.hpp"
+#include "celma/common/file_write_buffer.hpp"
+
+
+// OS/C lib includes
+#include <unistd.h>
+
+
+// C++ Standard Library includes
+#include <string>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE FileBuffersTest
+#include <boost/test/unit_test.hpp>
+
+
+using celma::common::EmptyReadPolicy;
+using celma::common::FileReadBuffer;
+using celma::common::FileWriteBuffer;
+using celma::common::ReadCountPolicy;
+using celma::common::WriteCountPolicy;
+
+
+namespace {
+
+
+/// Number of lines to write into the test file.
+constexpr int  NumLines = 20'000;
+
+
+/// Returns the name of the test file.
+///
+/// @return  Path and name of the test file.
+/// @since  1.47.0, 18.10.2026
+std::string testFileName()
+{
+   return "/tmp/celma_file_buffers_" + std::to_string( ::getpid()) + ".txt";
+} // testFileName
+
+
+/// Returns the text of the line with the given number.
+///
+/// @param[in]  line_nbr  The number of the line.
+/// @return  The text of the line, without newline.
+/// @since  1.47.0, 18.10.2026
+std::string lineText( int line_nbr)
+{
+   return "line " + std::to_string( line_nbr) + " of the test file";
+} // lineText
+
+
+/// Writes the test file.
+///
+/// @param[in]  direct  Set to write the file with direct I/O.
+/// @return  The number of bytes written.
+/// @since  1.47.0, 18.10.2026
+size_t writeTestFile( bool direct)
+{
+
+   FileWriteBuffer< 8192, WriteCountPolicy>  fwb( testFileName(), direct);
+
+
+   for (int i = 0; i < NumLines; ++i)
+   {
+      const auto  line = lineText( i) + "\n";
+      fwb.append( line.c_str(), line.length());
+   } // end for
+
+   fwb.drain();
+   BOOST_REQUIRE_EQUAL( fwb.bytesFlushed(), fwb.bytesAppended());
+
+   return fwb.bytesFlushed();
+} // writeTestFile
+
+
+/// Reads the test file line by line and checks the contents.
+///
+/// @param[in]  direct      Set to read the file with direct I/O.
+/// @param[in]  file_size   The expected size of the file.
+/// @since  1.47.0, 18.10.2026
+void checkTestFile( bool direct, size_t file_size)
+{
+
+   FileReadBuffer< 1000, ReadCountPolicy>  frb( testFileName(), direct);
+
+
+   BOOST_REQUIRE_EQUAL( frb.fileSize(), file_size);
+
+   for (int i = 0; i < NumLines; ++i)
+   {
+      BOOST_REQUIRE_EQUAL( frb.readUntil( '\n'), lineText( i));
+   } // end for
+
+   BOOST_REQUIRE( frb.atEnd());
+   BOOST_REQUIRE_EQUAL( frb.bytesReadFromSource(), file_size);
+
+   char  dummy[ 4];
+   BOOST_REQUIRE_THROW( frb.get( dummy, 4), std::runtime_error);
+
+} // checkTestFile
+
+
+} // namespace
+
+
+
+/// Write and read a file with normal I/O.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( buffered_io)
+{
+
+   const auto  file_size = writeTestFile( false);
+
+
+   checkTestFile( false, file_size);
+   ::unlink( testFileName().c_str());
+
+} // buffered_io
+
+
+
+/// Write and read a file with direct I/O. If the file system does not support
+/// direct I/O, the file is written and read normally.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( direct_io)
+{
+
+   const auto  file_size = writeTestFile( true);
+
+
+   checkTestFile( true, file_size);
+   checkTestFile( false, file_size);
+   ::unlink( testFileName().c_str());
+
+} // direct_io
+
+
+
+/// Direct I/O with only one block read ahead, and with the object destroyed
+/// while the reader thread is still reading.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( direct_read_ahead)
+{
+
+   writeTestFile( false);
+
+   {
+      FileReadBuffer< 1000, EmptyReadPolicy, 1>  frb( testFileName(), true);
+
+      for (int i = 0; i < NumLines; ++i)
+      {
+         BOOST_REQUIRE_EQUAL( frb.readUntil( '\n'), lineText( i));
+      } // end for
+      BOOST_REQUIRE( frb.atEnd());
+   } // end scope
+
+   {
+      FileReadBuffer< 1000, EmptyReadPolicy, 8>  frb( testFileName(), true);
+
+      BOOST_REQUIRE_EQUAL( frb.readUntil( '\n'), lineText( 0));
+   } // end scope
+
+   ::unlink( testFileName().c_str());
+
+} // direct_read_ahead
+
+
+
+/// Errors: Invalid buffer size for direct I/O, file that does not exist.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( errors)
+{
+
+   using invalid_direct = FileWriteBuffer< 1000>;
+
+   BOOST_REQUIRE_THROW( invalid_direct( testFileName(), true),
+                        std::invalid_argument);
+   BOOST_REQUIRE_THROW( FileReadBuffer< 1000>( "/does/not/exist"),
+                        std::runtime_error);
+   BOOST_REQUIRE_THROW( FileWriteBuffer< 1000>( "/does/not/exist"),
+                        std::runtime_error);
+
+} // errors
+
+
+
+// =====  END OF test_file_buffers_mt.cpp  =====
+
@@ -0,0 +1,179 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the module LatencyHistogram using the Boost.Test module.
+**
+--*/
+
+
+// module to test header file include
+#include "celma/common/latency_histogram.hpp"
+
+
+// C++ Standard Library includes
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <thread>
+#include <vector>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE TestLatencyHistogram
+#include <boost/test/unit_test.hpp>
+
+
+using celma::common::HistogramBuckets;
+using celma::common::HistogramRecorder;
+using celma::common::HistogramSnapshot;
+using celma::common::LatencyHistogram;
+
+
+
+/// Check the bucket layout: Each value must lie within the bounds of its
+/// bucket, the buckets must be contiguous, and the relative error is limited.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( bucket_layout)
+{
+
+   BOOST_REQUIRE_EQUAL( HistogramBuckets::index( 0), 0);
+   BOOST_REQUIRE_EQUAL( HistogramBuckets::index( 127), 127);
+   BOOST_REQUIRE_EQUAL( HistogramBuckets::index( 128), 128);
+   BOOST_REQUIRE_EQUAL( HistogramBuckets::index( 129), 128);
+   BOOST_REQUIRE_EQUAL( HistogramBuckets::index(
+      std::numeric_limits< uint64_t>::max()), HistogramBuckets::NumBuckets - 1);
+
+   for (size_t idx = 1; idx < HistogramBuckets::NumBuckets; ++idx)
+   {
+      BOOST_REQUIRE_EQUAL( HistogramBuckets::lowerBound( idx),
+                           HistogramBuckets::upperBound( idx - 1) + 1);
+      BOOST_REQUIRE_EQUAL( HistogramBuckets::index(
+         HistogramBuckets::lowerBound( idx)), idx);
+      BOOST_REQUIRE_EQUAL( HistogramBuckets::index(
+         HistogramBuckets::upperBound( idx)), idx);
+
+      const auto  low = HistogramBuckets::lowerBound( idx);
+      const auto  width = HistogramBuckets::upperBound( idx) - low + 1;
+      BOOST_REQUIRE_LE( width * 64, std::max< uint64_t>( low, 64));
+   } // end for
+
+   BOOST_REQUIRE_EQUAL( HistogramBuckets::upperBound(
+      HistogramBuckets::NumBuckets - 1), std::numeric_limits< uint64_t>::max());
+
+} // bucket_layout
+
+
+
+/// Percentiles of a known distribution.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( percentiles)
+{
+
+   HistogramSnapshot  empty;
+
+
+   BOOST_REQUIRE_EQUAL( empty.count(), 0);
+   BOOST_REQUIRE_EQUAL( empty.min(), 0);
+   BOOST_REQUIRE_EQUAL( empty.max(), 0);
+   BOOST_REQUIRE_EQUAL( empty.mean(), 0.0);
+   BOOST_REQUIRE_EQUAL( empty.percentile( 99.0), 0);
+   BOOST_REQUIRE( empty.buckets().empty());
+
+   HistogramRecorder  rec;
+   for (uint64_t value = 1; value <= 100; ++value)
+      rec.record( value);
+   // a single outlier
+   rec.record( std::chrono::nanoseconds( 1'000'000));
+
+   HistogramSnapshot  snap;
+   snap.merge( rec);
+
+   BOOST_REQUIRE_EQUAL( snap.count(), 101);
+   BOOST_REQUIRE_EQUAL( snap.min(), 1);
+   BOOST_REQUIRE_EQUAL( snap.max(), 1'000'000);
+   BOOST_REQUIRE_CLOSE( snap.mean(), (5050.0 + 1'000'000.0) / 101.0, 0.0001);
+   BOOST_REQUIRE_EQUAL( snap.percentile( 0.0), 1);
+   BOOST_REQUIRE_EQUAL( snap.percentile( 50.0), 51);
+   BOOST_REQUIRE_EQUAL( snap.percentile( 99.0), 100);
+   BOOST_REQUIRE_EQUAL( snap.percentile( 100.0), 1'000'000);
+
+   const auto  buckets = snap.buckets();
+   BOOST_REQUIRE_EQUAL( buckets.size(), 101);
+   BOOST_REQUIRE_EQUAL( buckets.back().mCount, 1);
+   BOOST_REQUIRE_LE( buckets.back().mLow, 1'000'000);
+   BOOST_REQUIRE_GE( buckets.back().mHigh, 1'000'000);
+
+   // same value multiple times
+   HistogramRecorder  rec2;
+   rec2.record( 5000, 99);
+   rec2.record( 7000);
+   HistogramSnapshot  snap2;
+   snap2.merge( rec2);
+   BOOST_REQUIRE_EQUAL( snap2.count(), 100);
+   BOOST_REQUIRE_GE( snap2.percentile( 99.0), 5000);
+   BOOST_REQUIRE_LE( snap2.percentile( 99.0), 5000 + 5000 / 64);
+   BOOST_REQUIRE_EQUAL( snap2.percentile( 99.9), 7000);
+
+   snap2.merge( snap);
+   BOOST_REQUIRE_EQUAL( snap2.count(), 201);
+   BOOST_REQUIRE_EQUAL( snap2.min(), 1);
+   BOOST_REQUIRE_EQUAL( snap2.max(), 1'000'000);
+
+} // percentiles
+
+
+
+/// Record in multiple threads while taking snapshots.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( multiple_threads)
+{
+
+   constexpr int              NumThreads = 4;
+   constexpr uint64_t         NumValues = 100'000;
+   LatencyHistogram           histogram;
+   std::atomic< int>          num_done{ 0};
+   std::vector< std::thread>  threads;
+
+
+   for (int i = 0; i < NumThreads; ++i)
+   {
+      threads.emplace_back( [ &, i]()
+      {
+         auto&  rec = histogram.createRecorder();
+         for (uint64_t value = 0; value < NumValues; ++value)
+            rec.record( value * (i + 1));
+         ++num_done;
+      });
+   } // end for
+
+   while (num_done.load() < NumThreads)
+   {
+      const auto  snap = histogram.snapshot();
+      BOOST_REQUIRE_LE( snap.count(), NumThreads * NumValues);
+      BOOST_REQUIRE_LE( snap.min(), snap.max());
+   } // end while
+
+   for (auto& t : threads)
+      t.join();
+
+   const auto  snap = histogram.snapshot();
+   BOOST_REQUIRE_EQUAL( snap.count(), NumThreads * NumValues);
+   BOOST_REQUIRE_EQUAL( snap.min(), 0);
+   BOOST_REQUIRE_EQUAL( snap.max(), (NumValues - 1) * NumThreads);
+
+} // multiple_threads
+
+
+
+// =====  END OF test_latency_histogram_c.cpp  =====
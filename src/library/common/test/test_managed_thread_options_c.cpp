@@ -0,0 +1,185 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the thread options of the module ManagedThread, using
+**    the Boost.Test module.
+**
+--*/
+
+
+// module to test header file include
+#include "celma/common/managed_thread.hpp"
+
+
+// OS/C lib includes
+#include <pthread.h>
+#include <sched.h>
+
+
+// C++ Standard Library includes
+#include <atomic>
+#include <cerrno>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE ManagedThreadOptionsTest
+#include <boost/test/unit_test.hpp>
+
+
+using celma::common::ManagedThread;
+using celma::common::ThreadOptions;
+
+
+
+/// Name the thread and bind it to a CPU.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( name_and_affinity)
+{
+
+   ThreadOptions  options;
+   std::string    name;
+   int            num_cpus = 0;
+   int            cpu = -2;
+   int            node = -2;
+
+
+   options.mName = "celma-test-thread-name";
+   options.mCpus = { 0 };
+
+   {
+      ManagedThread  mt( options, [ &]( int param)
+      {
+         char  buffer[ 16];
+         ::pthread_getname_np( ::pthread_self(), buffer, sizeof( buffer));
+         name = buffer;
+
+         cpu_set_t  cpus;
+         ::pthread_getaffinity_np( ::pthread_self(), sizeof( cpus), &cpus);
+         num_cpus = CPU_COUNT( &cpus) * param;
+
+         cpu = ManagedThread::currentCpu();
+         node = ManagedThread::currentNumaNode();
+      }, 1);
+   } // end scope
+
+   BOOST_REQUIRE_EQUAL( name, "celma-test-thre");
+   BOOST_REQUIRE_EQUAL( num_cpus, 1);
+   BOOST_REQUIRE_EQUAL( cpu, 0);
+   BOOST_REQUIRE_GE( node, 0);
+
+} // name_and_affinity
+
+
+
+/// Set the scheduling policy.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( scheduling)
+{
+
+   ThreadOptions  options;
+   int            policy = -1;
+
+
+   options.mSchedPolicy = SCHED_BATCH;
+
+   {
+      ManagedThread  mt( options, [ &]()
+      {
+         sched_param  param;
+         ::pthread_getschedparam( ::pthread_self(), &policy, &param);
+      });
+   } // end scope
+
+   BOOST_REQUIRE_EQUAL( policy, SCHED_BATCH);
+
+} // scheduling
+
+
+
+/// Use NUMA-local memory allocation. May not be allowed in a container.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( numa_local)
+{
+
+   ThreadOptions  options;
+   bool           called = false;
+
+
+   options.mNumaLocal = true;
+
+   try
+   {
+      ManagedThread  mt( options, [ &]() { called = true; });
+   } catch (const std::system_error& e)
+   {
+      BOOST_TEST_MESSAGE( "NUMA memory policy not available: " << e.what());
+      BOOST_REQUIRE( (e.code().value() == EPERM)
+                     || (e.code().value() == ENOSYS));
+      return;
+   } // end try
+
+   BOOST_REQUIRE( called);
+
+} // numa_local
+
+
+
+/// Invalid options must be reported by the constructor, the thread function
+/// must not be called then.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( errors)
+{
+
+   std::atomic< int>  calls{ 0};
+   auto               func = [ &]() { ++calls; };
+
+
+   {
+      ThreadOptions  options;
+      options.mCpus = { -1 };
+      BOOST_REQUIRE_THROW( ManagedThread( options, func), std::invalid_argument);
+   } // end scope
+
+   {
+      ThreadOptions  options;
+      options.mCpus = { CPU_SETSIZE };
+      BOOST_REQUIRE_THROW( ManagedThread( options, func), std::invalid_argument);
+   } // end scope
+
+   {
+      // SCHED_OTHER only supports priority 0
+      ThreadOptions  options;
+      options.mSchedPolicy = SCHED_OTHER;
+      options.mSchedPriority = 5;
+      BOOST_REQUIRE_THROW( ManagedThread( options, func), std::system_error);
+   } // end scope
+
+   BOOST_REQUIRE_EQUAL( calls.load(), 0);
+
+   {
+      ManagedThread  mt( ThreadOptions(), func);
+      BOOST_REQUIRE( mt.joinable());
+   } // end scope
+
+   BOOST_REQUIRE_EQUAL( calls.load(), 1);
+
+} // errors
+
+
+
+// =====  END OF test_managed_thread_options_c.cpp  =====
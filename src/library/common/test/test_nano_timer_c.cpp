@@ -0,0 +1,180 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the modules NanoTimer, TimerStatistics, ScopeTimer and
+**    TscClock using the Boost.Test module.
+**
+--*/
+
+
+// module to test header file include
+#include "celma/common/nano_timer.hpp"
+
+
+// C++ Standard Library includes
+#include <chrono>
+#include <thread>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE TestNanoTimer
+#include <boost/test/unit_test.hpp>
+
+
+// project includes
+#include "celma/common/micro_timer.hpp"
+#include "celma/common/tsc_clock.hpp"
+#include "celma/test/measure.hpp"
+
+
+using celma::common::NanoTimer;
+using celma::common::ScopeTimer;
+using celma::common::TimerStatistics;
+using celma::common::TscClock;
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
+
+
+
+/// Statistics with known values.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( statistics)
+{
+
+   TimerStatistics  stats;
+
+
+   BOOST_REQUIRE_EQUAL( stats.count(), 0);
+   BOOST_REQUIRE_EQUAL( stats.min().count(), 0);
+   BOOST_REQUIRE_EQUAL( stats.max().count(), 0);
+   BOOST_REQUIRE_EQUAL( stats.mean(), 0.0);
+   BOOST_REQUIRE_EQUAL( stats.stddev(), 0.0);
+
+   stats.add( nanoseconds( 10));
+   BOOST_REQUIRE_EQUAL( stats.stddev(), 0.0);
+
+   for (auto value : { 20, 30, 40, 50 })
+      stats.add( nanoseconds( value));
+
+   BOOST_REQUIRE_EQUAL( stats.count(), 5);
+   BOOST_REQUIRE_EQUAL( stats.sum().count(), 150);
+   BOOST_REQUIRE_EQUAL( stats.min().count(), 10);
+   BOOST_REQUIRE_EQUAL( stats.max().count(), 50);
+   BOOST_REQUIRE_CLOSE( stats.mean(), 30.0, 0.0001);
+   // sample variance = 1000 / 4
+   BOOST_REQUIRE_CLOSE( stats.stddev(), 15.811388, 0.0001);
+
+   stats.reset();
+   BOOST_REQUIRE_EQUAL( stats.count(), 0);
+   BOOST_REQUIRE_EQUAL( stats.sum().count(), 0);
+   BOOST_REQUIRE_EQUAL( stats.min().count(), 0);
+
+} // statistics
+
+
+
+/// Timers with steady_clock and the TSC.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( timers)
+{
+
+   NanoTimer<>  nt;
+
+
+   BOOST_REQUIRE( !nt.started());
+   BOOST_REQUIRE( !nt.stopped());
+
+   nt.start();
+   BOOST_REQUIRE( nt.started());
+   std::this_thread::sleep_for( milliseconds( 10));
+   BOOST_REQUIRE( nt.elapsed() >= milliseconds( 10));
+   nt.stop();
+   BOOST_REQUIRE( nt.stopped());
+   BOOST_REQUIRE( nt.timed() >= milliseconds( 10));
+   BOOST_REQUIRE( nt.timed() < milliseconds( 1000));
+
+   const auto  per_sec = celma::common::avgPerSecond( 100, nt);
+   BOOST_REQUIRE( (per_sec > 100.0) && (per_sec <= 10'000.0));
+   BOOST_REQUIRE_EQUAL( celma::common::avgPerSecond( 100, nanoseconds( 0)),
+                        0.0);
+
+   BOOST_TEST_MESSAGE( "invariant TSC: " << TscClock::available()
+                       << ", " << TscClock::ticksPerMicrosecond() << " MHz");
+   BOOST_REQUIRE_GT( TscClock::ticksPerMicrosecond(), 0.0);
+
+   NanoTimer< TscClock>  tt;
+   tt.start();
+   std::this_thread::sleep_for( milliseconds( 10));
+   tt.stop();
+   BOOST_REQUIRE( tt.timed() >= milliseconds( 9));
+   BOOST_REQUIRE( tt.timed() < milliseconds( 1000));
+
+   const auto  start = TscClock::now();
+   BOOST_REQUIRE( TscClock::now() >= start);
+
+} // timers
+
+
+
+/// The scope timer and the measure functions.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( scope_timer)
+{
+
+   TimerStatistics  stats;
+
+
+   for (int i = 0; i < 3; ++i)
+   {
+      ScopeTimer< TscClock>  st( stats);
+      std::this_thread::sleep_for( milliseconds( 1));
+   } // end for
+
+   BOOST_REQUIRE_EQUAL( stats.count(), 3);
+   BOOST_REQUIRE( stats.min() >= nanoseconds( 900'000));
+   BOOST_REQUIRE( stats.max() >= stats.min());
+
+   int   calls = 0;
+   auto  result = celma::test::measureEach< TscClock>( 1000, "increment",
+                                                      [ &]() { ++calls; });
+   BOOST_REQUIRE_EQUAL( calls, 1000);
+   BOOST_REQUIRE_EQUAL( result.count(), 1000);
+
+   celma::test::measure( 1000, "increment", [ &]() { ++calls; });
+   BOOST_REQUIRE_EQUAL( calls, 2000);
+
+} // scope_timer
+
+
+
+/// AverageMicroTimer must not divide by zero.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( average_micro_timer)
+{
+
+   celma::common::AverageMicroTimer  amt;
+
+
+   BOOST_REQUIRE_EQUAL( amt.averageTime(), 0);
+
+   amt.start();
+   amt.stop();
+   BOOST_REQUIRE_EQUAL( amt.numTimers(), 1);
+
+} // average_micro_timer
+
+
+
+// =====  END OF test_nano_timer_c.cpp  =====
@@ -3,7 +3,7 @@
 **
 **    ####   ######  #       #    #   ####
 **   #    #  #       #       ##  ##  #    #
-**   #       ###     #       # ## #  ######    (C) 2018-2019 Rene Eng
+**   #       ###     #       # ## #  ######    (C) 2018-2026 Rene Eng
 **   #    #  #       #       #    #  #    #        LGPL
 **    ####   ######  ######  #    #  #    #
 **
@@ -19,12 +19,19 @@
 #include "celma/common/object_counter.hpp"
 
 
+// C++ Standard Library includes
+#include <sstream>
+#include <vector>
+
+
 // Boost includes
 #define BOOST_TEST_MODULE ObjectCounterTest
 #include <boost/test/unit_test.hpp>
 
 
 using celma::common::ObjectCounter;
+using celma::common::ObjectCounterRegistry;
+using celma::common::PlainCountPolicy;
 
 
 namespace {
@@ -46,6 +53,26 @@ class CountedTwo: public ObjectCounter< CountedTwo>
 }; // CountedTwo
 
 
+/// Helper class with a known size, for testing the peak and the bytes.
+///
+/// @since  1.47.0, 18.10.2026
+class CountedSized: public ObjectCounter< CountedSized>
+{
+public:
+   /// Some data, to get a size larger than 1.
+   char  mData[ 24];
+}; // CountedSized
+
+
+/// Helper class using the counting policy without synchronisation.
+///
+/// @since  1.47.0, 18.10.2026
+class CountedPlain: public ObjectCounter< CountedPlain, uint32_t,
+                                          PlainCountPolicy< uint32_t>>
+{
+}; // CountedPlain
+
+
 /// For testing the move constructor: Move-returns a new object.
 ///
 /// @return  A new CountedOne object.
@@ -182,5 +209,86 @@ BOOST_AUTO_TEST_CASE( classes_independent)
 
 
 
+/// Check the peak and the bytes used by the objects.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( peak_and_bytes)
+{
+
+   BOOST_REQUIRE_EQUAL( CountedSized::numObjects(), 0);
+   BOOST_REQUIRE_EQUAL( CountedSized::peakObjects(), 0);
+
+   {
+      std::vector< CountedSized>  objects( 5);
+
+      BOOST_REQUIRE_EQUAL( CountedSized::numObjects(), 5);
+      BOOST_REQUIRE_EQUAL( CountedSized::peakObjects(), 5);
+      BOOST_REQUIRE_EQUAL( CountedSized::numBytes(), 5 * sizeof( CountedSized));
+
+      objects.resize( 2);
+      BOOST_REQUIRE_EQUAL( CountedSized::numObjects(), 2);
+      BOOST_REQUIRE_EQUAL( CountedSized::peakObjects(), 5);
+      BOOST_REQUIRE_EQUAL( CountedSized::numBytes(), 2 * sizeof( CountedSized));
+      BOOST_REQUIRE_EQUAL( CountedSized::peakBytes(), 5 * sizeof( CountedSized));
+
+      CountedSized::resetPeak();
+      BOOST_REQUIRE_EQUAL( CountedSized::peakObjects(), 2);
+   } // end scope
+
+   BOOST_REQUIRE_EQUAL( CountedSized::numObjects(), 0);
+   BOOST_REQUIRE_EQUAL( CountedSized::peakObjects(), 2);
+
+   {
+      CountedPlain  p1;
+      CountedPlain  p2( p1);
+
+      BOOST_REQUIRE_EQUAL( CountedPlain::numObjects(), 2);
+   } // end scope
+
+   BOOST_REQUIRE_EQUAL( CountedPlain::numObjects(), 0);
+   BOOST_REQUIRE_EQUAL( CountedPlain::peakObjects(), 2);
+
+} // peak_and_bytes
+
+
+
+/// The registry must contain all classes of which objects were created.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( registry)
+{
+
+   CountedSized        keep;
+   const auto          counts = ObjectCounterRegistry::instance().counts();
+
+
+   bool  found = false;
+   for (const auto& info : counts)
+   {
+      if (info.mTypeName.find( "CountedSized") == std::string::npos)
+         continue;   // for
+
+      found = true;
+      BOOST_REQUIRE_EQUAL( info.mTypeName, "(anonymous namespace)::CountedSized");
+      BOOST_REQUIRE_EQUAL( info.mObjectSize, sizeof( CountedSized));
+      BOOST_REQUIRE_EQUAL( info.mNumObjects, 1);
+      BOOST_REQUIRE_GE( info.mPeakObjects, 1);
+      BOOST_REQUIRE_EQUAL( info.numBytes(), sizeof( CountedSized));
+   } // end for
+   BOOST_REQUIRE( found);
+
+   for (size_t i = 1; i < counts.size(); ++i)
+      BOOST_REQUIRE( counts[ i - 1].mTypeName <= counts[ i].mTypeName);
+
+   std::ostringstream  oss;
+   ObjectCounterRegistry::instance().print( oss);
+   BOOST_TEST_MESSAGE( oss.str());
+   BOOST_REQUIRE( oss.str().find( "CountedSized") != std::string::npos);
+   BOOST_REQUIRE( oss.str().find( "CountedPlain") != std::string::npos);
+
+} // registry
+
+
+
 // =====  END OF test_object_counter.cpp  =====
 
@@ -0,0 +1,136 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the thread-safe counting policies of the module
+**    celma::common::ObjectCounter, using the Boost.Test framework.
+**
+--*/
+
+
+// module to test, header file include
+#include "celma/common/object_counter.hpp"
+
+
+// C++ Standard Library includes
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE ObjectCounterMtTest
+#include <boost/test/unit_test.hpp>
+
+
+using celma::common::ObjectCounter;
+using celma::common::ShardedCountPolicy;
+
+
+namespace {
+
+
+/// Number of threads to start.
+constexpr int  NumThreads = 8;
+/// Number of objects each thread creates.
+constexpr int  NumObjects = 10'000;
+
+
+/// Class counted with the default, atomic policy.
+///
+/// @since  1.47.0, 18.10.2026
+class CountedAtomic: public ObjectCounter< CountedAtomic>
+{
+}; // CountedAtomic
+
+
+/// Class counted with the sharded policy.
+///
+/// @since  1.47.0, 18.10.2026
+class CountedSharded: public ObjectCounter< CountedSharded, uint64_t,
+                                            ShardedCountPolicy< uint64_t>>
+{
+}; // CountedSharded
+
+
+/// Creates objects in multiple threads and keeps them, then destroys them in
+/// other threads than those that created them.
+///
+/// @tparam  T  The counted class to create objects of.
+/// @since  1.47.0, 18.10.2026
+template< typename T> void createAndDestroy()
+{
+
+   std::vector< std::vector< std::unique_ptr< T>>>  objects( NumThreads);
+   std::vector< std::thread>                        threads;
+
+
+   for (int t = 0; t < NumThreads; ++t)
+   {
+      threads.emplace_back( [&objects, t]()
+      {
+         for (int i = 0; i < NumObjects; ++i)
+            objects[ t].emplace_back( new T());
+      });
+   } // end for
+
+   for (auto& thread : threads)
+      thread.join();
+
+   BOOST_REQUIRE_EQUAL( T::numObjects(), NumThreads * NumObjects);
+   BOOST_REQUIRE_EQUAL( T::peakObjects(), NumThreads * NumObjects);
+
+   threads.clear();
+   for (int t = 0; t < NumThreads; ++t)
+   {
+      threads.emplace_back( [&objects, t]()
+      {
+         objects[ (t + 1) % NumThreads].clear();
+      });
+   } // end for
+
+   for (auto& thread : threads)
+      thread.join();
+
+   BOOST_REQUIRE_EQUAL( T::numObjects(), 0);
+   BOOST_REQUIRE_EQUAL( T::peakObjects(), NumThreads * NumObjects);
+
+} // createAndDestroy
+
+
+} // namespace
+
+
+
+/// Count the objects with the atomic policy.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( atomic_policy)
+{
+
+   createAndDestroy< CountedAtomic>();
+
+} // atomic_policy
+
+
+
+/// Count the objects with the sharded policy.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( sharded_policy)
+{
+
+   createAndDestroy< CountedSharded>();
+
+} // sharded_policy
+
+
+
+// =====  END OF test_object_counter_mt.cpp  =====
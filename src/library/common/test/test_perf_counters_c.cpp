@@ -0,0 +1,118 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the module PerfCounters using the Boost.Test module.
+**
+--*/
+
+
+// module to test header file include
+#include "celma/common/perf_counters.hpp"
+
+
+// C++ Standard Library includes
+#include <chrono>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE TestPerfCounters
+#include <boost/test/unit_test.hpp>
+
+
+// project includes
+#include "celma/test/measure.hpp"
+
+
+using celma::common::PerfCounters;
+using celma::common::PerfCounterValues;
+using celma::common::PerfEvent;
+using celma::common::PerfScope;
+
+
+
+/// Measure a loop. Which counters are available depends on the kernel and the
+/// hardware, the time must always be available.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( scope)
+{
+
+   const PerfCounters  counters;
+   PerfCounterValues   result;
+   std::vector< int>   data( 100'000, 1);
+   long                sum = 0;
+
+
+   BOOST_TEST_MESSAGE( "counters available: " << counters.available());
+
+   {
+      const PerfScope  ps( counters, result);
+      for (int round = 0; round < 10; ++round)
+      {
+         for (auto value : data)
+            sum += value;
+      } // end for
+      std::this_thread::sleep_for( std::chrono::milliseconds( 5));
+   } // end scope
+
+   BOOST_REQUIRE_EQUAL( sum, 1'000'000);
+   BOOST_REQUIRE( result.time() >= std::chrono::milliseconds( 5));
+
+   for (auto event : { PerfEvent::cycles, PerfEvent::instructions,
+                       PerfEvent::cacheReferences, PerfEvent::cacheMisses,
+                       PerfEvent::branchMisses, PerfEvent::contextSwitches })
+   {
+      BOOST_REQUIRE_EQUAL( result.available( event), counters.available( event));
+      if (!result.available( event))
+         BOOST_REQUIRE_EQUAL( result.value( event), 0);
+   } // end for
+
+   if (result.available( PerfEvent::instructions))
+      BOOST_REQUIRE_GE( result.value( PerfEvent::instructions), 1'000'000);
+   if (result.available( PerfEvent::contextSwitches))
+      BOOST_REQUIRE_GE( result.value( PerfEvent::contextSwitches), 1);
+
+   BOOST_REQUIRE_EQUAL( result.ipc() >= 0.0,
+                        result.available( PerfEvent::cycles)
+                        && result.available( PerfEvent::instructions));
+
+   std::ostringstream  oss;
+   oss << result;
+   BOOST_TEST_MESSAGE( oss.str());
+   BOOST_REQUIRE_EQUAL( oss.str().substr( 0, 5), "time ");
+   BOOST_REQUIRE( oss.str().find( "IPC ") != std::string::npos);
+
+} // scope
+
+
+
+/// Use the counters through the measure function.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( measure_perf)
+{
+
+   int   calls = 0;
+   auto  result = celma::test::measurePerf( 1000, "increment",
+                                            [ &]() { ++calls; });
+
+
+   BOOST_REQUIRE_EQUAL( calls, 1000);
+   BOOST_REQUIRE( result.time().count() > 0);
+
+} // measure_perf
+
+
+
+// =====  END OF test_perf_counters_c.cpp  =====
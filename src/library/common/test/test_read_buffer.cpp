@@ -20,6 +20,8 @@
 
 
 // C++ Standard Library includes
+#include <algorithm>
+#include <string>
 #include <vector>
 
 
@@ -99,6 +101,43 @@ private:
 }; // TestReadBufferCount
 
 
+/// Read buffer that returns the data of a string, in blocks of at most the
+/// given size.
+///
+/// @since  1.47.0, 18.10.2026
+class StringReadBuffer:
+   public ReadBuffer< 16, celma::common::ReadCountPolicy>
+{
+public:
+   StringReadBuffer( const std::string& data, size_t block_size):
+      mData( data),
+      mBlockSize( block_size)
+   {
+   }
+
+private:
+   using ReadBuffer< 16UL, celma::common::ReadCountPolicy>::readData;
+
+   size_t readData( unsigned char* dest, size_t max_len) override
+   {
+      if (mPos == mData.length())
+         throw std::runtime_error( "end of data");
+
+      const size_t  len = std::min( { max_len, mBlockSize, mData.length() - mPos});
+
+      ::memcpy( dest, &mData[ mPos], len);
+      mPos += len;
+
+      return len;
+   }
+
+   const std::string  mData;
+   const size_t       mBlockSize;
+   size_t             mPos = 0;
+
+}; // StringReadBuffer
+
+
 } // namespace
 
 
@@ -699,5 +738,91 @@ BOOST_AUTO_TEST_CASE( large_mixed_count)
 
 
 
+/// Examine data in place with peek() and remove it with consume().
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( peek_consume)
+{
+
+   StringReadBuffer  buff( "0123456789abcdefghijklmnopqrstuvwxyz", 7);
+
+
+   BOOST_REQUIRE_EQUAL( buff.available(), 0);
+   BOOST_REQUIRE_EQUAL( buff.peek( 4), "0123");
+   BOOST_REQUIRE_EQUAL( buff.available(), 7);
+   BOOST_REQUIRE_EQUAL( buff.peek( 10), "0123456789");
+
+   buff.consume( 8);
+   BOOST_REQUIRE_EQUAL( buff.peek( 2), "89");
+   BOOST_REQUIRE_THROW( buff.consume( 20), std::runtime_error);
+
+   // spans the end of the internal buffer, must be compacted
+   BOOST_REQUIRE_EQUAL( buff.peek( 16), "89abcdefghijklmn");
+   buff.consume( 16);
+
+   char  data[ 4];
+   buff.get( data, 4);
+   BOOST_REQUIRE_EQUAL( std::string( data, 4), "opqr");
+
+   BOOST_REQUIRE_EQUAL( buff.bytesReadFromBuffer(), 28);
+
+} // peek_consume
+
+
+
+/// Read records separated by a delimiter, including records that are split
+/// between two reads, and records that are longer than the internal buffer.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( read_until)
+{
+
+   StringReadBuffer  buff( "one\ntwo\nthree\n\na record longer than sixteen "
+                           "bytes\nlast\n", 5);
+
+
+   BOOST_REQUIRE_EQUAL( buff.readUntil( '\n'), "one");
+   BOOST_REQUIRE_EQUAL( buff.readUntil( '\n'), "two");
+   BOOST_REQUIRE_EQUAL( buff.readUntil( '\n'), "three");
+   BOOST_REQUIRE_EQUAL( buff.readUntil( '\n'), "");
+   BOOST_REQUIRE_EQUAL( buff.readUntil( '\n'),
+                        "a record longer than sixteen bytes");
+   BOOST_REQUIRE_EQUAL( buff.readUntil( '\n'), "last");
+   BOOST_REQUIRE_EQUAL( buff.available(), 0);
+
+   BOOST_REQUIRE_THROW( buff.readUntil( '\n'), std::runtime_error);
+
+} // read_until
+
+
+
+/// Peek at more data than fits into the internal buffer.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( peek_overflow)
+{
+
+   const std::string  data( "0123456789abcdefghijklmnopqrstuvwxyz"
+                            "ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+   StringReadBuffer   buff( data, 16);
+
+
+   BOOST_REQUIRE_EQUAL( buff.peek( 3), "012");
+   BOOST_REQUIRE_EQUAL( buff.peek( 40), data.substr( 0, 40));
+
+   buff.consume( 10);
+   BOOST_REQUIRE_EQUAL( buff.peek( 30), data.substr( 10, 30));
+   buff.consume( 30);
+
+   // remaining data fits into the internal buffer again
+   char  text[ 8];
+   buff.get( text, 8);
+   BOOST_REQUIRE_EQUAL( std::string( text, 8), data.substr( 40, 8));
+   BOOST_REQUIRE_EQUAL( buff.readUntil( 'Z'), data.substr( 48, 13));
+
+} // peek_overflow
+
+
+
 // =====  END OF test_read_buffer.cpp  =====
 
@@ -0,0 +1,187 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the stream stages: checksum and file descriptor stages,
+**    using the Boost.Test module.<br>
+**    The compression stages are tested in test_zlib_stage_c.cpp.
+**
+--*/
+
+
+// module to test header file includes
+#include "celma/common/crc32c.hpp"
+#include "celma/common/stream_stage.hpp"
+
+
+// OS/C lib includes
+#include <fcntl.h>
+#include <unistd.h>
+
+
+// C++ Standard Library includes
+#include <stdexcept>
+#include <string>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE StreamStagesTest
+#include <boost/test/unit_test.hpp>
+
+
+using namespace celma::common;
+
+
+namespace {
+
+
+/// Write stage that stores all data in a string.
+///
+/// @since  1.47.0, 18.10.2026
+class StringWriteStage: public IWriteStage
+{
+public:
+   void write( const unsigned char* data, size_t len) override
+   {
+      mData.append( reinterpret_cast< const char*>( data), len);
+   }
+
+   void finish() override
+   {
+      mFinished = true;
+   }
+
+   std::string  mData;
+   bool         mFinished = false;
+
+}; // StringWriteStage
+
+
+/// Read stage that returns the data of a string in small blocks.
+///
+/// @since  1.47.0, 18.10.2026
+class StringReadStage: public IReadStage
+{
+public:
+   explicit StringReadStage( const std::string& data):
+      mData( data)
+   {
+   }
+
+   size_t read( unsigned char* data, size_t len) override
+   {
+      const size_t  n = std::min( { len, size_t( 100), mData.length() - mPos});
+      ::memcpy( data, &mData[ mPos], n);
+      mPos += n;
+      return n;
+   }
+
+private:
+   const std::string  mData;
+   size_t             mPos = 0;
+
+}; // StringReadStage
+
+
+} // namespace
+
+
+
+/// Check the CRC32C computation with the standard check value, and that the
+/// checksum can be computed over multiple parts.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( crc32c_values)
+{
+
+   const std::string  data( "123456789");
+
+
+   BOOST_REQUIRE_EQUAL( crc32c( data.c_str(), 0), 0);
+   BOOST_REQUIRE_EQUAL( crc32c( data.c_str(), data.length()), 0xE3069283);
+   BOOST_REQUIRE_EQUAL( crc32c( &data[ 4], 5, crc32c( data.c_str(), 4)),
+                        0xE3069283);
+
+   // 32 bytes of zeros, check value from RFC 3720
+   const unsigned char  zeros[ 32] = {};
+   BOOST_REQUIRE_EQUAL( crc32c( zeros, sizeof( zeros)), 0x8A9136AA);
+
+} // crc32c_values
+
+
+
+/// Write data through a checksum stage, then read it back and verify the
+/// checksum.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( checksum_round_trip)
+{
+
+   std::string  original;
+
+   for (int i = 0; i < 1'000; ++i)
+      original.append( "record " + std::to_string( i) + " with some text\n");
+
+   StringWriteStage                     dest;
+   Crc32cWriteStage< StageCountPolicy>  checksum( dest);
+
+   {
+      StageWriteBuffer< 256>  swb( checksum);
+
+      for (size_t pos = 0; pos < original.length(); pos += 100)
+         swb.append( &original[ pos], std::min< size_t>( 100,
+                                                         original.length() - pos));
+      swb.finish();
+   } // end scope
+
+   BOOST_REQUIRE( dest.mFinished);
+   BOOST_REQUIRE_EQUAL( dest.mData, original);
+   BOOST_REQUIRE_EQUAL( checksum.checksum(),
+                        crc32c( original.c_str(), original.length()));
+   BOOST_REQUIRE_EQUAL( checksum.bytesIn(), original.length());
+
+   StringReadStage         source( dest.mData);
+   Crc32cReadStage<>       verify( source);
+   StageReadBuffer< 100>   srb( verify);
+
+   for (int i = 0; i < 1'000; ++i)
+   {
+      BOOST_REQUIRE_EQUAL( srb.readUntil( '\n'),
+                           "record " + std::to_string( i) + " with some text");
+   } // end for
+
+   BOOST_REQUIRE_EQUAL( verify.checksum(), checksum.checksum());
+
+} // checksum_round_trip
+
+
+
+/// Writing into a file descriptor that cannot be written must throw, not loop.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( fd_write_error)
+{
+
+   const int  fd = ::open( "/dev/null", O_RDONLY);
+
+   BOOST_REQUIRE( fd >= 0);
+
+   FdWriteStage<>       dest( fd);
+   const unsigned char  data[] = "some data";
+
+   BOOST_REQUIRE_THROW( dest.write( data, sizeof( data)), std::runtime_error);
+
+   ::close( fd);
+
+} // fd_write_error
+
+
+
+// =====  END OF test_stream_stages_c.cpp  =====
@@ -0,0 +1,153 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the functions string2tuple(), stringView2tuple() and
+**    strings2tuples(), using the Boost.Test module.
+**
+--*/
+
+
+// module to test header file include
+#include "celma/common/string2tuple.hpp"
+
+
+// C++ Standard Library includes
+#include <array>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE String2TupleTest
+#include <boost/test/unit_test.hpp>
+
+
+using celma::common::string2tuple;
+using celma::common::strings2tuples;
+using celma::common::stringView2tuple;
+
+
+
+/// Convert a string with the "classic" function.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( string_to_tuple)
+{
+
+   std::tuple< int, std::string, double>  dest;
+
+
+   string2tuple( dest, "42,hello,3.5");
+
+   BOOST_REQUIRE_EQUAL( std::get< 0>( dest), 42);
+   BOOST_REQUIRE_EQUAL( std::get< 1>( dest), "hello");
+   BOOST_REQUIRE_EQUAL( std::get< 2>( dest), 3.5);
+
+} // string_to_tuple
+
+
+
+/// Convert a string with the unrolled function, including types that use the
+/// fallback conversion.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( string_view_to_tuple)
+{
+
+   const std::string  src( "-13;text;;2.25;x;1;+7");
+   std::tuple< int, std::string, std::string_view, double, char, bool,
+               unsigned long>  dest;
+
+
+   stringView2tuple( dest, src, ';');
+
+   BOOST_REQUIRE_EQUAL( std::get< 0>( dest), -13);
+   BOOST_REQUIRE_EQUAL( std::get< 1>( dest), "text");
+   BOOST_REQUIRE( std::get< 2>( dest).empty());
+   BOOST_REQUIRE_EQUAL( std::get< 3>( dest), 2.25);
+   BOOST_REQUIRE_EQUAL( std::get< 4>( dest), 'x');
+   BOOST_REQUIRE( std::get< 5>( dest));
+   BOOST_REQUIRE_EQUAL( std::get< 6>( dest), 7);
+
+   std::tuple< std::string_view, int>  view_dest;
+   const std::string                   view_src( "-13:0");
+   stringView2tuple( view_dest, view_src, ':');
+   BOOST_REQUIRE_EQUAL( std::get< 0>( view_dest), "-13");
+   BOOST_REQUIRE_EQUAL( std::get< 0>( view_dest).data(), view_src.data());
+   BOOST_REQUIRE_EQUAL( std::get< 1>( view_dest), 0);
+
+   std::tuple< int>  single;
+   stringView2tuple( single, "4711");
+   BOOST_REQUIRE_EQUAL( std::get< 0>( single), 4711);
+
+} // string_view_to_tuple
+
+
+
+/// Invalid strings must be detected.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( errors)
+{
+
+   std::tuple< int, std::string, double>  dest;
+
+
+   BOOST_REQUIRE_THROW( stringView2tuple( dest, "1,a"), std::invalid_argument);
+   BOOST_REQUIRE_THROW( stringView2tuple( dest, "1,a,2,3"),
+                        std::invalid_argument);
+   BOOST_REQUIRE_THROW( stringView2tuple( dest, "x,a,2"), std::invalid_argument);
+   BOOST_REQUIRE_THROW( stringView2tuple( dest, "1,a,2.5x"),
+                        std::invalid_argument);
+   BOOST_REQUIRE_THROW( stringView2tuple( dest, "99999999999,a,2"),
+                        std::out_of_range);
+
+} // errors
+
+
+
+/// Convert multiple strings into a vector of tuples.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( batch)
+{
+
+   using tuple_t = std::tuple< int, std::string, double>;
+
+   const std::vector< std::string>  lines = { "1,one,1.5", "2,two,2.5",
+                                              "3,three,3.5" };
+   std::vector< tuple_t>            dest;
+
+
+   strings2tuples( lines, dest);
+
+   BOOST_REQUIRE_EQUAL( dest.size(), 3);
+   BOOST_REQUIRE( dest[ 0] == tuple_t( 1, "one", 1.5));
+   BOOST_REQUIRE( dest[ 2] == tuple_t( 3, "three", 3.5));
+
+   const std::array< std::string_view, 2>  more = { "4|four|4", "5|five|5" };
+   strings2tuples( more, dest, '|');
+   BOOST_REQUIRE_EQUAL( dest.size(), 5);
+   BOOST_REQUIRE( dest[ 4] == tuple_t( 5, "five", 5.0));
+
+   const std::vector< std::string_view>  bad = { "6,six,6", "7,seven" };
+   BOOST_REQUIRE_THROW( strings2tuples( bad, dest), std::invalid_argument);
+   BOOST_REQUIRE_EQUAL( dest.size(), 6);
+   BOOST_REQUIRE( dest.back() == tuple_t( 6, "six", 6.0));
+
+} // batch
+
+
+
+// =====  END OF test_string2tuple.cpp  =====
+
@@ -0,0 +1,201 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the module StringViewTokenizer using the Boost.Test
+**    module.
+**
+--*/
+
+
+// module to test header file include
+#include "celma/common/string_view_tokenizer.hpp"
+
+
+// C++ Standard Library includes
+#include <string>
+#include <vector>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE TestStringViewTokenizer
+#include <boost/test/unit_test.hpp>
+
+
+// project includes
+#include "celma/common/tokenizer.hpp"
+
+
+using celma::common::CharDelimiter;
+using celma::common::CharSetDelimiter;
+using celma::common::StringDelimiter;
+using celma::common::StringViewTokenizer;
+using celma::common::Tokenizer;
+using std::string;
+
+
+namespace {
+
+
+/// Returns all tokens of a tokenizer.
+///
+/// @tparam  D  The type of the delimiter.
+/// @param[in]  svt  The tokenizer to get the tokens from.
+/// @return  The tokens.
+/// @since  1.47.0, 18.10.2026
+template< typename D>
+   std::vector< string> tokens( const StringViewTokenizer< D>& svt)
+{
+   std::vector< string>  result;
+
+   for (auto const& token : svt)
+      result.emplace_back( token);
+
+   return result;
+} // tokens
+
+
+} // namespace
+
+
+
+/// Compare the results with those of the Boost based tokenizer, with and
+/// without empty tokens.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( same_as_tokenizer)
+{
+
+   for (const string s : { "", " ", "one", "two tokens", " leading",
+                           "trailing ", "  two  empty  ",
+                           " string with  multiple   empty tokens  " })
+   {
+      for (bool keep_empty : { false, true })
+      {
+         std::vector< string>  expected;
+
+         if (keep_empty)
+         {
+            Tokenizer  tk( s, ' ', true);
+            for (auto const& token : tk)
+               expected.push_back( token);
+         } else
+         {
+            Tokenizer  tk( s, ' ');
+            for (auto const& token : tk)
+               expected.push_back( token);
+         } // end if
+
+         const StringViewTokenizer  svt( s, CharDelimiter( ' '), keep_empty);
+         BOOST_REQUIRE( tokens( svt) == expected);
+      } // end for
+   } // end for
+
+} // same_as_tokenizer
+
+
+
+/// The tokens must point into the original string, test the counting
+/// iterator.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( counting_iterator)
+{
+
+   const string         s( "phrase one.phrase two.short phrase three.");
+   StringViewTokenizer  svt( s, CharDelimiter( '.'));
+
+
+   for (auto cit = svt.begin_counting(); cit != svt.end(); ++cit)
+   {
+      BOOST_REQUIRE( cit->data() >= s.data());
+      BOOST_REQUIRE( cit->data() < s.data() + s.length());
+
+      StringViewTokenizer  svt2( *cit, CharDelimiter( ' '));
+      for (auto cit2 = svt2.begin_counting(); cit2 != svt2.end(); ++cit2)
+      {
+         if (cit2.currentNum() == 0)
+            BOOST_REQUIRE_EQUAL( *cit2, (cit.currentNum() == 2) ? "short"
+                                                                 : "phrase");
+      } // end for
+
+      BOOST_REQUIRE_EQUAL( svt2.numTokens(), (cit.currentNum() == 2) ? 3 : 2);
+   } // end for
+
+   BOOST_REQUIRE_EQUAL( svt.numTokens(), 3);
+
+   auto  it = svt.begin();
+   auto  copy = it++;
+   BOOST_REQUIRE( copy != it);
+   BOOST_REQUIRE_EQUAL( *copy, "phrase one");
+   BOOST_REQUIRE_EQUAL( *it, "phrase two");
+   BOOST_REQUIRE( ++copy == it);
+
+} // counting_iterator
+
+
+
+/// Split with a delimiter string.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( string_delimiter)
+{
+
+   BOOST_REQUIRE_THROW( StringDelimiter( ""), std::invalid_argument);
+
+   const StringViewTokenizer  svt( "a::b:c::::d::", StringDelimiter( "::"));
+   BOOST_REQUIRE( tokens( svt)
+                  == std::vector< string>( { "a", "b:c", "d" }));
+
+   const StringViewTokenizer  svt_empty( "a::b:c::::d::", StringDelimiter( "::"),
+                                         true);
+   BOOST_REQUIRE( tokens( svt_empty)
+                  == std::vector< string>( { "a", "b:c", "", "d", "" }));
+
+} // string_delimiter
+
+
+
+/// Split with a set of delimiter characters, use strings long enough for the
+/// SIMD search and sets that are too large for it.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( char_set_delimiter)
+{
+
+   BOOST_REQUIRE_THROW( CharSetDelimiter( ""), std::invalid_argument);
+
+   for (const string delimiters : { ";", ",;", " \t,;", ",;:.-_!?#+*" })
+   {
+      std::vector< string>  expected;
+      string                s;
+
+      for (int i = 0; i < 200; ++i)
+      {
+         expected.push_back( string( i % 37, 'x') + std::to_string( i));
+         s.append( expected.back());
+         s.push_back( delimiters[ i % delimiters.length()]);
+      } // end for
+
+      const StringViewTokenizer  svt( s, CharSetDelimiter( delimiters));
+      BOOST_REQUIRE( tokens( svt) == expected);
+   } // end for
+
+   const StringViewTokenizer  svt( "key=value;;other=1", CharSetDelimiter( "=;"),
+                                   true);
+   BOOST_REQUIRE( tokens( svt)
+                  == std::vector< string>( { "key", "value", "", "other", "1" }));
+
+} // char_set_delimiter
+
+
+
+// =====  END OF test_string_view_tokenizer_c.cpp  =====
+
@@ -18,6 +18,15 @@
 #include "celma/common/text_file.hpp"
 
 
+// OS/C lib includes
+#include <unistd.h>
+
+
+// C++ Standard Library includes
+#include <fstream>
+#include <string>
+
+
 // Boost includes
 #define BOOST_TEST_MODULE TextFileTest
 #include <boost/test/unit_test.hpp>
@@ -25,6 +34,7 @@
 
 using celma::common::EmptyLineFilter;
 using celma::common::FileLineStat;
+using celma::common::MmapTextFile;
 using celma::common::NoFilter;
 using celma::common::StatLineHandler;
 using celma::common::TextFile;
@@ -36,6 +46,7 @@ using FilterStatTextFile = TextFile< EmptyLineFilter, StatLineHandler,
 
 BOOST_TEST_DONT_PRINT_LOG_VALUE( TextFile<>::const_iterator)
 BOOST_TEST_DONT_PRINT_LOG_VALUE( FilterStatTextFile::const_iterator)
+BOOST_TEST_DONT_PRINT_LOG_VALUE( MmapTextFile<>::const_iterator)
 
 
 namespace {
@@ -346,6 +357,114 @@ BOOST_FIXTURE_TEST_CASE( copy_statistics_no_empty_lines, TestFixture)
 
 
 
+/// Map the file into memory, the lines must be the same as those read from
+/// the stream.
+/// @since  1.47.0, 18.10.2026
+BOOST_FIXTURE_TEST_CASE( mmap_default_policies, TestFixture)
+{
+
+   const TextFile<>      stream_file( File);
+   const MmapTextFile<>  mmap_file( File);
+   auto                  stream_iter = stream_file.begin();
+   int                   num_lines = 0;
+
+
+   for (auto iter = mmap_file.begin(); iter != mmap_file.end(); ++iter)
+   {
+      BOOST_REQUIRE( stream_iter != stream_file.end());
+      BOOST_REQUIRE_EQUAL( *iter, *stream_iter);
+      BOOST_REQUIRE_EQUAL( iter.lineNbr(), stream_iter.lineNbr());
+      ++stream_iter;
+      ++num_lines;
+   } // end for
+
+   BOOST_REQUIRE( stream_iter == stream_file.end());
+   BOOST_REQUIRE_EQUAL( num_lines, NumLines);
+
+   BOOST_REQUIRE_THROW( MmapTextFile<>( "there is no such file").begin(),
+                        std::runtime_error);
+   BOOST_REQUIRE_THROW( MmapTextFile<>().begin(), std::runtime_error);
+
+} // mmap_default_policies
+
+
+
+/// Map the file into memory, filter empty lines, create statistic.
+/// @since  1.47.0, 18.10.2026
+BOOST_FIXTURE_TEST_CASE( mmap_statistics_no_empty_lines, TestFixture)
+{
+
+   MmapTextFile< EmptyLineFilter, StatLineHandler, FileLineStat>  ctf( File);
+   FileLineStat  fls;
+   int           num_lines = 0;
+
+
+   ctf.setStatObj( fls);
+
+   for (auto const& line : ctf)
+   {
+      BOOST_REQUIRE( !line.empty());
+      ++num_lines;
+   } // end for
+
+   BOOST_REQUIRE_EQUAL( fls.linesRead,      NumLines);
+   BOOST_REQUIRE_EQUAL( fls.linesFiltered,  NumEmptyLines);
+   BOOST_REQUIRE_EQUAL( fls.linesProcessed, NumTextLines);
+   BOOST_REQUIRE_EQUAL( num_lines, NumTextLines);
+
+} // mmap_statistics_no_empty_lines
+
+
+
+/// Copies of an iterator on a mapped file, handling of the last line without
+/// newline and of an empty file.
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( mmap_copy_iterator)
+{
+
+   const std::string  file_name( "/tmp/celma_text_file_"
+                                 + std::to_string( ::getpid()) + ".txt");
+
+
+   {
+      std::ofstream  ofs( file_name);
+      ofs << "first\n\nthird\r\nlast without newline";
+   } // end scope
+
+   {
+      const MmapTextFile<>  ctf( file_name);
+      auto                  iter = ctf.begin();
+
+      BOOST_REQUIRE_EQUAL( *iter, "first");
+      auto  second_iter( iter++);
+      BOOST_REQUIRE_EQUAL( *second_iter, "first");
+      BOOST_REQUIRE_EQUAL( *iter, "");
+      BOOST_REQUIRE( iter != second_iter);
+      ++second_iter;
+      BOOST_REQUIRE_EQUAL( iter, second_iter);
+      BOOST_REQUIRE_EQUAL( *++iter, "third\r");
+      BOOST_REQUIRE_EQUAL( *++iter, "last without newline");
+      BOOST_REQUIRE_EQUAL( iter.lineNbr(), 3);
+      BOOST_REQUIRE( ++iter == ctf.end());
+
+      // the mapping is still available through the copy
+      BOOST_REQUIRE_EQUAL( *second_iter, "");
+      BOOST_REQUIRE_EQUAL( *++second_iter, "third\r");
+   } // end scope
+
+   {
+      std::ofstream  ofs( file_name, std::ios_base::trunc);
+   } // end scope
+
+   const MmapTextFile<>  empty_file( file_name);
+   BOOST_REQUIRE( empty_file.begin() == empty_file.end());
+
+   ::unlink( file_name.c_str());
+
+} // mmap_copy_iterator
+
+
+
 namespace {
 
 
@@ -0,0 +1,224 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the parallel processing of a TextFile, using the
+**    Boost.Test module.
+**
+--*/
+
+
+// headerfile of the module to test
+#include "celma/common/text_file.hpp"
+
+
+// OS/C lib includes
+#include <unistd.h>
+
+
+// C++ Standard Library includes
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <vector>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE TextFileParallelTest
+#include <boost/test/unit_test.hpp>
+
+
+using celma::common::EmptyLineFilter;
+using celma::common::FileLineStat;
+using celma::common::StatLineHandler;
+using celma::common::TextFile;
+
+
+namespace {
+
+
+/// Creates a temporary text file, deletes the file at the end.
+///
+/// @since  1.47.0, 18.10.2026
+class TestFile
+{
+public:
+   /// Number of lines written.
+   static constexpr int  NumLines = 100'000;
+
+   /// Writes the file: every 7th line is empty, all other lines contain the
+   /// line number. The last line has no newline.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   TestFile():
+      mFileName( "/tmp/celma_text_file_parallel_"
+                 + std::to_string( ::getpid()) + ".txt")
+   {
+      std::ofstream  ofs( mFileName);
+
+      for (int i = 0; i < NumLines; ++i)
+      {
+         if (i > 0)
+            ofs << '\n';
+         if (i % 7 != 0)
+            ofs << "line " << i;
+      } // end for
+   } // TestFile::TestFile
+
+   /// Deletes the file.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   ~TestFile()
+   {
+      ::unlink( mFileName.c_str());
+   } // TestFile::~TestFile
+
+   /// The name of the file.
+   const std::string  mFileName;
+
+}; // TestFile
+
+
+} // namespace
+
+
+
+/// Count and sum up the lines in parallel, compute the statistic.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_FIXTURE_TEST_CASE( parallel_statistic, TestFile)
+{
+
+   constexpr int  NumEmptyLines = (NumLines + 6) / 7;
+
+   TextFile< EmptyLineFilter, StatLineHandler, FileLineStat>  ctf( mFileName);
+   FileLineStat            fls;
+   std::atomic< int>       num_lines( 0);
+   std::atomic< int64_t>   sum( 0);
+
+
+   ctf.setStatObj( fls);
+   ctf.processParallel( [&]( std::string_view line)
+   {
+      ++num_lines;
+      sum += std::stoi( std::string( line.substr( 5)));
+   }, 8);
+
+   BOOST_REQUIRE_EQUAL( num_lines, NumLines - NumEmptyLines);
+   BOOST_REQUIRE_EQUAL( fls.linesRead, NumLines);
+   BOOST_REQUIRE_EQUAL( fls.linesFiltered, NumEmptyLines);
+   BOOST_REQUIRE_EQUAL( fls.linesProcessed, NumLines - NumEmptyLines);
+
+   int64_t  expected_sum = 0;
+   for (int i = 0; i < NumLines; ++i)
+   {
+      if (i % 7 != 0)
+         expected_sum += i;
+   } // end for
+   BOOST_REQUIRE_EQUAL( sum, expected_sum);
+
+   // the statistics object is only used once
+   ctf.processParallel( []( std::string_view) {});
+   BOOST_REQUIRE_EQUAL( fls.linesRead, NumLines);
+
+} // parallel_statistic
+
+
+
+/// The ordered reduction must return the lines in the same order as the
+/// sequential iteration, also when there are more chunks than lines.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_FIXTURE_TEST_CASE( parallel_ordered, TestFile)
+{
+
+   const TextFile<>            ctf( mFileName);
+   std::vector< std::string>  sequential;
+   std::vector< std::string>  parallel;
+
+
+   for (auto const& line : ctf)
+      sequential.push_back( line);
+
+   for (size_t num_chunks : { 1, 3, 16, 0 })
+   {
+      parallel.clear();
+      ctf.processParallelOrdered< std::vector< std::string>>(
+         []( std::vector< std::string>& result, std::string_view line)
+         {
+            result.emplace_back( line);
+         },
+         [&]( std::vector< std::string>&& result)
+         {
+            parallel.insert( parallel.end(), result.begin(), result.end());
+         },
+         num_chunks);
+
+      BOOST_REQUIRE( parallel == sequential);
+   } // end for
+
+   const std::string  small_file( mFileName + ".small");
+   {
+      std::ofstream  ofs( small_file);
+      ofs << "a\n\nb\n";
+   } // end scope
+
+   parallel.clear();
+   TextFile<>( small_file).processParallelOrdered< std::string>(
+      []( std::string& result, std::string_view line)
+      {
+         result.append( line).append( "|");
+      },
+      [&]( std::string&& result)
+      {
+         parallel.push_back( result);
+      },
+      20);
+
+   ::unlink( small_file.c_str());
+
+   BOOST_REQUIRE_EQUAL( parallel.size(), 20);
+
+   std::string  all;
+   for (auto const& result : parallel)
+      all.append( result);
+   BOOST_REQUIRE_EQUAL( all, "a||b|");
+
+} // parallel_ordered
+
+
+
+/// Errors in the worker threads must be passed to the caller.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_FIXTURE_TEST_CASE( parallel_errors, TestFile)
+{
+
+   BOOST_REQUIRE_THROW( TextFile<>( "there is no such file")
+                           .processParallel( []( std::string_view) {}),
+                        std::runtime_error);
+
+   BOOST_REQUIRE_THROW( TextFile<>().processParallel( []( std::string_view) {}),
+                        std::runtime_error);
+
+   BOOST_REQUIRE_THROW( TextFile<>( mFileName).processParallel(
+                           []( std::string_view line)
+                           {
+                              if (line == "line 77778")
+                                 throw std::invalid_argument( "found");
+                           }, 4),
+                        std::invalid_argument);
+
+} // parallel_errors
+
+
+
+// =====  END OF test_text_file_parallel_mt.cpp  =====
+
@@ -0,0 +1,278 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the module ThreadPool using the Boost.Test module.
+**
+--*/
+
+
+// module to test header file include
+#include "celma/common/thread_pool.hpp"
+
+
+// OS/C lib includes
+#include <pthread.h>
+
+
+// C++ Standard Library includes
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE TestThreadPool
+#include <boost/test/unit_test.hpp>
+
+
+using celma::common::RangeString;
+using celma::common::ThreadPool;
+using celma::common::ThreadPoolConfig;
+
+
+
+/// Submit tasks and get the results through the futures.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( submit_tasks)
+{
+
+   ThreadPool  pool;
+
+
+   BOOST_REQUIRE_GE( pool.size(), 1);
+
+   auto  f1 = pool.submit( []() { return 42; });
+   auto  f2 = pool.submit( []( int a, const std::string& b)
+                           {
+                              return b + std::to_string( a);
+                           }, 13, std::string( "value "));
+   auto  f3 = pool.submit( []() { throw std::runtime_error( "failed"); });
+   auto  f4 = pool.submit( []() {});
+
+   BOOST_REQUIRE_EQUAL( f1.get(), 42);
+   BOOST_REQUIRE_EQUAL( f2.get(), "value 13");
+   BOOST_REQUIRE_THROW( f3.get(), std::runtime_error);
+   BOOST_REQUIRE_NO_THROW( f4.get());
+
+   // let the workers park, then check that they are woken up again
+   std::this_thread::sleep_for( std::chrono::milliseconds( 50));
+
+   std::vector< std::future< size_t>>  results;
+   for (size_t i = 0; i < 1000; ++i)
+      results.push_back( pool.submit( []( size_t v) { return v * 2; }, i));
+
+   for (size_t i = 0; i < results.size(); ++i)
+      BOOST_REQUIRE_EQUAL( results[ i].get(), i * 2);
+
+} // submit_tasks
+
+
+
+/// Each index of the range must be visited exactly once.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( parallel_for)
+{
+
+   ThreadPool  pool( ThreadPoolConfig{ 4, "", {}});
+
+
+   BOOST_REQUIRE_EQUAL( pool.size(), 4);
+
+   for (size_t grain : { 0, 1, 7, 1000, 100'000 })
+   {
+      std::vector< std::atomic< int>>  visited( 10'000);
+
+      pool.parallelFor( 100, visited.size(), [ &]( size_t idx)
+      {
+         ++visited[ idx];
+      }, grain);
+
+      for (size_t idx = 0; idx < visited.size(); ++idx)
+         BOOST_REQUIRE_EQUAL( visited[ idx].load(), (idx < 100) ? 0 : 1);
+   } // end for
+
+   int  calls = 0;
+   pool.parallelFor( 10, 10, [ &]( size_t) { ++calls; });
+   BOOST_REQUIRE_EQUAL( calls, 0);
+
+   std::atomic< int>  sum{ 0};
+   pool.parallelFor( RangeString< int>( "1-10,20,30-32"), [ &]( int value)
+   {
+      sum += value;
+   });
+   BOOST_REQUIRE_EQUAL( sum.load(), 55 + 20 + 30 + 31 + 32);
+
+} // parallel_for
+
+
+
+/// Nested parallel loops must not block the pool.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( nested)
+{
+
+   ThreadPool                       pool( ThreadPoolConfig{ 2, "", {}});
+   std::vector< std::atomic< int>>  visited( 100 * 100);
+
+
+   pool.parallelFor( 0, 100, [ &]( size_t outer)
+   {
+      pool.parallelFor( 0, 100, [ &]( size_t inner)
+      {
+         ++visited[ outer * 100 + inner];
+      });
+   }, 1);
+
+   for (auto const& v : visited)
+      BOOST_REQUIRE_EQUAL( v.load(), 1);
+
+   // a task that waits for a nested parallel loop
+   auto  f = pool.submit( [ &pool]()
+   {
+      return pool.parallelReduce( 0, 1000, 0UL,
+                                  []( size_t idx) { return idx; },
+                                  []( size_t a, size_t b) { return a + b; });
+   });
+   BOOST_REQUIRE_EQUAL( f.get(), 999UL * 1000 / 2);
+
+} // nested
+
+
+
+/// Parallel reduce, the order of the results must be kept.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( parallel_reduce)
+{
+
+   ThreadPool  pool;
+
+
+   const auto  sum = pool.parallelReduce( 1, 100'001, 0ULL,
+                                          []( size_t idx)
+                                          {
+                                             return static_cast< unsigned long long>( idx);
+                                          },
+                                          []( auto a, auto b) { return a + b; });
+   BOOST_REQUIRE_EQUAL( sum, 100'000ULL * 100'001 / 2);
+
+   const auto  str = pool.parallelReduce( 0, 26, std::string(),
+                                          []( size_t idx)
+                                          {
+                                             return std::string( 1, 'a' + idx);
+                                          },
+                                          []( std::string a, const std::string& b)
+                                          {
+                                             return a + b;
+                                          }, 3);
+   BOOST_REQUIRE_EQUAL( str, "abcdefghijklmnopqrstuvwxyz");
+
+   BOOST_REQUIRE_EQUAL( pool.parallelReduce( 5, 5, 17, []( size_t) { return 1; },
+                                             []( int a, int b) { return a + b; }),
+                        17);
+
+} // parallel_reduce
+
+
+
+/// Exceptions thrown in a parallel loop must be passed to the caller.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( exceptions)
+{
+
+   ThreadPool         pool;
+   std::atomic< int>  calls{ 0};
+
+
+   BOOST_REQUIRE_THROW( pool.parallelFor( 0, 1000, [ &]( size_t idx)
+   {
+      ++calls;
+      if (idx == 500)
+         throw std::runtime_error( "index 500");
+   }), std::runtime_error);
+
+   // the other chunks are still processed
+   BOOST_REQUIRE_GE( calls.load(), 500);
+
+   BOOST_REQUIRE_THROW( ThreadPool( ThreadPoolConfig{ 1, "", { -1 }}),
+                        std::invalid_argument);
+
+} // exceptions
+
+
+
+/// Names and CPU affinity of the worker threads.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( thread_setup)
+{
+
+   ThreadPool  pool( ThreadPoolConfig{ 2, "a-very-long-thread-name", { 0 }});
+
+
+   auto  name = pool.submit( []()
+   {
+      char  buffer[ 16];
+      ::pthread_getname_np( ::pthread_self(), buffer, sizeof( buffer));
+      return std::string( buffer);
+   }).get();
+
+   BOOST_REQUIRE( (name == "a-very-long-t-0") || (name == "a-very-long-t-1"));
+
+   auto  cpu_ok = pool.submit( []()
+   {
+      cpu_set_t  cpus;
+      ::pthread_getaffinity_np( ::pthread_self(), sizeof( cpus), &cpus);
+      return CPU_ISSET( 0, &cpus) && (CPU_COUNT( &cpus) == 1);
+   }).get();
+
+   BOOST_REQUIRE( cpu_ok);
+
+} // thread_setup
+
+
+
+/// All pending tasks must be executed when the pool is destroyed.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( destructor)
+{
+
+   std::atomic< int>  executed{ 0};
+
+
+   {
+      ThreadPool  pool( ThreadPoolConfig{ 2, "", {}});
+
+      for (int i = 0; i < 10'000; ++i)
+      {
+         pool.submit( [ &executed]()
+         {
+            ++executed;
+         });
+      } // end for
+   } // end scope
+
+   BOOST_REQUIRE_EQUAL( executed.load(), 10'000);
+
+} // destructor
+
+
+
+// =====  END OF test_thread_pool_c.cpp  =====
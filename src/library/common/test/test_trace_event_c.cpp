@@ -0,0 +1,213 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the module Tracer using the Boost.Test module.
+**
+--*/
+
+
+// module to test header file include
+#include "celma/common/trace_event.hpp"
+
+
+// OS/C lib includes
+#include <pthread.h>
+
+
+// C++ Standard Library includes
+#include <sstream>
+#include <string>
+#include <thread>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE TestTraceEvent
+#include <boost/test/unit_test.hpp>
+
+
+using celma::common::Tracer;
+
+
+namespace {
+
+
+/// Returns how often a string occurs in another string.
+///
+/// @param[in]  str     The string to search in.
+/// @param[in]  search  The string to search.
+/// @return  The number of occurrences.
+/// @since  1.47.0, 18.10.2026
+int countOf( const std::string& str, const std::string& search)
+{
+
+   int     count = 0;
+   size_t  pos = 0;
+
+
+   while ((pos = str.find( search, pos)) != std::string::npos)
+   {
+      ++count;
+      pos += search.length();
+   } // end while
+
+   return count;
+} // countOf
+
+
+/// Function with a trace scope and an instant event.
+///
+/// @param[in]  num_loops  Number of iterations.
+/// @since  1.47.0, 18.10.2026
+void traced( int num_loops)
+{
+
+   TRACE_SCOPE( "traced", "test");
+
+   for (int i = 0; i < num_loops; ++i)
+   {
+      TRACE_SCOPE( "loop \"body\"", "test");
+      TRACE_INSTANT( "tick", "test");
+   } // end for
+
+} // traced
+
+
+} // namespace
+
+
+
+/// When tracing is disabled, nothing must be recorded.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( disabled)
+{
+
+   std::ostringstream  oss;
+
+
+   BOOST_REQUIRE( !Tracer::enabled());
+   traced( 10);
+
+   BOOST_REQUIRE_EQUAL( Tracer::writeJson( oss), 0);
+   BOOST_REQUIRE_EQUAL( oss.str(), "{\"traceEvents\":[\n],\"displayTimeUnit\":\"ns\"}\n");
+
+} // disabled
+
+
+
+/// Record events in two threads and write them.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( record_and_write)
+{
+
+   Tracer::enable();
+   BOOST_REQUIRE( Tracer::enabled());
+
+   traced( 3);
+
+   std::thread  worker( []()
+   {
+      ::pthread_setname_np( ::pthread_self(), "trace-worker");
+      traced( 2);
+   });
+   worker.join();
+
+   Tracer::disable();
+   traced( 5);
+
+   std::ostringstream  oss;
+   BOOST_REQUIRE_EQUAL( Tracer::writeJson( oss), 1 + 3 * 2 + 1 + 2 * 2);
+
+   const auto  json = oss.str();
+   BOOST_TEST_MESSAGE( json);
+   BOOST_REQUIRE_EQUAL( json.substr( 0, 16), "{\"traceEvents\":[");
+   BOOST_REQUIRE_EQUAL( countOf( json, "\"ph\":\"M\""), 2);
+   BOOST_REQUIRE_EQUAL( countOf( json, "\"ph\":\"X\""), 7);
+   BOOST_REQUIRE_EQUAL( countOf( json, "\"ph\":\"i\""), 5);
+   BOOST_REQUIRE_EQUAL( countOf( json, "\"name\":\"loop \\\"body\\\"\""), 5);
+   BOOST_REQUIRE_EQUAL( countOf( json, "\"name\":\"trace-worker\""), 1);
+   BOOST_REQUIRE_EQUAL( countOf( json, "\"cat\":\"test\""), 12);
+
+   // all events were consumed, and the buffer of the worker thread, which
+   // ended, was deleted
+   std::ostringstream  oss2;
+   BOOST_REQUIRE_EQUAL( Tracer::writeJson( oss2), 0);
+   BOOST_REQUIRE_EQUAL( countOf( oss2.str(), "\"ph\":\"M\""), 1);
+   BOOST_REQUIRE_EQUAL( countOf( oss2.str(), "\"name\":\"trace-worker\""), 0);
+
+} // record_and_write
+
+
+
+/// Events must be dropped when a thread buffer is full.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( buffer_full)
+{
+
+   BOOST_REQUIRE_THROW( Tracer::setBufferSize( 0), std::invalid_argument);
+
+   Tracer::setBufferSize( 4);
+   Tracer::enable();
+
+   std::thread  worker( []()
+   {
+      // 1 + 10 * 2 events
+      traced( 10);
+   });
+   worker.join();
+
+   Tracer::disable();
+
+   std::ostringstream  oss;
+   BOOST_REQUIRE_EQUAL( Tracer::writeJson( oss), 4);
+   // the buffer of the thread was deleted, the dropped events are still
+   // counted
+   BOOST_REQUIRE_EQUAL( Tracer::numDropped(), 17);
+
+} // buffer_full
+
+
+
+/// The buffers of threads that ended must be deleted once their events were
+/// written.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( short_lived_threads)
+{
+
+   Tracer::enable();
+
+   for (int t = 0; t < 10; ++t)
+   {
+      std::thread  worker( []()
+      {
+         TRACE_INSTANT( "short", "test");
+      });
+      worker.join();
+   } // end for
+
+   Tracer::disable();
+
+   std::ostringstream  oss;
+   BOOST_REQUIRE_EQUAL( Tracer::writeJson( oss), 10);
+
+   // only the buffer of the main thread is left
+   std::ostringstream  oss2;
+   BOOST_REQUIRE_EQUAL( Tracer::writeJson( oss2), 0);
+   BOOST_REQUIRE_EQUAL( countOf( oss2.str(), "\"ph\":\"M\""), 1);
+
+} // short_lived_threads
+
+
+
+// =====  END OF test_trace_event_c.cpp  =====
@@ -19,11 +19,19 @@
 #include "celma/common/write_buffer.hpp"
 
 
+// C++ Standard Library includes
+#include <string>
+
+
 // Boost includes
 #define BOOST_TEST_MODULE WriteBufferTest
 #include <boost/test/unit_test.hpp>
 
 
+// project includes
+#include "celma/test/allocation_counter.hpp"
+
+
 using celma::common::WriteBuffer;
 
 
@@ -508,5 +516,39 @@ BOOST_AUTO_TEST_CASE( append_large_count)
 
 
 
+/// Appending data to the buffer, also when it has to be written, must not
+/// allocate memory.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( append_no_allocations)
+{
+
+   TestWriteBufferCount::mDataWritten = 0;
+   TestWriteBufferCount::mWriteCalled = 0;
+
+   {
+      TestWriteBufferCount  buff;
+      const std::string     data( 150, 'x');
+
+      CHECK_NO_ALLOCATIONS(
+         for (int i = 0; i < 100; ++i)
+         {
+            buff.append( "0123456789", 10);
+            buff.append( data.data(), 1 + (i % 3) * 70);
+         } // end for
+         buff.flush()
+      );
+
+      BOOST_REQUIRE_EQUAL( buff.buffered(), 0);
+      BOOST_REQUIRE_EQUAL( buff.numAppendCalled(), 200);
+   } // end scope
+
+   BOOST_REQUIRE_EQUAL( TestWriteBufferCount::mDataWritten,
+                        100 * 10 + 34 * 1 + 33 * 71 + 33 * 141);
+
+} // append_no_allocations
+
+
+
 // =====  END OF test_write_buffer.cpp  =====
 
@@ -0,0 +1,223 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the zlib compression stream stages, using the
+**    Boost.Test module.
+**
+--*/
+
+
+// module to test header file include
+#include "celma/common/zlib_stage.hpp"
+
+
+// OS/C lib includes
+#include <fcntl.h>
+#include <unistd.h>
+
+
+// C++ Standard Library includes
+#include <string>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE ZlibStageTest
+#include <boost/test/unit_test.hpp>
+
+
+// project includes
+#include "celma/common/crc32c.hpp"
+#include "celma/common/stream_stage.hpp"
+
+
+using namespace celma::common;
+
+
+namespace {
+
+
+/// Write stage that stores all data in a string.
+///
+/// @since  1.47.0, 18.10.2026
+class StringWriteStage: public IWriteStage
+{
+public:
+   void write( const unsigned char* data, size_t len) override
+   {
+      mData.append( reinterpret_cast< const char*>( data), len);
+   }
+
+   void finish() override
+   {
+      mFinished = true;
+   }
+
+   std::string  mData;
+   bool         mFinished = false;
+
+}; // StringWriteStage
+
+
+/// Read stage that returns the data of a string in small blocks.
+///
+/// @since  1.47.0, 18.10.2026
+class StringReadStage: public IReadStage
+{
+public:
+   explicit StringReadStage( const std::string& data):
+      mData( data)
+   {
+   }
+
+   size_t read( unsigned char* data, size_t len) override
+   {
+      const size_t  n = std::min( { len, size_t( 100), mData.length() - mPos});
+      ::memcpy( data, &mData[ mPos], n);
+      mPos += n;
+      return n;
+   }
+
+private:
+   const std::string  mData;
+   size_t             mPos = 0;
+
+}; // StringReadStage
+
+
+} // namespace
+
+
+
+/// Write data through checksum and compression stages, then read it back.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( compress_round_trip)
+{
+
+   std::string  original;
+
+   for (int i = 0; i < 20'000; ++i)
+      original.append( "record " + std::to_string( i) + " with some text\n");
+
+   StringWriteStage                     dest;
+   ZlibCompressStage< StageCountPolicy>  compress( dest);
+   Crc32cWriteStage< StageCountPolicy>   checksum( compress);
+
+   {
+      StageWriteBuffer< 4096>  swb( checksum);
+
+      for (size_t pos = 0; pos < original.length(); pos += 1000)
+         swb.append( &original[ pos], std::min< size_t>( 1000,
+                                                         original.length() - pos));
+      swb.finish();
+   } // end scope
+
+   BOOST_REQUIRE( dest.mFinished);
+   BOOST_REQUIRE_EQUAL( checksum.checksum(),
+                        crc32c( original.c_str(), original.length()));
+   BOOST_REQUIRE_EQUAL( checksum.bytesIn(), original.length());
+   BOOST_REQUIRE_EQUAL( compress.bytesIn(), original.length());
+   BOOST_REQUIRE_EQUAL( compress.bytesOut(), dest.mData.length());
+   BOOST_REQUIRE_LT( dest.mData.length(), original.length() / 2);
+   BOOST_REQUIRE_GT( compress.timeSpent().count(), 0);
+
+   StringReadStage                         source( dest.mData);
+   ZlibDecompressStage< StageCountPolicy>  decompress( source);
+   Crc32cReadStage<>                       verify( decompress);
+   StageReadBuffer< 1000>                  srb( verify);
+
+   for (int i = 0; i < 20'000; ++i)
+   {
+      BOOST_REQUIRE_EQUAL( srb.readUntil( '\n'),
+                           "record " + std::to_string( i) + " with some text");
+   } // end for
+
+   BOOST_REQUIRE_THROW( srb.readUntil( '\n'), std::runtime_error);
+   BOOST_REQUIRE_EQUAL( verify.checksum(), checksum.checksum());
+   BOOST_REQUIRE_EQUAL( decompress.bytesIn(), dest.mData.length());
+   BOOST_REQUIRE_EQUAL( decompress.bytesOut(), original.length());
+
+} // compress_round_trip
+
+
+
+/// Write a compressed file and read it back with the file descriptor stages.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( compressed_file)
+{
+
+   const std::string  file_name( "/tmp/celma_stream_stages_"
+                                 + std::to_string( ::getpid()) + ".z");
+   const std::string  text( "some text that is written into the file\n");
+
+
+   {
+      const int  fd = ::open( file_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC,
+                              0644);
+      BOOST_REQUIRE( fd != -1);
+
+      {
+         FdWriteStage<>         file( fd);
+         ZlibCompressStage<>    compress( file, 9);
+         StageWriteBuffer< 64>  swb( compress);
+
+         for (int i = 0; i < 100; ++i)
+            swb.append( text.c_str(), text.length());
+         // destructor calls finish()
+      } // end scope
+
+      ::close( fd);
+   } // end scope
+
+   {
+      const int                       fd = ::open( file_name.c_str(), O_RDONLY);
+      BOOST_REQUIRE( fd != -1);
+
+      FdReadStage< StageCountPolicy>  file( fd);
+      ZlibDecompressStage<>           decompress( file);
+      StageReadBuffer< 128>           srb( decompress);
+
+      for (int i = 0; i < 100; ++i)
+      {
+         BOOST_REQUIRE_EQUAL( srb.peek( text.length()), text);
+         srb.consume( text.length());
+      } // end for
+
+      BOOST_REQUIRE_EQUAL( file.bytesIn(), ::lseek( fd, 0, SEEK_CUR));
+      ::close( fd);
+   } // end scope
+
+   ::unlink( file_name.c_str());
+
+} // compressed_file
+
+
+
+/// Invalid compressed data must be detected.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( invalid_data)
+{
+
+   StringReadStage         source( "this is not compressed");
+   ZlibDecompressStage<>   decompress( source);
+   unsigned char           buffer[ 100];
+
+
+   BOOST_REQUIRE_THROW( decompress.read( buffer, sizeof( buffer)),
+                        std::runtime_error);
+
+} // invalid_data
+
+
+
+// =====  END OF test_zlib_stage_c.cpp  =====
@@ -0,0 +1,344 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of class celma::common::ThreadPool.
+
+
+// module headerfile include
+#include "celma/common/thread_pool.hpp"
+
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <climits>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+
+// project includes
+#include "celma/common/detail/futex.hpp"
+
+
+namespace celma::common {
+
+
+namespace {
+
+
+/// Number of times a waiting thread searches for a task before it blocks.
+constexpr int  SpinRounds = 64;
+
+
+/// The pool of which the current thread is a worker, NULL for other threads.
+thread_local const ThreadPool*  currentPool = nullptr;
+/// The index of the current thread in its pool.
+thread_local int                currentWorker = -1;
+/// Used to select the first worker to steal tasks from.
+thread_local size_t             stealRound = 0;
+
+
+} // namespace
+
+
+
+/// Blocks until all tasks of the group finished.
+///
+/// @since  1.47.0, 18.10.2026
+void detail::TaskGroup::wait() noexcept
+{
+
+   uint32_t  remaining = 0;
+
+
+   while ((remaining = mRemaining.load( std::memory_order_acquire)) != 0)
+      detail::futexWait( mRemaining, remaining);
+
+} // detail::TaskGroup::wait
+
+
+
+/// Throws the first exception that was thrown by a task of the group.
+///
+/// @since  1.47.0, 18.10.2026
+void detail::TaskGroup::rethrow() const noexcept( false)
+{
+
+   if (mException)
+      std::rethrow_exception( mException);
+
+} // detail::TaskGroup::rethrow
+
+
+
+/// Marks one task as finished, wakes the waiting thread after the last.
+///
+/// @since  1.47.0, 18.10.2026
+void detail::TaskGroup::taskDone() noexcept
+{
+
+   if (mRemaining.fetch_sub( 1, std::memory_order_acq_rel) == 1)
+      detail::futexWake( mRemaining, INT_MAX);
+
+} // detail::TaskGroup::taskDone
+
+
+
+/// Constructor, starts the worker threads.
+///
+/// @param[in]  config  The configuration of the pool.
+/// @throw  std::invalid_argument if the list of CPUs contains an invalid CPU
+///         number.
+/// @throw  std::system_error if a worker could not be bound to its CPU.
+/// @since  1.47.0, 18.10.2026
+ThreadPool::ThreadPool( ThreadPoolConfig config) noexcept( false):
+   mConfig( std::move( config))
+{
+
+   size_t  num_threads = mConfig.mNumThreads;
+   if (num_threads == 0)
+      num_threads = std::max( std::thread::hardware_concurrency(), 1U);
+
+   // all deques must exist before the first worker starts to steal
+   for (size_t i = 0; i < num_threads; ++i)
+      mWorkers.push_back( std::make_unique< Worker>());
+
+   try
+   {
+      for (size_t i = 0; i < num_threads; ++i)
+      {
+         ThreadOptions  options;
+
+         if (!mConfig.mThreadName.empty())
+         {
+            // keep the worker number if the name must be truncated
+            const std::string  suffix( "-" + std::to_string( i));
+            options.mName = mConfig.mThreadName.substr( 0,
+               15 - std::min< size_t>( suffix.length(), 15)) + suffix;
+         } // end if
+         if (!mConfig.mCpus.empty())
+            options.mCpus.push_back( mConfig.mCpus[ i % mConfig.mCpus.size()]);
+
+         mThreads.push_back( std::make_unique< ManagedThread>( options,
+            [ this, i]()
+            {
+               workerLoop( static_cast< int>( i));
+            }));
+      } // end for
+   } catch (...)
+   {
+      // terminate the workers that were already started
+      mStop.store( true, std::memory_order_seq_cst);
+      mIdleWait.notifyAll();
+      mThreads.clear();
+      throw;
+   } // end try
+
+} // ThreadPool::ThreadPool
+
+
+
+/// Destructor, executes the pending tasks and terminates the worker threads.
+///
+/// @since  1.47.0, 18.10.2026
+ThreadPool::~ThreadPool()
+{
+
+   mStop.store( true, std::memory_order_seq_cst);
+   mIdleWait.notifyAll();
+   mThreads.clear();
+
+   // tasks that were submitted while the workers terminated
+   while (auto task = findTask( -1))
+      runTask( task);
+
+} // ThreadPool::~ThreadPool
+
+
+
+/// Returns the number of chunks to split a range into.
+///
+/// @param[in]  range_size  The number of indices in the range.
+/// @param[in]  grain       The requested number of indices per chunk, 0 for
+///                         the default.
+/// @return  The number of chunks, at most \a range_size.
+/// @since  1.47.0, 18.10.2026
+size_t ThreadPool::numChunks( size_t range_size, size_t grain) const noexcept
+{
+
+   const size_t  num_chunks = (grain > 0) ? (range_size + grain - 1) / grain
+                                          : mWorkers.size() * 4;
+
+
+   return std::clamp< size_t>( num_chunks, 1,
+                               std::min< size_t>( range_size,
+                                  std::numeric_limits< uint32_t>::max()));
+} // ThreadPool::numChunks
+
+
+
+/// Adds a task: To the deque of the worker if called by a worker of this pool,
+/// to the injection queue otherwise. Wakes a parked worker.
+///
+/// @param[in]  task  The task to add, the pool takes ownership.
+/// @since  1.47.0, 18.10.2026
+void ThreadPool::enqueue( detail::PoolTask* task)
+{
+
+   if (currentPool == this)
+   {
+      mWorkers[ currentWorker]->mTasks.push( task);
+   } else
+   {
+      std::lock_guard< std::mutex>  lock( mInjectionMutex);
+      mInjectionQueue.push_back( task);
+      mNumInjected.fetch_add( 1, std::memory_order_release);
+   } // end if
+
+   mIdleWait.notifyOne();
+
+} // ThreadPool::enqueue
+
+
+
+/// Executes pending tasks until all tasks of the group are finished.
+///
+/// @param[in]  group  The group to wait for.
+/// @since  1.47.0, 18.10.2026
+void ThreadPool::helpUntil( detail::TaskGroup& group)
+{
+
+   const int  worker_idx = (currentPool == this) ? currentWorker : -1;
+   int        idle_rounds = 0;
+
+
+   while (!group.finished())
+   {
+      if (auto task = findTask( worker_idx))
+      {
+         runTask( task);
+         idle_rounds = 0;
+      } else if (++idle_rounds < SpinRounds)
+      {
+         std::this_thread::yield();
+      } else
+      {
+         // all remaining tasks of the group are being executed
+         group.wait();
+      } // end if
+   } // end while
+
+} // ThreadPool::helpUntil
+
+
+
+/// Searches a task to execute: The own deque, the injection queue and finally
+/// the deques of the other workers.
+///
+/// @param[in]  worker_idx  The index of the calling worker, -1 if called by
+///                         another thread.
+/// @return  The task found, NULL if there is none.
+/// @since  1.47.0, 18.10.2026
+detail::PoolTask* ThreadPool::findTask( int worker_idx)
+{
+
+   if (worker_idx >= 0)
+   {
+      if (auto task = mWorkers[ worker_idx]->mTasks.take())
+         return task;
+   } // end if
+
+   if (mNumInjected.load( std::memory_order_acquire) > 0)
+   {
+      std::lock_guard< std::mutex>  lock( mInjectionMutex);
+      if (!mInjectionQueue.empty())
+      {
+         auto  task = mInjectionQueue.front();
+         mInjectionQueue.pop_front();
+         mNumInjected.fetch_sub( 1, std::memory_order_relaxed);
+         return task;
+      } // end if
+   } // end if
+
+   const size_t  num_workers = mWorkers.size();
+   const size_t  start = stealRound++ % num_workers;
+
+   for (size_t i = 0; i < num_workers; ++i)
+   {
+      const size_t  victim = (start + i) % num_workers;
+      if (static_cast< int>( victim) == worker_idx)
+         continue;   // for
+      if (auto task = mWorkers[ victim]->mTasks.steal())
+         return task;
+   } // end for
+
+   return nullptr;
+} // ThreadPool::findTask
+
+
+
+/// Executes and deletes a task.
+///
+/// @param[in]  task  The task to execute.
+/// @since  1.47.0, 18.10.2026
+void ThreadPool::runTask( detail::PoolTask* task)
+{
+
+   const std::unique_ptr< detail::PoolTask>  owner( task);
+
+
+   owner->run();
+
+} // ThreadPool::runTask
+
+
+
+/// Main function of the worker threads.
+///
+/// @param[in]  worker_idx  The index of the worker.
+/// @since  1.47.0, 18.10.2026
+void ThreadPool::workerLoop( int worker_idx)
+{
+
+   currentPool = this;
+   currentWorker = worker_idx;
+   stealRound = static_cast< size_t>( worker_idx) + 1;
+
+   for (;;)
+   {
+      detail::PoolTask*  task = nullptr;
+
+      mIdleWait.wait( [ &]()
+      {
+         task = findTask( worker_idx);
+         return (task != nullptr) || mStop.load( std::memory_order_acquire);
+      });
+
+      if (task == nullptr)
+         break;   // for
+
+      runTask( task);
+   } // end for
+
+   currentPool = nullptr;
+   currentWorker = -1;
+
+} // ThreadPool::workerLoop
+
+
+
+} // namespace celma::common
+
+
+// =====  END OF thread_pool.cpp  =====
@@ -0,0 +1,391 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of class celma::common::Tracer.
+
+
+// module headerfile include
+#include "celma/common/trace_event.hpp"
+
+
+// OS/C lib includes
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+
+
+namespace celma::common {
+
+
+namespace {
+
+
+/// Default number of events per thread buffer.
+constexpr size_t  DefaultBufferSize = 65536;
+
+
+/// The buffers of all threads that recorded events. A buffer is deleted when
+/// its thread ended and the events were written.
+struct TraceBuffers
+{
+   /// Protects the list of buffers and the collection of the events.
+   std::mutex                                          mMutex;
+   /// The buffers.
+   std::vector< std::unique_ptr< detail::TraceBuffer>>  mBuffers;
+   /// Capacity of new buffers.
+   size_t                                              mBufferSize
+                                                          = DefaultBufferSize;
+   /// Number of events dropped by the threads whose buffers were deleted.
+   uint64_t                                            mNumDroppedDeleted = 0;
+};
+
+
+/// The buffer of the thread, NULL before the first event and after the thread
+/// released it.
+thread_local detail::TraceBuffer*  my_buffer = nullptr;
+
+/// Set when the thread released its buffer, events recorded afterwards (e.g.
+/// by destructors of other thread local objects) are ignored.
+thread_local bool  buffer_released = false;
+
+
+/// Releases the buffer of the thread when the thread ends.
+///
+/// @since  1.47.0, 18.10.2026
+class ThreadBufferRelease
+{
+public:
+   ThreadBufferRelease() = default;
+   ThreadBufferRelease( const ThreadBufferRelease&) = delete;
+   ThreadBufferRelease& operator =( const ThreadBufferRelease&) = delete;
+
+   /// Destructor, marks the buffer as released. It is deleted by the next
+   /// Tracer::writeJson().
+   ///
+   /// @since  1.47.0, 18.10.2026
+   ~ThreadBufferRelease()
+   {
+      buffer_released = true;
+      if (my_buffer != nullptr)
+      {
+         my_buffer->release();
+         my_buffer = nullptr;
+      } // end if
+   } // ThreadBufferRelease::~ThreadBufferRelease
+
+}; // ThreadBufferRelease
+
+
+/// Returns the list of thread buffers.
+///
+/// @return  The thread buffers.
+/// @since  1.47.0, 18.10.2026
+TraceBuffers& traceBuffers()
+{
+   // never destroyed, threads may record events during the shutdown
+   static TraceBuffers*  buffers = new TraceBuffers();
+   return *buffers;
+} // traceBuffers
+
+
+/// Writes a string as JSON string, with quotes and escaped characters.
+///
+/// @param[in]  os   The stream to write into.
+/// @param[in]  str  The string to write.
+/// @since  1.47.0, 18.10.2026
+void writeJsonString( std::ostream& os, const char* str)
+{
+
+   os << '"';
+
+   for (; *str != '\0'; ++str)
+   {
+      const auto  ch = static_cast< unsigned char>( *str);
+      if ((ch == '"') || (ch == '\\'))
+      {
+         os << '\\' << *str;
+      } else if (ch < 0x20)
+      {
+         char  buffer[ 8];
+         std::snprintf( buffer, sizeof( buffer), "\\u%04x", ch);
+         os << buffer;
+      } else
+      {
+         os << *str;
+      } // end if
+   } // end for
+
+   os << '"';
+
+} // writeJsonString
+
+
+/// Writes a timestamp or duration in microseconds, with nanosecond precision.
+///
+/// @param[in]  os     The stream to write into.
+/// @param[in]  nanos  The value in nanoseconds.
+/// @since  1.47.0, 18.10.2026
+void writeMicros( std::ostream& os, int64_t nanos)
+{
+
+   char  buffer[ 32];
+
+
+   std::snprintf( buffer, sizeof( buffer), "%lld.%03lld",
+                  static_cast< long long>( nanos / 1000),
+                  static_cast< long long>( nanos % 1000));
+   os << buffer;
+
+} // writeMicros
+
+
+} // namespace
+
+
+
+/// Constructor.
+///
+/// @param[in]  capacity     Number of events to store, rounded up to a power
+///                          of two.
+/// @param[in]  thread_id    The id of the thread (\c gettid()).
+/// @param[in]  thread_name  The name of the thread.
+/// @since  1.47.0, 18.10.2026
+detail::TraceBuffer::TraceBuffer( size_t capacity, int thread_id,
+                                  std::string thread_name):
+   mEvents( size_t( 1) << (64 - __builtin_clzll( std::max< size_t>( capacity,
+                                                                     2) - 1))),
+   mMask( mEvents.size() - 1),
+   mThreadId( thread_id),
+   mThreadName( std::move( thread_name))
+{
+} // detail::TraceBuffer::TraceBuffer
+
+
+
+/// Enables the recording of events.<br>
+/// Calibrates the TSC clock now, otherwise the calibration would be part of
+/// the first event.
+///
+/// @since  1.47.0, 18.10.2026
+void Tracer::enable() noexcept
+{
+   TscClock::ticksPerMicrosecond();
+   mEnabled.store( true, std::memory_order_relaxed);
+} // Tracer::enable
+
+
+
+/// Disables the recording of events. Events recorded so far remain in the
+/// buffers.
+///
+/// @since  1.47.0, 18.10.2026
+void Tracer::disable() noexcept
+{
+   mEnabled.store( false, std::memory_order_relaxed);
+} // Tracer::disable
+
+
+
+/// Sets the number of events per thread buffer. Applies to buffers created
+/// afterwards.
+///
+/// @param[in]  num_events  The capacity of a thread buffer, rounded up to a
+///                         power of two.
+/// @throw  std::invalid_argument if \a num_events is 0.
+/// @since  1.47.0, 18.10.2026
+void Tracer::setBufferSize( size_t num_events)
+{
+
+   if (num_events == 0)
+      throw std::invalid_argument( "trace buffer size must not be 0");
+
+   auto&                               buffers = traceBuffers();
+   const std::lock_guard< std::mutex>  guard( buffers.mMutex);
+
+
+   buffers.mBufferSize = num_events;
+
+} // Tracer::setBufferSize
+
+
+
+/// Records an event of a scope that was left.
+///
+/// @param[in]  site       The call site of the scope.
+/// @param[in]  start      When the scope was entered, TscClock nanoseconds.
+/// @param[in]  duration   How long the scope took, in nanoseconds.
+/// @since  1.47.0, 18.10.2026
+void Tracer::complete( const TraceCallSite& site, int64_t start,
+                       int64_t duration)
+{
+   if (auto buffer = threadBuffer(); buffer != nullptr)
+      buffer->push( TraceEvent{ &site, start,
+                                std::max< int64_t>( duration, 0), 'X' });
+} // Tracer::complete
+
+
+
+/// Records an instant event.
+///
+/// @param[in]  site  The call site of the event.
+/// @since  1.47.0, 18.10.2026
+void Tracer::instant( const TraceCallSite& site)
+{
+   if (auto buffer = threadBuffer(); buffer != nullptr)
+      buffer->push( TraceEvent{ &site,
+         TscClock::now().time_since_epoch().count(), 0, 'i' });
+} // Tracer::instant
+
+
+
+/// Writes all events recorded so far in the Chrome trace event JSON format
+/// and removes them from the buffers.<br>
+/// For each thread, a metadata event with the thread name is written too.<br>
+/// The buffers of the threads that ended are deleted afterwards.
+///
+/// @param[in]  os  The stream to write into.
+/// @return  The number of events written.
+/// @since  1.47.0, 18.10.2026
+size_t Tracer::writeJson( std::ostream& os)
+{
+
+   auto&                               buffers = traceBuffers();
+   const std::lock_guard< std::mutex>  guard( buffers.mMutex);
+   const int                           pid = ::getpid();
+   size_t                              num_events = 0;
+   bool                                first = true;
+   auto                                separator = [ &]()
+   {
+      os << (first ? "\n" : ",\n");
+      first = false;
+   };
+
+
+   os << "{\"traceEvents\":[";
+
+   for (auto& buffer : buffers.mBuffers)
+   {
+      // check before draining, the thread may still add events until then
+      const bool  released = buffer->released();
+
+      separator();
+      os << R"({"name":"thread_name","ph":"M","pid":)" << pid
+         << ",\"tid\":" << buffer->threadId() << ",\"args\":{\"name\":";
+      writeJsonString( os, buffer->threadName().c_str());
+      os << "}}";
+
+      buffer->drain( [ &]( const TraceEvent& event)
+      {
+         separator();
+         os << "{\"name\":";
+         writeJsonString( os, event.mSite->mName);
+         os << ",\"cat\":";
+         writeJsonString( os, event.mSite->mCategory);
+         os << ",\"ph\":\"" << event.mPhase << "\",\"ts\":";
+         writeMicros( os, event.mTimestamp);
+         if (event.mPhase == 'X')
+         {
+            os << ",\"dur\":";
+            writeMicros( os, event.mDuration);
+         } else
+         {
+            // instant event, scope: thread
+            os << ",\"s\":\"t\"";
+         } // end if
+         os << ",\"pid\":" << pid << ",\"tid\":" << buffer->threadId() << '}';
+         ++num_events;
+      });
+
+      if (released)
+      {
+         buffers.mNumDroppedDeleted += buffer->numDropped();
+         buffer.reset();
+      } // end if
+   } // end for
+
+   buffers.mBuffers.erase( std::remove( buffers.mBuffers.begin(),
+                                        buffers.mBuffers.end(), nullptr),
+                           buffers.mBuffers.end());
+
+   os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+
+   return num_events;
+} // Tracer::writeJson
+
+
+
+/// Returns the number of events that were dropped because a thread buffer was
+/// full.
+///
+/// @return  The number of events dropped over all threads.
+/// @since  1.47.0, 18.10.2026
+uint64_t Tracer::numDropped()
+{
+
+   auto&                               buffers = traceBuffers();
+   const std::lock_guard< std::mutex>  guard( buffers.mMutex);
+   uint64_t                            result = buffers.mNumDroppedDeleted;
+
+
+   for (const auto& buffer : buffers.mBuffers)
+      result += buffer->numDropped();
+
+   return result;
+} // Tracer::numDropped
+
+
+
+/// Returns the buffer of the calling thread, creates it on the first call.
+///
+/// @return  The buffer of the calling thread, NULL if the thread is ending
+///          and its buffer was released already.
+/// @since  1.47.0, 18.10.2026
+detail::TraceBuffer* Tracer::threadBuffer()
+{
+
+   if ((my_buffer == nullptr) && !buffer_released)
+   {
+      // releases the buffer when the thread ends
+      static thread_local ThreadBufferRelease  release;
+
+      char  name[ 16] = { 0 };
+      ::pthread_getname_np( ::pthread_self(), name, sizeof( name));
+
+      auto&                               buffers = traceBuffers();
+      const std::lock_guard< std::mutex>  guard( buffers.mMutex);
+
+      buffers.mBuffers.push_back( std::make_unique< detail::TraceBuffer>(
+         buffers.mBufferSize, static_cast< int>( ::syscall( SYS_gettid)),
+         name));
+      my_buffer = buffers.mBuffers.back().get();
+   } // end if
+
+   return my_buffer;
+} // Tracer::threadBuffer
+
+
+
+} // namespace celma::common
+
+
+// =====  END OF trace_event.cpp  =====
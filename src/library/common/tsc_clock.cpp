@@ -0,0 +1,109 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of class celma::common::TscClock.
+
+
+// module headerfile include
+#include "celma/common/tsc_clock.hpp"
+
+
+// OS/C lib includes
+#if defined( __x86_64__) || defined( __i386__)
+#  include <cpuid.h>
+#endif
+
+
+// C++ Standard Library includes
+#include <thread>
+
+
+namespace celma::common {
+
+
+namespace {
+
+
+/// Duration of the calibration.
+constexpr std::chrono::milliseconds  CalibrationTime( 20);
+
+
+} // namespace
+
+
+
+/// Returns if the processor provides an invariant TSC, i.e. one that runs
+/// with a constant rate, independent of the processor frequency and sleep
+/// states.
+///
+/// @return  \c true if the TSC can be used for time measurements.
+/// @since  1.47.0, 18.10.2026
+bool TscClock::available() noexcept
+{
+#if defined( __x86_64__) || defined( __i386__)
+   unsigned int  eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+   // CPUID leaf 0x80000007, EDX bit 8: invariant TSC
+   if (__get_cpuid( 0x80000007, &eax, &ebx, &ecx, &edx) == 0)
+      return false;
+
+   return (edx & (1U << 8)) != 0;
+#else
+   return false;
+#endif
+} // TscClock::available
+
+
+
+/// Measures the TSC frequency against \c steady_clock: Reads both clocks,
+/// sleeps for a short time and reads both clocks again.
+///
+/// @return  The calibration data.
+/// @since  1.47.0, 18.10.2026
+TscClock::Calibration TscClock::calibrate() noexcept
+{
+#if defined( __x86_64__) || defined( __i386__)
+   using std::chrono::steady_clock;
+
+   const auto      start_time = steady_clock::now();
+   const uint64_t  start_ticks = ticksOrdered();
+
+   std::this_thread::sleep_for( CalibrationTime);
+
+   const auto      end_time = steady_clock::now();
+   const uint64_t  end_ticks = ticksOrdered();
+   const auto      nanos = std::chrono::duration_cast< std::chrono::nanoseconds>(
+      end_time - start_time).count();
+   const uint64_t  num_ticks = end_ticks - start_ticks;
+
+   if ((num_ticks == 0) || (nanos <= 0))
+      return Calibration{ uint64_t( 1) << Shift, 1000.0 };
+
+   return Calibration{
+      static_cast< uint64_t>( (static_cast< detail::uint128_t>( nanos) << Shift)
+                              / num_ticks),
+      static_cast< double>( num_ticks) * 1000.0 / static_cast< double>( nanos)
+   };
+#else
+   // ticks are nanoseconds from steady_clock
+   return Calibration{ uint64_t( 1) << Shift, 1000.0 };
+#endif
+} // TscClock::calibrate
+
+
+
+} // namespace celma::common
+
+
+// =====  END OF tsc_clock.cpp  =====
@@ -28,6 +28,7 @@
 #include <boost/test/unit_test.hpp>
 
 
+#include "celma/test/allocation_counter.hpp"
 #include "celma/test/check_for.hpp"
 
 
@@ -975,5 +976,47 @@ BOOST_AUTO_TEST_CASE( iterate_back_and_forth)
 
 
 
+/// Operations on a bitset that do not change its size must not allocate
+/// memory.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( no_allocations)
+{
+
+   DynamicBitset  dbs( 200);
+   DynamicBitset  other( 200);
+   size_t         sum = 0;
+
+
+   other.set( 3).set( 150);
+
+   CHECK_NO_ALLOCATIONS(
+      dbs.set( 10);
+      dbs.set( 199, true);
+      dbs[ 20] = true;
+      dbs.reset( 10);
+      dbs.flip( 30);
+      sum += dbs.test( 20) + dbs[ 30] + dbs.count();
+      sum += dbs.any() + dbs.all() + dbs.none();
+      dbs |= other;
+      dbs &= other;
+      dbs ^= other;
+      dbs >>= 5;
+      dbs.flip();
+      dbs.set();
+      sum += (dbs == other);
+      for (auto idx : other)
+         sum += idx;
+      for (auto it = other.crbegin(); it != other.crend(); ++it)
+         sum += *it
+   );
+
+   BOOST_REQUIRE_EQUAL( dbs.size(), 200);
+   BOOST_REQUIRE_EQUAL( sum, 1 + 1 + 3 + 1 + 0 + 0 + 0 + 153 + 153);
+
+} // no_allocations
+
+
+
 // =====  END OF test_dynamic_bitset_c.cpp  =====
 
@@ -0,0 +1,173 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2017-2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Benchmarks for int2string() and similar conversions.
+**
+--*/
+
+
+// OS/C lib includes
+#include <cstdio>
+#include <cstdlib>
+
+
+// C++ Standard Library includes
+#include <array>
+#include <sstream>
+#include <string>
+
+
+// Boost includes
+#include "boost/lexical_cast.hpp"
+
+
+// project includes
+#include "celma/format/int2string.hpp"
+#include "celma/test/benchmark.hpp"
+
+
+using celma::test::doNotOptimize;
+
+
+namespace {
+
+
+/// Returns the next value to convert. Cycles through a table of random
+/// values, so that the cost of computing the value is negligible.
+///
+/// @return  The value to convert.
+/// @since  1.47.0, 18.10.2026
+int nextValue()
+{
+
+   static const auto  values = []()
+   {
+      std::array< int, 1024>  result;
+      ::srand( 102030405);
+      for (auto& value : result)
+         value = ::rand();
+      return result;
+   }();
+   static size_t      idx = 0;
+
+
+   return values[ idx++ % values.size()];
+} // nextValue
+
+
+} // namespace
+
+
+
+/// Measure using the function celma::format::int2string().
+/// @since  1.47.0, 18.10.2026
+///    (converted to a benchmark)
+/// @since  0.13.5, 28.02.2017
+BENCHMARK( format, int2string)
+{
+
+   const std::string  result( celma::format::int2string( nextValue()));
+
+
+   doNotOptimize( result);
+
+} // int2string
+
+
+
+/// Measure the buffer variant of celma::format::int2string().
+/// @since  1.47.0, 18.10.2026
+BENCHMARK( format, int2string_buffer)
+{
+
+   char  buffer[ 32];
+
+
+   doNotOptimize( celma::format::int2string( buffer, nextValue()));
+   celma::test::clobberMemory();
+
+} // int2string_buffer
+
+
+
+/// Measure conversion using boost::lexical_cast<>.
+/// @since  1.47.0, 18.10.2026
+///    (converted to a benchmark)
+/// @since  0.13.5, 28.02.2017
+BENCHMARK( format, boost_lexical_cast)
+{
+
+   const std::string  result( boost::lexical_cast< std::string>( nextValue()));
+
+
+   doNotOptimize( result);
+
+} // boost_lexical_cast
+
+
+
+/// Measure conversion using std::ostringstream.
+/// @since  1.47.0, 18.10.2026
+///    (converted to a benchmark)
+/// @since  0.13.5, 28.02.2017
+BENCHMARK( format, ostringstream)
+{
+
+   std::ostringstream  oss;
+
+
+   oss << nextValue();
+
+   const std::string  result( oss.str());
+
+   doNotOptimize( result);
+
+} // ostringstream
+
+
+
+/// Measure the function sprintf().
+/// @since  1.47.0, 18.10.2026
+///    (converted to a benchmark)
+/// @since  0.13.5, 28.02.2017
+BENCHMARK( format, sprintf)
+{
+
+   char  buffer[ 128];
+
+
+   std::snprintf( buffer, sizeof( buffer), "%d", nextValue());
+
+   const std::string  result( buffer);
+
+   doNotOptimize( result);
+
+} // sprintf
+
+
+
+/// Measure the function std::to_string().
+/// @since  1.47.0, 18.10.2026
+///    (converted to a benchmark)
+/// @since  0.13.5, 28.02.2017
+BENCHMARK( format, to_string)
+{
+
+   const std::string  result( std::to_string( nextValue()));
+
+
+   doNotOptimize( result);
+
+} // to_string
+
+
+
+// =====  END OF bench_int2string.cpp  =====
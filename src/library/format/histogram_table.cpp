@@ -0,0 +1,135 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of functions celma::format::printPercentiles() and
+/// celma::format::printBuckets().
+
+
+// module headerfile include
+#include "celma/format/histogram_table.hpp"
+
+
+// C++ Standard Library includes
+#include <cmath>
+#include <cstdio>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+
+// project includes
+#include "celma/format/ascii_table.hpp"
+
+
+namespace celma::format {
+
+
+namespace {
+
+
+/// Returns the name of a percentile, e.g. "p99.9".
+///
+/// @param[in]  percent  The percentile to return the name of.
+/// @return  The name of the percentile.
+/// @since  1.47.0, 18.10.2026
+std::string percentileName( double percent)
+{
+
+   std::ostringstream  oss;
+
+
+   oss << 'p' << percent;
+
+   return oss.str();
+} // percentileName
+
+
+} // namespace
+
+
+
+/// Prints the number of values, minimum, mean, the selected percentiles and
+/// the maximum of a histogram as table, using AsciiTable.
+///
+/// @param[in]  os           The stream to print into.
+/// @param[in]  snap         The histogram to print the percentiles of.
+/// @param[in]  unit         The unit of the values, printed in the title.
+/// @param[in]  percentiles  The percentiles to print.
+/// @since  1.47.0, 18.10.2026
+void printPercentiles( std::ostream& os, const common::HistogramSnapshot& snap,
+                       const char* unit,
+                       const std::vector< double>& percentiles)
+{
+
+   const AsciiTable  at( '\0', "Percentile[10]  Value (%s)[15,lu]", unit);
+   char              line[ 128];
+   auto              print_row = [ &]( const std::string& name, uint64_t value)
+   {
+      std::snprintf( line, sizeof( line), at.format(), name.c_str(),
+                     static_cast< unsigned long>( value));
+      os << line << '\n';
+   };
+
+
+   os << at.titleLine() << '\n' << at.dashesLine() << '\n';
+
+   print_row( "count", snap.count());
+   print_row( "min", snap.min());
+   print_row( "mean", static_cast< uint64_t>( std::llround( snap.mean())));
+
+   for (auto percent : percentiles)
+      print_row( percentileName( percent), snap.percentile( percent));
+
+   print_row( "max", snap.max());
+
+} // printPercentiles
+
+
+
+/// Prints the raw counts of all non-empty buckets of a histogram as table,
+/// using AsciiTable, together with the cumulated percentage.
+///
+/// @param[in]  os    The stream to print into.
+/// @param[in]  snap  The histogram to print the buckets of.
+/// @since  1.47.0, 18.10.2026
+void printBuckets( std::ostream& os, const common::HistogramSnapshot& snap)
+{
+
+   const AsciiTable  at( "From[20,lu]  To[20,lu]  Count[15,lu]  Cumulated[9.3,f]");
+   char              line[ 128];
+   uint64_t          cumulated = 0;
+
+
+   os << at.titleLine() << '\n' << at.dashesLine() << '\n';
+
+   for (const auto& bucket : snap.buckets())
+   {
+      cumulated += bucket.mCount;
+      std::snprintf( line, sizeof( line), at.format(),
+                     static_cast< unsigned long>( bucket.mLow),
+                     static_cast< unsigned long>( bucket.mHigh),
+                     static_cast< unsigned long>( bucket.mCount),
+                     static_cast< double>( cumulated) * 100.0
+                        / static_cast< double>( snap.count()));
+      os << line << '\n';
+   } // end for
+
+} // printBuckets
+
+
+
+} // namespace celma::format
+
+
+// =====  END OF histogram_table.cpp  =====
@@ -0,0 +1,78 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the functions printPercentiles() and printBuckets()
+**    using the Boost.Test framework.
+**
+--*/
+
+
+// header file include of the module to test
+#include "celma/format/histogram_table.hpp"
+
+
+// C++ Standard Library includes
+#include <sstream>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE HistogramTableTest
+#include <boost/test/unit_test.hpp>
+
+
+using celma::common::HistogramRecorder;
+using celma::common::HistogramSnapshot;
+
+
+
+/// Print the percentiles and the buckets of a small histogram.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( print_tables)
+{
+
+   HistogramRecorder  rec;
+   HistogramSnapshot  snap;
+
+
+   rec.record( 10, 3);
+   rec.record( 20);
+   snap.merge( rec);
+
+   {
+      std::ostringstream  oss;
+      celma::format::printPercentiles( oss, snap, "us", { 50.0, 99.9 });
+      BOOST_REQUIRE_EQUAL( oss.str(),
+         "Percentile       Value (us)\n"
+         "----------  ---------------\n"
+         "     count                4\n"
+         "       min               10\n"
+         "      mean               13\n"
+         "       p50               10\n"
+         "     p99.9               20\n"
+         "       max               20\n");
+   } // end scope
+
+   {
+      std::ostringstream  oss;
+      celma::format::printBuckets( oss, snap);
+      BOOST_REQUIRE_EQUAL( oss.str(),
+         "                From                    To            Count  Cumulated\n"
+         "--------------------  --------------------  ---------------  ---------\n"
+         "                  10                    10                3     75.000\n"
+         "                  20                    20                1    100.000\n");
+   } // end scope
+
+} // print_tables
+
+
+
+// =====  END OF test_histogram_table.cpp  =====
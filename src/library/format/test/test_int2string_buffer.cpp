@@ -0,0 +1,130 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the buffer variants of the int2string() functions.
+**
+--*/
+
+
+// header file of module to test
+#include "celma/format/int2string.hpp"
+
+
+// C++ Standard Library includes
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE Int2StringBufferTest
+#include <boost/test/unit_test.hpp>
+
+
+// project includes
+#include "celma/test/allocation_counter.hpp"
+
+
+using celma::format::int2string;
+
+
+namespace {
+
+
+/// Converts the minimum and maximum value of a type into a buffer.
+///
+/// @tparam  T  The integer type to convert.
+/// @param[out]  buffer  The buffer to write into, must be large enough for
+///                      both values.
+/// @return  The number of characters written.
+/// @since  1.47.0, 18.10.2026
+template< typename T> int convertMinMax( char* buffer)
+{
+
+   const int  len = int2string( buffer, std::numeric_limits< T>::min());
+
+
+   return len + int2string( buffer + len, std::numeric_limits< T>::max());
+} // convertMinMax
+
+
+} // namespace
+
+
+
+/// Check that the buffer variants write the correct strings and return the
+/// length.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( buffer_results)
+{
+
+   char  buffer[ 64];
+
+
+   BOOST_REQUIRE_EQUAL( int2string( buffer, int8_t( -128)), 4);
+   BOOST_REQUIRE_EQUAL( std::string( buffer, 4), "-128");
+
+   BOOST_REQUIRE_EQUAL( int2string( buffer, uint16_t( 65535)), 5);
+   BOOST_REQUIRE_EQUAL( std::string( buffer, 5), "65535");
+
+   BOOST_REQUIRE_EQUAL( int2string( buffer, int32_t( -42)), 3);
+   BOOST_REQUIRE_EQUAL( std::string( buffer, 3), "-42");
+
+   BOOST_REQUIRE_EQUAL( convertMinMax< uint64_t>( buffer), 21);
+   BOOST_REQUIRE_EQUAL( std::string( buffer, 21), "018446744073709551615");
+
+} // buffer_results
+
+
+
+/// The buffer variants must not allocate memory.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( buffer_no_allocations)
+{
+
+   char  buffer[ 64];
+   int   total = 0;
+
+
+   CHECK_NO_ALLOCATIONS(
+      for (int i = 0; i < 1000; ++i)
+      {
+         total += int2string( buffer, static_cast< int8_t>( i));
+         total += int2string( buffer, static_cast< uint8_t>( i));
+         total += int2string( buffer, static_cast< int16_t>( i * 37));
+         total += int2string( buffer, static_cast< uint16_t>( i * 37));
+         total += int2string( buffer, static_cast< int32_t>( i) * -100'003);
+         total += int2string( buffer, static_cast< uint32_t>( i) * 100'003);
+         total += int2string( buffer, static_cast< int64_t>( i)
+                                      * -10'000'000'019LL);
+         total += int2string( buffer, static_cast< uint64_t>( i)
+                                      * 10'000'000'019ULL);
+      } // end for
+      total += convertMinMax< int8_t>( buffer);
+      total += convertMinMax< uint8_t>( buffer);
+      total += convertMinMax< int16_t>( buffer);
+      total += convertMinMax< uint16_t>( buffer);
+      total += convertMinMax< int32_t>( buffer);
+      total += convertMinMax< uint32_t>( buffer);
+      total += convertMinMax< int64_t>( buffer);
+      total += convertMinMax< uint64_t>( buffer)
+   );
+
+   BOOST_REQUIRE_GT( total, 8000);
+
+} // buffer_no_allocations
+
+
+
+// =====  END OF test_int2string_buffer.cpp  =====
@@ -96,5 +96,44 @@ BOOST_AUTO_TEST_CASE( test_floats)
 
 
 
+/// Test the conversion from string views with std::from_chars().
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( test_string_view)
+{
+
+   using celma::format::stringTo;
+
+   const std::string_view  values( "42,+17,-9876543210,2.5,abc,4x,300");
+   int                     int_val = 0;
+   int64_t                 long_val = 0;
+   uint8_t                 byte_val = 0;
+   double                  double_val = 0.0;
+
+
+   stringTo( values.substr( 0, 2), int_val);
+   BOOST_REQUIRE_EQUAL( int_val, 42);
+   stringTo( values.substr( 3, 3), int_val);
+   BOOST_REQUIRE_EQUAL( int_val, 17);
+   stringTo( values.substr( 7, 11), long_val);
+   BOOST_REQUIRE_EQUAL( long_val, -9876543210);
+   stringTo( values.substr( 19, 3), double_val);
+   BOOST_REQUIRE_EQUAL( double_val, 2.5);
+
+   BOOST_REQUIRE_THROW( stringTo( values.substr( 7, 11), int_val),
+                        std::out_of_range);
+   BOOST_REQUIRE_THROW( stringTo( values.substr( 23, 3), int_val),
+                        std::invalid_argument);
+   BOOST_REQUIRE_THROW( stringTo( values.substr( 27, 2), int_val),
+                        std::invalid_argument);
+   BOOST_REQUIRE_THROW( stringTo( values.substr( 30, 3), byte_val),
+                        std::out_of_range);
+   BOOST_REQUIRE_THROW( stringTo( std::string_view(), double_val),
+                        std::invalid_argument);
+
+} // test_string_view
+
+
+
 // =====  END OF test_string_to.cpp  =====
 
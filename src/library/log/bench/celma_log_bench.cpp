@@ -0,0 +1,703 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Benchmark program for the log path: Measures the throughput, the latency
+**    per log message and the number of memory allocations per log message for
+**    different log destinations, file policies, numbers of threads and
+**    message creation styles.
+**
+--*/
+
+
+// OS/C lib includes
+#include <unistd.h>
+#include <cstddef>
+#include <cstdlib>
+
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+// project includes
+#include "celma/log/detail/log.hpp"
+#include "celma/log/detail/log_dest_stream.hpp"
+#include "celma/log/filename/creator.hpp"
+#include "celma/log/files/counted.hpp"
+#include "celma/log/files/flat_combining_lock.hpp"
+#include "celma/log/files/handler.hpp"
+#include "celma/log/files/max_size.hpp"
+#include "celma/log/files/simple.hpp"
+#include "celma/log/files/timestamped.hpp"
+#include "celma/log/log_macros.hpp"
+#include "celma/log/logging.hpp"
+#include "celma/prog_args.hpp"
+
+
+namespace {
+
+
+/// Number of memory allocations done by the whole process.
+std::atomic< uint64_t>  num_allocations( 0);
+
+
+/// Counts an allocation and returns the memory.<br>
+/// Not inlined into the operators new: Otherwise the compiler sees that the
+/// memory comes from malloc() and warns about mismatched new/delete calls.
+///
+/// @param[in]  size       Number of bytes to allocate.
+/// @param[in]  alignment  The alignment of the memory, 0 for the default
+///                        alignment.
+/// @return  Pointer to the memory, NULL if the allocation failed.
+/// @since  1.47.0, 18.10.2026
+__attribute__(( noinline))
+   void* countedAlloc( std::size_t size, std::size_t alignment) noexcept
+{
+
+   void*  ptr = nullptr;
+
+
+   num_allocations.fetch_add( 1, std::memory_order_relaxed);
+
+   if (size == 0)
+      size = 1;
+
+   if (alignment <= alignof( std::max_align_t))
+   {
+      ptr = std::malloc( size);
+   } else if (::posix_memalign( &ptr, alignment, size) != 0)
+   {
+      ptr = nullptr;
+   } // end if
+
+   return ptr;
+} // countedAlloc
+
+
+/// Counts an allocation and returns the memory, throws if the allocation
+/// failed.
+///
+/// @param[in]  size       Number of bytes to allocate.
+/// @param[in]  alignment  The alignment of the memory, 0 for the default
+///                        alignment.
+/// @return  Pointer to the memory.
+/// @throw  std::bad_alloc if the allocation failed.
+/// @since  1.47.0, 18.10.2026
+void* countedAllocThrow( std::size_t size, std::size_t alignment)
+{
+
+   void*  ptr = countedAlloc( size, alignment);
+
+
+   if (ptr == nullptr)
+      throw std::bad_alloc();
+
+   return ptr;
+} // countedAllocThrow
+
+
+/// Frees the memory, not inlined for the same reason as countedAlloc().
+///
+/// @param[in]  ptr  Pointer to the memory to free, may be NULL.
+/// @since  1.47.0, 18.10.2026
+__attribute__(( noinline)) void countedFree( void* ptr) noexcept
+{
+   std::free( ptr);
+} // countedFree
+
+
+} // namespace
+
+
+// count all memory allocations of the process, the operators must be replaced
+// consistently, see also celma/test/allocation_counter.hpp
+
+void* operator new( std::size_t size)
+{
+   return countedAllocThrow( size, 0);
+}
+
+void* operator new[]( std::size_t size)
+{
+   return countedAllocThrow( size, 0);
+}
+
+void* operator new( std::size_t size, const std::nothrow_t&) noexcept
+{
+   return countedAlloc( size, 0);
+}
+
+void* operator new[]( std::size_t size, const std::nothrow_t&) noexcept
+{
+   return countedAlloc( size, 0);
+}
+
+void* operator new( std::size_t size, std::align_val_t al)
+{
+   return countedAllocThrow( size, static_cast< std::size_t>( al));
+}
+
+void* operator new[]( std::size_t size, std::align_val_t al)
+{
+   return countedAllocThrow( size, static_cast< std::size_t>( al));
+}
+
+void* operator new( std::size_t size, std::align_val_t al,
+                    const std::nothrow_t&) noexcept
+{
+   return countedAlloc( size, static_cast< std::size_t>( al));
+}
+
+void* operator new[]( std::size_t size, std::align_val_t al,
+                      const std::nothrow_t&) noexcept
+{
+   return countedAlloc( size, static_cast< std::size_t>( al));
+}
+
+void operator delete( void* ptr) noexcept
+{
+   countedFree( ptr);
+}
+
+void operator delete[]( void* ptr) noexcept
+{
+   countedFree( ptr);
+}
+
+void operator delete( void* ptr, std::size_t) noexcept
+{
+   countedFree( ptr);
+}
+
+void operator delete[]( void* ptr, std::size_t) noexcept
+{
+   countedFree( ptr);
+}
+
+void operator delete( void* ptr, const std::nothrow_t&) noexcept
+{
+   countedFree( ptr);
+}
+
+void operator delete[]( void* ptr, const std::nothrow_t&) noexcept
+{
+   countedFree( ptr);
+}
+
+void operator delete( void* ptr, std::align_val_t) noexcept
+{
+   countedFree( ptr);
+}
+
+void operator delete[]( void* ptr, std::align_val_t) noexcept
+{
+   countedFree( ptr);
+}
+
+void operator delete( void* ptr, std::size_t, std::align_val_t) noexcept
+{
+   countedFree( ptr);
+}
+
+void operator delete[]( void* ptr, std::size_t, std::align_val_t) noexcept
+{
+   countedFree( ptr);
+}
+
+void operator delete( void* ptr, std::align_val_t,
+                      const std::nothrow_t&) noexcept
+{
+   countedFree( ptr);
+}
+
+void operator delete[]( void* ptr, std::align_val_t,
+                        const std::nothrow_t&) noexcept
+{
+   countedFree( ptr);
+}
+
+
+namespace {
+
+
+namespace clfn = celma::log::filename;
+namespace clf = celma::log::files;
+
+using celma::log::Logging;
+using celma::log::id_t;
+using std::chrono::steady_clock;
+
+
+/// Stream buffer that discards all data, used for the stream destination.
+/// @since  1.47.0, 18.10.2026
+class NullBuffer final : public std::streambuf
+{
+protected:
+   int_type overflow( int_type ch) override
+   {
+      return traits_type::not_eof( ch);
+   } // NullBuffer::overflow
+
+   std::streamsize xsputn( const char*, std::streamsize n) override
+   {
+      return n;
+   } // NullBuffer::xsputn
+
+}; // NullBuffer
+
+
+/// The style in which the log messages are created.
+enum class Style
+{
+   stream,   //!< LOG_LEVEL() with stream operators.
+   printf    //!< LOG_PRINTF() with format string.
+};
+
+
+/// Description of one benchmark scenario.
+/// @since  1.47.0, 18.10.2026
+struct Scenario
+{
+   /// The name of the scenario.
+   std::string  mName;
+   /// The style in which the log messages are created.
+   Style        mStyle;
+   /// Set if the log destination cannot be used by multiple threads.
+   bool         mSingleThreadOnly;
+   /// Creates the log destination, returns NULL if the log messages should be
+   /// discarded by level.
+   std::function< celma::log::detail::ILogDest*( const std::string&)>  mCreate;
+};
+
+
+/// The results of one benchmark run.
+/// @since  1.47.0, 18.10.2026
+struct Result
+{
+   std::string  mScenario;
+   int          mNumThreads = 0;
+   uint64_t     mNumMessages = 0;
+   double       mMsgPerSec = 0.0;
+   uint64_t     mP50 = 0;
+   uint64_t     mP90 = 0;
+   uint64_t     mP99 = 0;
+   uint64_t     mP999 = 0;
+   uint64_t     mMax = 0;
+   double       mAllocsPerMsg = 0.0;
+};
+
+
+/// Returns a filename definition for a file in the given directory.
+/// @since  1.47.0, 18.10.2026
+clfn::Definition fileDef( const std::string& dir, const std::string& name)
+{
+   clfn::Definition  def;
+   clfn::Creator     creator( def);
+
+   creator << dir << "/" << name << ".log";
+   return def;
+} // fileDef
+
+
+/// Returns the filename definition for /dev/null.
+/// @since  1.47.0, 18.10.2026
+clfn::Definition devNullDef()
+{
+   clfn::Definition  def;
+   clfn::Creator     creator( def);
+
+   creator << "/dev/null";
+   return def;
+} // devNullDef
+
+
+/// Returns a filename definition with a generation number for a file in the
+/// given directory.
+/// @since  1.47.0, 18.10.2026
+clfn::Definition numberedFileDef( const std::string& dir, const std::string& name)
+{
+   clfn::Definition  def;
+   clfn::Creator     creator( def);
+
+   creator << dir << "/" << name << "." << 2 << clfn::number << ".log";
+   return def;
+} // numberedFileDef
+
+
+/// Returns a filename definition with a date for a file in the given
+/// directory.
+/// @since  1.47.0, 18.10.2026
+clfn::Definition datedFileDef( const std::string& dir, const std::string& name)
+{
+   clfn::Definition  def;
+   clfn::Creator     creator( def);
+
+   creator << dir << "/" << name << "." << clfn::date << ".log";
+   return def;
+} // datedFileDef
+
+
+/// Returns the list of all scenarios.
+/// @since  1.47.0, 18.10.2026
+std::vector< Scenario> allScenarios()
+{
+
+   static NullBuffer    null_buffer;
+   static std::ostream  null_stream( &null_buffer);
+
+   using dest_ptr = celma::log::detail::ILogDest*;
+
+   return {
+      { "disabled", Style::stream, false,
+        []( const std::string&) -> dest_ptr { return nullptr; } },
+      { "devnull", Style::stream, false,
+        []( const std::string&) -> dest_ptr
+        {
+           return new clf::Handler< clf::Simple, std::mutex>(
+              new clf::Simple( devNullDef()));
+        } },
+      { "devnull-printf", Style::printf, false,
+        []( const std::string&) -> dest_ptr
+        {
+           return new clf::Handler< clf::Simple, std::mutex>(
+              new clf::Simple( devNullDef()));
+        } },
+      { "stream", Style::stream, true,
+        []( const std::string&) -> dest_ptr
+        {
+           return new celma::log::detail::LogDestStream( null_stream);
+        } },
+      { "file-simple", Style::stream, false,
+        []( const std::string& dir) -> dest_ptr
+        {
+           return new clf::Handler< clf::Simple, std::mutex>(
+              new clf::Simple( fileDef( dir, "simple")));
+        } },
+      { "file-simple-combining", Style::stream, false,
+        []( const std::string& dir) -> dest_ptr
+        {
+           return new clf::Handler< clf::Simple, clf::FlatCombiningLock>(
+              new clf::Simple( fileDef( dir, "combining")));
+        } },
+      { "file-max-size", Style::stream, false,
+        []( const std::string& dir) -> dest_ptr
+        {
+           // small files, so that rollover happens frequently
+           return new clf::Handler< clf::MaxSize, std::mutex>(
+              new clf::MaxSize( numberedFileDef( dir, "max_size"), 100'000, 3));
+        } },
+      { "file-counted", Style::stream, false,
+        []( const std::string& dir) -> dest_ptr
+        {
+           return new clf::Handler< clf::Counted, std::mutex>(
+              new clf::Counted( numberedFileDef( dir, "counted"), 1'000, 3));
+        } },
+      { "file-timestamped", Style::stream, false,
+        []( const std::string& dir) -> dest_ptr
+        {
+           return new clf::Handler< clf::Timestamped, std::mutex>(
+              new clf::Timestamped( datedFileDef( dir, "timestamped")));
+        } },
+   };
+} // allScenarios
+
+
+/// Runs one scenario with the given number of threads.
+/// @since  1.47.0, 18.10.2026
+Result runScenario( const Scenario& scenario, id_t log_id, int num_threads,
+                    uint64_t num_messages)
+{
+
+   std::vector< std::vector< uint32_t>>  latencies( num_threads);
+   std::vector< std::thread>             threads;
+   std::atomic< int>                     num_ready( 0);
+   std::atomic< bool>                    go( false);
+
+
+   for (auto& lat : latencies)
+      lat.resize( num_messages);
+
+   for (int t = 0; t < num_threads; ++t)
+   {
+      threads.emplace_back( [&, t]()
+      {
+         auto&  my_lat = latencies[ t];
+
+         ++num_ready;
+         while (!go.load())
+            std::this_thread::yield();
+
+         for (uint64_t i = 0; i < num_messages; ++i)
+         {
+            const auto  start = steady_clock::now();
+
+            if (scenario.mStyle == Style::stream)
+            {
+               LOG_LEVEL( log_id, info) << "benchmark message " << i
+                                        << " from thread " << t;
+            } else
+            {
+               LOG_PRINTF( log_id, info, application,
+                           "benchmark message %lu from thread %d", i, t);
+            } // end if
+
+            my_lat[ i] = static_cast< uint32_t>( std::min< int64_t>(
+               std::chrono::duration_cast< std::chrono::nanoseconds>(
+                  steady_clock::now() - start).count(), UINT32_MAX));
+         } // end for
+      });
+   } // end for
+
+   while (num_ready.load() < num_threads)
+      std::this_thread::yield();
+
+   const auto  allocs_before = num_allocations.load();
+   const auto  start = steady_clock::now();
+
+   go = true;
+   for (auto& thr : threads)
+      thr.join();
+
+   const auto  elapsed = steady_clock::now() - start;
+   const auto  allocs = num_allocations.load() - allocs_before;
+
+   std::vector< uint32_t>  all;
+
+   all.reserve( num_messages * num_threads);
+   for (auto const& lat : latencies)
+      all.insert( all.end(), lat.begin(), lat.end());
+   std::sort( all.begin(), all.end());
+
+   auto  percentile = [&all]( double p) -> uint64_t
+   {
+      if (all.empty())
+         return 0;
+      const auto  idx = static_cast< size_t>( p * (all.size() - 1));
+      return all[ idx];
+   };
+
+   Result      res;
+   const auto  total_msgs = num_messages * num_threads;
+   const auto  secs = std::chrono::duration< double>( elapsed).count();
+
+   res.mScenario    = scenario.mName;
+   res.mNumThreads  = num_threads;
+   res.mNumMessages = total_msgs;
+   res.mMsgPerSec   = (secs > 0.0) ? total_msgs / secs : 0.0;
+   res.mP50         = percentile( 0.5);
+   res.mP90         = percentile( 0.9);
+   res.mP99         = percentile( 0.99);
+   res.mP999        = percentile( 0.999);
+   res.mMax         = all.empty() ? 0 : all.back();
+   // the thread objects themselves allocate, that is not counted
+   res.mAllocsPerMsg = (total_msgs > 0)
+      ? static_cast< double>( allocs) / total_msgs : 0.0;
+
+   return res;
+} // runScenario
+
+
+/// Prints the results as table.
+/// @since  1.47.0, 18.10.2026
+void printTable( const std::vector< Result>& results)
+{
+
+   std::cout << std::left << std::setw( 24) << "scenario" << std::right
+             << std::setw( 8) << "threads" << std::setw( 14) << "msg/s"
+             << std::setw( 10) << "p50[ns]" << std::setw( 10) << "p90[ns]"
+             << std::setw( 10) << "p99[ns]" << std::setw( 11) << "p99.9[ns]"
+             << std::setw( 12) << "max[ns]" << std::setw( 12) << "allocs/msg"
+             << std::endl;
+
+   for (auto const& res : results)
+   {
+      std::cout << std::left << std::setw( 24) << res.mScenario << std::right
+                << std::setw( 8) << res.mNumThreads
+                << std::setw( 14) << std::fixed << std::setprecision( 0)
+                << res.mMsgPerSec
+                << std::setw( 10) << res.mP50 << std::setw( 10) << res.mP90
+                << std::setw( 10) << res.mP99 << std::setw( 11) << res.mP999
+                << std::setw( 12) << res.mMax
+                << std::setw( 12) << std::setprecision( 2) << res.mAllocsPerMsg
+                << std::endl;
+   } // end for
+
+} // printTable
+
+
+/// Prints the results in CSV format.
+/// @since  1.47.0, 18.10.2026
+void printCsv( const std::vector< Result>& results)
+{
+
+   std::cout << "scenario,threads,messages,msg_per_sec,p50_ns,p90_ns,p99_ns,"
+                "p999_ns,max_ns,allocs_per_msg" << std::endl;
+
+   for (auto const& res : results)
+   {
+      std::cout << res.mScenario << ',' << res.mNumThreads << ','
+                << res.mNumMessages << ',' << std::fixed << std::setprecision( 1)
+                << res.mMsgPerSec << ',' << res.mP50 << ',' << res.mP90 << ','
+                << res.mP99 << ',' << res.mP999 << ',' << res.mMax << ','
+                << std::setprecision( 3) << res.mAllocsPerMsg << std::endl;
+   } // end for
+
+} // printCsv
+
+
+/// Prints the results in JSON format.
+/// @since  1.47.0, 18.10.2026
+void printJson( const std::vector< Result>& results)
+{
+
+   std::cout << "[" << std::endl;
+
+   for (size_t idx = 0; idx < results.size(); ++idx)
+   {
+      auto const&  res = results[ idx];
+
+      std::cout << "  {\"scenario\":\"" << res.mScenario << "\",\"threads\":"
+                << res.mNumThreads << ",\"messages\":" << res.mNumMessages
+                << ",\"msg_per_sec\":" << std::fixed << std::setprecision( 1)
+                << res.mMsgPerSec << ",\"p50_ns\":" << res.mP50
+                << ",\"p90_ns\":" << res.mP90 << ",\"p99_ns\":" << res.mP99
+                << ",\"p999_ns\":" << res.mP999 << ",\"max_ns\":" << res.mMax
+                << ",\"allocs_per_msg\":" << std::setprecision( 3)
+                << res.mAllocsPerMsg << "}"
+                << ((idx + 1 < results.size()) ? "," : "") << std::endl;
+   } // end for
+
+   std::cout << "]" << std::endl;
+
+} // printJson
+
+
+} // namespace
+
+
+
+/// Main function of the benchmark program.
+///
+/// @param[in]  argc  Number of arguments passed to the program.
+/// @param[in]  argv  List of argument strings.
+/// @return  EXIT_SUCCESS if the benchmarks were run successfully.
+/// @since  1.47.0, 18.10.2026
+int main( int argc, char* argv[])
+{
+
+   namespace cpa = celma::prog_args;
+
+   uint64_t                   num_messages = 100'000;
+   std::vector< int>          thread_counts = { 1, 2, 4, 8, 16, 32, 64 };
+   std::vector< std::string>  selected;
+   bool                       csv_output = false;
+   bool                       json_output = false;
+   bool                       quick = false;
+
+
+   try
+   {
+      cpa::Handler  ah( cpa::Handler::hfHelpShort | cpa::Handler::hfHelpLong);
+
+      ah.addArgument( "m,messages", DEST_VAR( num_messages),
+                      "Number of log messages per thread.");
+      ah.addArgument( "t,threads", DEST_VAR( thread_counts),
+                      "List of the numbers of threads to run each scenario "
+                      "with.")->setClearBeforeAssign();
+      ah.addArgument( "s,scenarios", DEST_VAR( selected),
+                      "Names of the scenarios to run, default is all.");
+      ah.addArgument( "csv", DEST_VAR( csv_output), "Print results as CSV.");
+      ah.addArgument( "json", DEST_VAR( json_output), "Print results as JSON.");
+      ah.addArgument( "quick", DEST_VAR( quick),
+                      "Quick run with few messages and threads, e.g. to check "
+                      "that the benchmarks work.");
+
+      ah.evalArguments( argc, argv);
+   } catch (const std::exception& e)
+   {
+      std::cerr << "*** ERROR: " << e.what() << std::endl;
+      return EXIT_FAILURE;
+   } // end try
+
+   if (quick)
+   {
+      num_messages  = 500;
+      thread_counts = { 1, 4 };
+   } // end if
+
+   const auto  bench_dir = std::filesystem::temp_directory_path()
+      / ("celma_log_bench_" + std::to_string( ::getpid()));
+
+   std::filesystem::create_directories( bench_dir);
+
+   std::vector< Result>  results;
+
+   for (auto const& scenario : allScenarios())
+   {
+      if (!selected.empty()
+          && (std::find( selected.begin(), selected.end(), scenario.mName)
+              == selected.end()))
+         continue;   // for
+
+      const auto  log_id = Logging::instance().findCreateLog( scenario.mName);
+      auto        my_log = Logging::instance().getLog( log_id);
+
+      for (auto num_threads : thread_counts)
+      {
+         if ((num_threads > 1) && scenario.mSingleThreadOnly)
+            continue;   // for
+
+         auto  dest = scenario.mCreate( bench_dir.string());
+
+         if (dest == nullptr)
+         {
+            my_log->maxLevel( celma::log::LogLevel::error);
+         } else
+         {
+            my_log->addDestination( "bench", dest);
+         } // end if
+
+         results.push_back( runScenario( scenario, log_id, num_threads,
+                                         num_messages));
+
+         if (dest != nullptr)
+            my_log->removeDestination( "bench");
+      } // end for
+   } // end for
+
+   std::filesystem::remove_all( bench_dir);
+
+   if (json_output)
+      printJson( results);
+   else if (csv_output)
+      printCsv( results);
+   else
+      printTable( results);
+
+   return EXIT_SUCCESS;
+} // main
+
+
+
+// =====  END OF celma_log_bench.cpp  =====
+
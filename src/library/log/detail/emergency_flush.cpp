@@ -0,0 +1,363 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of class celma::log::detail::IEmergencyFlush.
+
+
+// module header file include
+#include "celma/log/detail/emergency_flush.hpp"
+
+
+// OS/C library includes
+#include <signal.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+
+// C++ Standard Library includes
+#include <atomic>
+#include <memory>
+#include <new>
+
+
+namespace celma::log::detail {
+
+
+namespace {
+
+
+/// Maximum number of emergency flush objects that can be registered.
+constexpr size_t  MaxEmergencyFlush = 32;
+
+/// Maximum number of signals for which the handler can be installed.
+constexpr size_t  MaxSignals = 16;
+
+/// The list of the registered emergency flush objects.
+std::atomic< IEmergencyFlush*>  registered[ MaxEmergencyFlush];
+
+/// The signals for which the handler is installed, 0 for unused entries.
+int  handled_signals[ MaxSignals];
+
+/// The previous handling of the signals.
+struct sigaction  prev_actions[ MaxSignals];
+
+/// Size of the alternate signal stack.
+constexpr size_t  AltStackSize = 64 * 1024;
+
+
+/// Alternate stack for the signal handler of one thread, so the pending log
+/// messages can be written also after a stack overflow in this thread.<br>
+/// The stack is allocated when it is installed, and disabled and freed when
+/// the thread ends.
+///
+/// @since  1.47.0, 18.10.2026
+class AltStack
+{
+public:
+   AltStack() = default;
+   AltStack( const AltStack&) = delete;
+   AltStack& operator =( const AltStack&) = delete;
+
+   /// Disables the alternate stack of the thread before the memory is freed.
+   ///
+   /// @since  1.47.0, 18.10.2026
+   ~AltStack()
+   {
+      if (mpStack)
+      {
+         stack_t  ss;
+
+         ::memset( &ss, 0, sizeof( ss));
+         ss.ss_flags = SS_DISABLE;
+         ::sigaltstack( &ss, nullptr);
+      } // end if
+   } // AltStack::~AltStack
+
+   /// Allocates the stack and installs it as alternate signal stack of the
+   /// calling thread, if this was not done before.
+   ///
+   /// @return  \c true if the alternate stack is installed.
+   /// @since  1.47.0, 18.10.2026
+   bool install() noexcept
+   {
+      if (mpStack)
+         return true;
+
+      mpStack.reset( new (std::nothrow) char[ AltStackSize]);
+      if (!mpStack)
+         return false;
+
+      stack_t  ss;
+
+      ::memset( &ss, 0, sizeof( ss));
+      ss.ss_sp   = mpStack.get();
+      ss.ss_size = AltStackSize;
+      if (::sigaltstack( &ss, nullptr) != 0)
+      {
+         mpStack.reset();
+         return false;
+      } // end if
+
+      return true;
+   } // AltStack::install
+
+private:
+   /// The memory of the stack.
+   std::unique_ptr< char[]>  mpStack;
+
+}; // AltStack
+
+
+/// The alternate signal stack of the thread.
+thread_local AltStack  alt_stack;
+
+
+/// The signal handler: Calls all registered emergency flush objects, then
+/// raises the signal again with the default handling, which terminates the
+/// process.<br>
+/// If another thread caught a signal before and is still writing the pending
+/// log messages, the calling thread waits until the process is terminated by
+/// the flushing thread. If the flushing thread itself crashes again, the
+/// signal is raised immediately.
+///
+/// @param[in]  sig_nbr  The number of the signal that was caught.
+/// @since  1.47.0, 18.10.2026
+extern "C" void emergencyFlushHandler( int sig_nbr)
+{
+
+   // the id of the thread that flushes, 0 as long as no thread does
+   static std::atomic< long>  flushing_thread( 0);
+
+   const long  my_thread = ::syscall( SYS_gettid);
+   long        no_thread = 0;
+
+
+   if (flushing_thread.compare_exchange_strong( no_thread, my_thread))
+   {
+      for (auto& slot : registered)
+      {
+         if (auto ef = slot.load(); ef != nullptr)
+            ef->emergencyFlush( sig_nbr);
+      } // end for
+   } else if (no_thread != my_thread)
+   {
+      // another thread is writing the pending log messages, it will
+      // terminate the process when it's done
+      for (;;)
+         ::pause();
+   } // end if
+
+   struct sigaction  dfl_action;
+   sigset_t          sig_set;
+
+   ::memset( &dfl_action, 0, sizeof( dfl_action));
+   dfl_action.sa_handler = SIG_DFL;
+   ::sigemptyset( &dfl_action.sa_mask);
+   ::sigaction( sig_nbr, &dfl_action, nullptr);
+
+   ::sigemptyset( &sig_set);
+   ::sigaddset( &sig_set, sig_nbr);
+   ::sigprocmask( SIG_UNBLOCK, &sig_set, nullptr);
+   ::raise( sig_nbr);
+
+} // emergencyFlushHandler
+
+
+} // namespace
+
+
+
+/// Adds an object to the list of objects that are called when the process is
+/// terminated by a signal.
+///
+/// @param[in]  ef  Pointer to the object to add.
+/// @return  \c true if the object could be added, \c false if the list is full.
+/// @since  1.47.0, 18.10.2026
+bool registerEmergencyFlush( IEmergencyFlush* ef) noexcept
+{
+
+   for (auto& slot : registered)
+   {
+      IEmergencyFlush*  expected = nullptr;
+      if (slot.compare_exchange_strong( expected, ef))
+         return true;
+   } // end for
+
+   return false;
+} // registerEmergencyFlush
+
+
+
+/// Removes an object from the list of emergency flush objects.
+///
+/// @param[in]  ef  Pointer to the object to remove.
+/// @since  1.47.0, 18.10.2026
+void unregisterEmergencyFlush( IEmergencyFlush* ef) noexcept
+{
+
+   for (auto& slot : registered)
+   {
+      IEmergencyFlush*  expected = ef;
+      if (slot.compare_exchange_strong( expected, nullptr))
+         return;
+   } // end for
+
+} // unregisterEmergencyFlush
+
+
+
+/// Installs the signal handler for the given signals.
+///
+/// @param[in]  signals  The numbers of the signals to handle.
+/// @since  1.47.0, 18.10.2026
+void installEmergencyFlushHandler( std::initializer_list< int> signals) noexcept
+{
+
+   installEmergencyAltStack();
+
+   for (auto sig_nbr : signals)
+   {
+      size_t  idx = 0;
+
+      // skip signals that are already handled, find a free entry
+      while ((idx < MaxSignals) && (handled_signals[ idx] != 0)
+             && (handled_signals[ idx] != sig_nbr))
+         ++idx;
+      if ((idx == MaxSignals) || (handled_signals[ idx] == sig_nbr))
+         continue;   // for
+
+      struct sigaction  action;
+
+      ::memset( &action, 0, sizeof( action));
+      action.sa_handler = emergencyFlushHandler;
+      ::sigemptyset( &action.sa_mask);
+      action.sa_flags = SA_ONSTACK;
+
+      if (::sigaction( sig_nbr, &action, &prev_actions[ idx]) == 0)
+         handled_signals[ idx] = sig_nbr;
+   } // end for
+
+} // installEmergencyFlushHandler
+
+
+
+/// Installs the alternate signal stack for the emergency flush handler for the
+/// calling thread.
+///
+/// @return  \c true if the alternate stack is installed.
+/// @since  1.47.0, 18.10.2026
+bool installEmergencyAltStack() noexcept
+{
+
+   return alt_stack.install();
+} // installEmergencyAltStack
+
+
+
+/// Restores the previous handling for all signals for which the emergency
+/// flush handler was installed.
+///
+/// @since  1.47.0, 18.10.2026
+void removeEmergencyFlushHandler() noexcept
+{
+
+   for (size_t idx = 0; idx < MaxSignals; ++idx)
+   {
+      if (handled_signals[ idx] != 0)
+      {
+         ::sigaction( handled_signals[ idx], &prev_actions[ idx], nullptr);
+         handled_signals[ idx] = 0;
+      } // end if
+   } // end for
+
+} // removeEmergencyFlushHandler
+
+
+
+/// Async-signal-safe: Writes all data into the file descriptor, retries on
+/// partial writes and interrupts.
+///
+/// @param[in]  fd    The file descriptor to write into.
+/// @param[in]  data  Pointer to the data to write.
+/// @param[in]  len   The number of bytes to write.
+/// @return  \c true if all data was written.
+/// @since  1.47.0, 18.10.2026
+bool writeAll( int fd, const char* data, size_t len) noexcept
+{
+
+   while (len > 0)
+   {
+      const auto  result = ::write( fd, data, len);
+      if (result > 0)
+      {
+         data += result;
+         len  -= result;
+      } else if ((result == -1) && (errno == EINTR))
+      {
+         continue;   // while
+      } else
+      {
+         return false;
+      } // end if
+   } // end while
+
+   return true;
+} // writeAll
+
+
+
+/// Async-signal-safe: Writes the marker line with the signal number into the
+/// file descriptor.
+///
+/// @param[in]  fd       The file descriptor to write into.
+/// @param[in]  sig_nbr  The number of the signal.
+/// @since  1.47.0, 18.10.2026
+void writeSignalMarker( int fd, int sig_nbr) noexcept
+{
+
+   static constexpr char  prefix[] = "*** emergency flush: terminated by signal ";
+   static constexpr char  suffix[] = " ***\n";
+   char                   line[ sizeof( prefix) + sizeof( suffix) + 12];
+   char                   digits[ 12];
+   size_t                 num_digits = 0;
+   unsigned int           value = (sig_nbr < 0) ? 0 : sig_nbr;
+
+
+   do
+   {
+      digits[ num_digits++] = '0' + (value % 10);
+      value /= 10;
+   } while (value > 0);
+
+   size_t  len = sizeof( prefix) - 1;
+
+   ::memcpy( line, prefix, len);
+   while (num_digits > 0)
+      line[ len++] = digits[ --num_digits];
+   ::memcpy( line + len, suffix, sizeof( suffix) - 1);
+   len += sizeof( suffix) - 1;
+
+   writeAll( fd, line, len);
+
+} // writeSignalMarker
+
+
+
+} // namespace celma::log::detail
+
+
+// =====  END OF emergency_flush.cpp  =====
+
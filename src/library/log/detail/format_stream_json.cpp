@@ -0,0 +1,309 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of class celma::log::detail::FormatStreamJson.
+
+
+// module header file include
+#include "celma/log/detail/format_stream_json.hpp"
+
+
+// OS/C library includes
+#ifdef __SSE2__
+#  include <emmintrin.h>
+#endif
+
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+
+// project includes
+#include "celma/format/int2string.hpp"
+#include "celma/log/log_attributes.hpp"
+#include "celma/log/logging.hpp"
+
+
+namespace celma::log::detail {
+
+
+namespace {
+
+
+// the key prefixes of the fields, including the separators
+constexpr std::string_view  KeyTimestamp(  "{\"timestamp_us\":");
+constexpr std::string_view  KeyPid(        ",\"pid\":");
+constexpr std::string_view  KeyThread(     ",\"thread\":");
+constexpr std::string_view  KeyFile(       ",\"file\":\"");
+constexpr std::string_view  KeyFunction(   "\",\"function\":\"");
+constexpr std::string_view  KeyLine(       "\",\"line\":");
+constexpr std::string_view  KeyClass(      ",\"class\":\"");
+constexpr std::string_view  KeyLevel(      "\",\"level\":\"");
+constexpr std::string_view  KeyError(      "\",\"error\":");
+constexpr std::string_view  KeyText(       ",\"text\":\"");
+constexpr std::string_view  KeyAttributes( "\",\"attributes\":{");
+
+
+/// Appends a string view to the destination string.
+///
+/// @param[out]  dest  The string to append to.
+/// @param[in]   sv    The string view to append.
+/// @since  1.47.0, 18.10.2026
+inline void append( std::string& dest, std::string_view sv)
+{
+   dest.append( sv.data(), sv.size());
+} // append
+
+
+/// Appends an integer value to the destination string.
+///
+/// @tparam  T  The type of the value.
+/// @param[out]  dest   The string to append to.
+/// @param[in]   value  The value to append.
+/// @since  1.47.0, 18.10.2026
+template< typename T> void appendNumber( std::string& dest, T value)
+{
+   char  buffer[ 24];
+   auto  len = format::int2string( buffer, value);
+   dest.append( buffer, len);
+} // appendNumber
+
+
+/// Returns the position of the first character in the range that must be
+/// escaped in a JSON string.
+///
+/// @param[in]  pos  Pointer to the first character to check.
+/// @param[in]  end  Pointer to the end of the range.
+/// @return
+///    Pointer to the first character to escape, \a end if there is none.
+/// @since  1.47.0, 18.10.2026
+const char* findEscape( const char* pos, const char* const end)
+{
+
+#ifdef __SSE2__
+   const __m128i  quote = _mm_set1_epi8( '"');
+   const __m128i  backslash = _mm_set1_epi8( '\\');
+   const __m128i  ctrl_max = _mm_set1_epi8( 0x1f);
+
+   while (end - pos >= 16)
+   {
+      const __m128i  chunk = _mm_loadu_si128( reinterpret_cast< const __m128i*>( pos));
+      // unsigned compare chunk <= 0x1f: max( chunk, 0x1f) == 0x1f
+      const __m128i  is_ctrl = _mm_cmpeq_epi8( _mm_max_epu8( chunk, ctrl_max),
+                                               ctrl_max);
+      const __m128i  is_special = _mm_or_si128(
+         _mm_or_si128( _mm_cmpeq_epi8( chunk, quote),
+                       _mm_cmpeq_epi8( chunk, backslash)),
+         is_ctrl);
+      const int  mask = _mm_movemask_epi8( is_special);
+
+      if (mask != 0)
+         return pos + __builtin_ctz( mask);
+      pos += 16;
+   } // end while
+#endif
+
+   for (; pos < end; ++pos)
+   {
+      const auto  ch = static_cast< unsigned char>( *pos);
+      if ((ch < 0x20) || (ch == '"') || (ch == '\\'))
+         break;   // for
+   } // end for
+
+   return pos;
+} // findEscape
+
+
+/// Appends the escape sequence for a character to the destination string.
+///
+/// @param[out]  dest  The string to append to.
+/// @param[in]   ch    The character to escape.
+/// @since  1.47.0, 18.10.2026
+void appendEscapedChar( std::string& dest, char ch)
+{
+
+   switch (ch)
+   {
+   case '"':   dest.append( "\\\"", 2);  break;
+   case '\\':  dest.append( "\\\\", 2);  break;
+   case '\b':  dest.append( "\\b", 2);   break;
+   case '\f':  dest.append( "\\f", 2);   break;
+   case '\n':  dest.append( "\\n", 2);   break;
+   case '\r':  dest.append( "\\r", 2);   break;
+   case '\t':  dest.append( "\\t", 2);   break;
+   default:
+      {
+         static constexpr char  hex_digits[] = "0123456789abcdef";
+         const auto  uch = static_cast< unsigned char>( ch);
+         const char  seq[ 6] = { '\\', 'u', '0', '0', hex_digits[ uch >> 4],
+                                 hex_digits[ uch & 0x0f] };
+         dest.append( seq, sizeof( seq));
+      } // end scope
+      break;
+   } // end switch
+
+} // appendEscapedChar
+
+
+} // namespace
+
+
+
+/// Constructor.
+///
+/// @param[in]  with_attributes
+///    Set to \c false if the attributes should not be written.
+/// @since  1.47.0, 18.10.2026
+FormatStreamJson::FormatStreamJson( bool with_attributes):
+   IFormatStream(),
+   mWithAttributes( with_attributes)
+{
+} // FormatStreamJson::FormatStreamJson
+
+
+
+/// Appends the given string to the destination string, with all characters
+/// escaped that must be escaped in a JSON string.
+///
+/// @param[out]  dest
+///    The string to append to.
+/// @param[in]   str
+///    The string to escape.
+/// @since  1.47.0, 18.10.2026
+void FormatStreamJson::appendEscaped( std::string& dest, const std::string& str)
+{
+
+   const char*        run_start = str.data();
+   const char* const  end = run_start + str.size();
+
+
+   for (;;)
+   {
+      const char*  pos = findEscape( run_start, end);
+
+      dest.append( run_start, pos - run_start);
+      if (pos == end)
+         break;   // for
+
+      appendEscapedChar( dest, *pos);
+      run_start = pos + 1;
+   } // end for
+
+} // FormatStreamJson::appendEscaped
+
+
+
+/// Implementation of the interface: Generate the log entry.
+///
+/// @param[out]  out  The stream to write the log entry into.
+/// @param[in]   msg  The log message object with the data to log.
+/// @since  1.47.0, 18.10.2026
+void FormatStreamJson::format( std::ostream& out, const LogMsg& msg) const
+{
+
+   // re-use the buffer, so in the steady state no memory must be allocated
+   static thread_local std::string  buffer;
+
+
+   buffer.clear();
+
+   append( buffer, KeyTimestamp);
+   appendNumber( buffer, static_cast< int64_t>( msg.getTimestamp()) * 1'000'000
+                         + msg.getTimeMicroSecs());
+   append( buffer, KeyPid);
+   appendNumber( buffer, static_cast< int64_t>( msg.getProcessId()));
+   append( buffer, KeyThread);
+   appendNumber( buffer, static_cast< uint64_t>( msg.getThreadId()));
+   append( buffer, KeyFile);
+   appendEscaped( buffer, msg.getFileName());
+   append( buffer, KeyFunction);
+   appendEscaped( buffer, msg.getFunctionName());
+   append( buffer, KeyLine);
+   appendNumber( buffer, static_cast< int64_t>( msg.getLineNbr()));
+   append( buffer, KeyClass);
+   buffer.append( logClass2text( msg.getClass()));
+   append( buffer, KeyLevel);
+   buffer.append( logLevel2text( msg.getLevel()));
+   append( buffer, KeyError);
+   appendNumber( buffer, static_cast< int64_t>( msg.getErrorNbr()));
+   append( buffer, KeyText);
+   appendEscaped( buffer, msg.getText());
+
+   if (mWithAttributes)
+   {
+      append( buffer, KeyAttributes);
+      appendAttributes( buffer, msg);
+      buffer.append( "}}\n", 3);
+   } else
+   {
+      buffer.append( "\"}\n", 3);
+   } // end if
+
+   out.write( buffer.data(), buffer.size());
+
+} // FormatStreamJson::format
+
+
+
+/// Writes the attributes object into the destination string.
+///
+/// @param[out]  dest  The string to append the attributes to.
+/// @param[in]   msg   The log message to write the attributes of.
+/// @since  1.47.0, 18.10.2026
+void FormatStreamJson::appendAttributes( std::string& dest,
+   const LogMsg& msg) const
+{
+
+   // names of the attributes written so far, an attribute with the same name
+   // and a lower precedence must be skipped
+   static thread_local std::vector< const std::string*>  written;
+
+
+   written.clear();
+
+   auto  add_attr = [&]( const std::string& name, const std::string& value)
+   {
+      if (value.empty()
+          || std::any_of( written.begin(), written.end(),
+                          [&name]( const std::string* n) { return *n == name; }))
+         return;
+
+      if (!written.empty())
+         dest.append( ",\"", 2);
+      else
+         dest.append( "\"", 1);
+      appendEscaped( dest, name);
+      dest.append( "\":\"", 3);
+      appendEscaped( dest, value);
+      dest.append( "\"", 1);
+      written.push_back( &name);
+   };
+
+   if (msg.getAttributes() != nullptr)
+      msg.getAttributes()->visitAttributes( add_attr);
+   Logging::instance().visitAttributes( add_attr);
+
+} // FormatStreamJson::appendAttributes
+
+
+
+} // namespace celma::log::detail
+
+
+// =====  END OF format_stream_json.cpp  =====
+
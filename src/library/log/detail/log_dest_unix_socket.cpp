@@ -0,0 +1,438 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of class celma::log::detail::LogDestUnixSocket.
+
+
+// module header file include
+#include "celma/log/detail/log_dest_unix_socket.hpp"
+
+
+// OS/C library includes
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+
+// C++ Standard Library includes
+#include <ostream>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+
+
+// project includes
+#include "celma/log/detail/format_stream_default.hpp"
+#include "celma/log/detail/log_msg.hpp"
+
+
+namespace celma::log::detail {
+
+
+namespace {
+
+
+/// Switches the socket into non-blocking mode.
+///
+/// @param[in]  sock_fd  The file descriptor of the socket.
+/// @return  \c true if the mode could be set successfully.
+/// @since  1.47.0, 18.10.2026
+bool setNonBlocking( int sock_fd)
+{
+   const int  flags = ::fcntl( sock_fd, F_GETFL, 0);
+   return (flags != -1) && (::fcntl( sock_fd, F_SETFL, flags | O_NONBLOCK) != -1);
+} // setNonBlocking
+
+
+/// Flags to use for all send calls: Never block, and no SIGPIPE when the peer
+/// closed the socket.
+constexpr int  SendFlags = MSG_DONTWAIT | MSG_NOSIGNAL;
+
+
+/// Stream buffer that appends all data to a string. Used to format the log
+/// messages, so that the text can be swapped into the batch instead of being
+/// copied from a string stream.
+///
+/// @since  1.47.0, 18.10.2026
+class StringAppendBuffer final : public std::streambuf
+{
+public:
+   /// The formatted text.
+   std::string  mText;
+
+protected:
+   int_type overflow( int_type ch) override
+   {
+      if (!traits_type::eq_int_type( ch, traits_type::eof()))
+         mText.push_back( traits_type::to_char_type( ch));
+      return traits_type::not_eof( ch);
+   } // StringAppendBuffer::overflow
+
+   std::streamsize xsputn( const char* s, std::streamsize n) override
+   {
+      mText.append( s, n);
+      return n;
+   } // StringAppendBuffer::xsputn
+
+}; // StringAppendBuffer
+
+
+} // namespace
+
+
+
+/// Constructor, creates a socket and connects it to the socket with the
+/// given path.
+///
+/// @param[in]  socket_path
+///    The path of the socket to send the log messages to.
+/// @param[in]  socket_type
+///    The type of the socket to create.
+/// @param[in]  batch_size
+///    The number of log messages to collect before they are sent.
+/// @throw  std::runtime_error when the socket could not be created or
+///         connected.
+/// @since  1.47.0, 18.10.2026
+LogDestUnixSocket::LogDestUnixSocket( const std::string& socket_path,
+   SocketType socket_type, size_t batch_size):
+      ILogDest(),
+      mSocketType( socket_type),
+      mBatchSize( (batch_size == 0) ? 1 : batch_size),
+      mpFormatter( new FormatStreamDefault()),
+      mBatch( mBatchSize),
+      mIoVecs( mBatchSize),
+      mMsgHeaders( mBatchSize)
+{
+
+   struct sockaddr_un  addr;
+
+
+   if (socket_path.empty() || (socket_path.length() >= sizeof( addr.sun_path)))
+      throw std::runtime_error( "invalid socket path '" + socket_path + "'");
+
+   mSocket = ::socket( AF_UNIX, (socket_type == SocketType::datagram)
+                       ? SOCK_DGRAM : SOCK_STREAM, 0);
+   if (mSocket == -1)
+      throw std::runtime_error( std::string( "could not create socket: ")
+                                + ::strerror( errno));
+
+   ::memset( &addr, 0, sizeof( addr));
+   addr.sun_family = AF_UNIX;
+   ::strncpy( addr.sun_path, socket_path.c_str(), sizeof( addr.sun_path) - 1);
+
+   if (::connect( mSocket, reinterpret_cast< struct sockaddr*>( &addr),
+                  sizeof( addr)) == -1)
+   {
+      const std::string  err_text( ::strerror( errno));
+      ::close( mSocket);
+      throw std::runtime_error( "could not connect to socket '" + socket_path
+                                + "': " + err_text);
+   } // end if
+
+   setNonBlocking( mSocket);
+   registerEmergencyFlush( this);
+
+} // LogDestUnixSocket::LogDestUnixSocket
+
+
+
+/// Constructor for a socket that is already connected, e.g. one end of a
+/// socket pair.
+///
+/// @param[in]  sock_fd
+///    The file descriptor of the connected socket.
+/// @param[in]  batch_size
+///    The number of log messages to collect before they are sent.
+/// @throw  std::invalid_argument when the file descriptor is invalid.
+/// @since  1.47.0, 18.10.2026
+LogDestUnixSocket::LogDestUnixSocket( int sock_fd, size_t batch_size):
+   ILogDest(),
+   mSocket( sock_fd),
+   mSocketType( SocketType::datagram),
+   mBatchSize( (batch_size == 0) ? 1 : batch_size),
+   mpFormatter( new FormatStreamDefault()),
+   mBatch( mBatchSize),
+   mIoVecs( mBatchSize),
+   mMsgHeaders( mBatchSize)
+{
+
+   int        sock_type = 0;
+   socklen_t  opt_len = sizeof( sock_type);
+
+
+   if ((sock_fd < 0)
+       || (::getsockopt( sock_fd, SOL_SOCKET, SO_TYPE, &sock_type, &opt_len) == -1))
+      throw std::invalid_argument( "invalid socket file descriptor");
+
+   if (sock_type == SOCK_STREAM)
+      mSocketType = SocketType::stream;
+
+   setNonBlocking( mSocket);
+   registerEmergencyFlush( this);
+
+} // LogDestUnixSocket::LogDestUnixSocket
+
+
+
+/// Sends the remaining log messages and closes the socket.
+///
+/// @since  1.47.0, 18.10.2026
+LogDestUnixSocket::~LogDestUnixSocket()
+{
+
+   unregisterEmergencyFlush( this);
+   flush();
+   ::close( mSocket);
+
+} // LogDestUnixSocket::~LogDestUnixSocket
+
+
+
+/// Sets the new formatter to use.
+///
+/// @param[in]  formatter
+///    Pointer to the new formatter object to use. If a NULL pointer is
+///    passed, the previous formatter is replaced by the default stream
+///    formatter.
+/// @since  1.47.0, 18.10.2026
+void LogDestUnixSocket::setFormatter( IFormatBase* formatter)
+{
+
+   mpFormatter.reset(
+      (formatter == nullptr) ? new FormatStreamDefault() :
+                               static_cast< IFormatStream*>( formatter));
+
+} // LogDestUnixSocket::setFormatter
+
+
+
+/// Sends the log messages that are currently collected, even if the batch
+/// is not complete yet.
+///
+/// @since  1.47.0, 18.10.2026
+void LogDestUnixSocket::flush()
+{
+
+   const std::lock_guard< std::mutex>  lock( mMutex);
+
+
+   sendBatch();
+
+} // LogDestUnixSocket::flush
+
+
+
+/// Called through the base class. Formats the log message and adds it to
+/// the current batch. Sends the batch when it is complete.
+///
+/// @param[in]  msg  The message to send.
+/// @since  1.47.0, 18.10.2026
+void LogDestUnixSocket::message( const LogMsg& msg)
+{
+
+   // format outside the lock, re-use the stream of the thread
+   static thread_local StringAppendBuffer  msg_buffer;
+   static thread_local std::ostream        msg_text( &msg_buffer);
+
+
+   msg_buffer.mText.clear();
+   mpFormatter->formatMsg( msg_text, msg);
+
+   const std::lock_guard< std::mutex>  lock( mMutex);
+
+   // the thread gets the string of the batch entry in exchange, so the memory
+   // of both is re-used
+   mBatch[ mBatchUsed++].swap( msg_buffer.mText);
+   if (mBatchUsed == mBatchSize)
+      sendBatch();
+
+} // LogDestUnixSocket::message
+
+
+
+/// Implementation of the IEmergencyFlush interface: Sends the log messages
+/// of the current batch and the marker line.
+///
+/// @param[in]  sig_nbr  The number of the signal that was caught.
+/// @since  1.47.0, 18.10.2026
+void LogDestUnixSocket::emergencyFlush( int sig_nbr) noexcept
+{
+
+   // the mutex cannot be used here, access the data as it is
+   if (!mPartial.empty())
+      writeAll( mSocket, mPartial.data(), mPartial.length());
+
+   for (size_t idx = 0; (idx < mBatchUsed) && (idx < mBatchSize); ++idx)
+      writeAll( mSocket, mBatch[ idx].data(), mBatch[ idx].length());
+
+   writeSignalMarker( mSocket, sig_nbr);
+
+} // LogDestUnixSocket::emergencyFlush
+
+
+
+/// Sends the current batch of log messages. Must be called with the mutex
+/// locked.
+///
+/// @since  1.47.0, 18.10.2026
+void LogDestUnixSocket::sendBatch()
+{
+
+   if (mSocketType == SocketType::datagram)
+      sendDatagrams();
+   else
+      sendStream();
+
+   mBatchUsed = 0;
+
+} // LogDestUnixSocket::sendBatch
+
+
+
+/// Sends the current batch through a datagram socket.
+///
+/// @since  1.47.0, 18.10.2026
+void LogDestUnixSocket::sendDatagrams()
+{
+
+   if (mBatchUsed == 0)
+      return;
+
+   for (size_t idx = 0; idx < mBatchUsed; ++idx)
+   {
+      mIoVecs[ idx].iov_base = mBatch[ idx].data();
+      mIoVecs[ idx].iov_len  = mBatch[ idx].length();
+      ::memset( &mMsgHeaders[ idx], 0, sizeof( struct mmsghdr));
+      mMsgHeaders[ idx].msg_hdr.msg_iov    = &mIoVecs[ idx];
+      mMsgHeaders[ idx].msg_hdr.msg_iovlen = 1;
+   } // end for
+
+   size_t  num_sent = 0;
+
+   while (num_sent < mBatchUsed)
+   {
+      const int  result = ::sendmmsg( mSocket, &mMsgHeaders[ num_sent],
+                                      mBatchUsed - num_sent, SendFlags);
+      if (result > 0)
+      {
+         num_sent += result;
+      } else if ((result == -1) && (errno == EINTR))
+      {
+         continue;   // while
+      } else
+      {
+         if ((result == -1) && (errno != EAGAIN) && (errno != EWOULDBLOCK))
+            ++mNumErrors;
+         break;   // while
+      } // end if
+   } // end while
+
+   mNumSent    += num_sent;
+   mNumDropped += mBatchUsed - num_sent;
+
+} // LogDestUnixSocket::sendDatagrams
+
+
+
+/// Sends the current batch through a stream socket.
+///
+/// @since  1.47.0, 18.10.2026
+void LogDestUnixSocket::sendStream()
+{
+
+   // first complete a log message that was sent partially before
+   while (!mPartial.empty())
+   {
+      const auto  result = ::send( mSocket, mPartial.data(), mPartial.length(),
+                                   SendFlags);
+      if (result > 0)
+      {
+         mPartial.erase( 0, result);
+      } else if ((result == -1) && (errno == EINTR))
+      {
+         continue;   // while
+      } else
+      {
+         if ((result == -1) && (errno != EAGAIN) && (errno != EWOULDBLOCK))
+         {
+            ++mNumErrors;
+            mPartial.clear();
+         } // end if
+         mNumDropped += mBatchUsed;
+         return;
+      } // end if
+   } // end while
+
+   if (mBatchUsed == 0)
+      return;
+
+   struct msghdr  hdr;
+
+
+   for (size_t idx = 0; idx < mBatchUsed; ++idx)
+   {
+      mIoVecs[ idx].iov_base = mBatch[ idx].data();
+      mIoVecs[ idx].iov_len  = mBatch[ idx].length();
+   } // end for
+
+   ::memset( &hdr, 0, sizeof( hdr));
+   hdr.msg_iov    = mIoVecs.data();
+   hdr.msg_iovlen = mBatchUsed;
+
+   ssize_t  result = -1;
+
+   do
+   {
+      result = ::sendmsg( mSocket, &hdr, SendFlags);
+   } while ((result == -1) && (errno == EINTR));
+
+   if (result == -1)
+   {
+      if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+         ++mNumErrors;
+      mNumDropped += mBatchUsed;
+      return;
+   } // end if
+
+   // find the log message where sending stopped, a partially sent message is
+   // completed with the next batch
+   size_t  bytes_left = result;
+   size_t  idx = 0;
+
+   for (; (idx < mBatchUsed) && (bytes_left >= mBatch[ idx].length()); ++idx)
+   {
+      bytes_left -= mBatch[ idx].length();
+   } // end for
+
+   if ((idx < mBatchUsed) && (bytes_left > 0))
+   {
+      mPartial.assign( mBatch[ idx], bytes_left, std::string::npos);
+      ++idx;
+   } // end if
+
+   mNumSent    += idx;
+   mNumDropped += mBatchUsed - idx;
+
+} // LogDestUnixSocket::sendStream
+
+
+
+} // namespace celma::log::detail
+
+
+// =====  END OF log_dest_unix_socket.cpp  =====
+
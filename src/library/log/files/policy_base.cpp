@@ -142,6 +142,43 @@ void PolicyBase::writeMessage( const detail::LogMsg& msg,
 
 
 
+/// Same as writeMessage(), but does not flush the log file.<br>
+/// When the log file generations are rolled in the middle of a batch, the
+/// log messages written so far are flushed when the file is closed.
+///
+/// @param[in]  msg
+///    The log message object with the data of the log message to write
+///    into the file.
+/// @param[in]  msg_text
+///    The formatted text of the log message to write.
+/// @since  1.47.0, 18.10.2026
+void PolicyBase::appendMessage( const detail::LogMsg& msg,
+   const std::string& msg_text)
+{
+
+   if (!writeCheck( msg, msg_text))
+      reOpenFile();
+
+   mFile << msg_text << '\n';
+
+   written( msg, msg_text);
+
+} // PolicyBase::appendMessage
+
+
+
+/// Flushes the log file.
+///
+/// @since  1.47.0, 18.10.2026
+void PolicyBase::flush()
+{
+
+   mFile.flush();
+
+} // PolicyBase::flush
+
+
+
 /// Called when openCheck() returned \c false. The current file is already
 /// closed then, all the function has to do is roll the log file
 /// enerations.<br>
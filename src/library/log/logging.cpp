@@ -26,6 +26,7 @@
 
 // project includes
 #include "celma/common/celma_exception.hpp"
+#include "celma/log/detail/emergency_flush.hpp"
 #include "celma/log/detail/log.hpp"
 #include "celma/log/detail/log_msg.hpp"
 
@@ -193,6 +194,48 @@ void Logging::removeAttribute( const std::string& attr_name)
 
 
 
+/// Enables the emergency flush: Installs a signal handler for the given
+/// signals that writes the pending log messages of all log destinations that
+/// buffer log messages, followed by a marker line with the number of the
+/// signal.
+///
+/// @param[in]  signals  The signals to install the handler for.
+/// @since  1.47.0, 18.10.2026
+void Logging::enableEmergencyFlush( std::initializer_list< int> signals)
+{
+
+   detail::installEmergencyFlushHandler( signals);
+
+} // Logging::enableEmergencyFlush
+
+
+
+/// Sets up the alternate signal stack, on which the emergency flush handler
+/// runs, for the calling thread.
+///
+/// @return  \c true if the alternate signal stack could be set up.
+/// @since  1.47.0, 18.10.2026
+bool Logging::installEmergencyStack()
+{
+
+   return detail::installEmergencyAltStack();
+} // Logging::installEmergencyStack
+
+
+
+/// Disables the emergency flush again, i.e. restores the previous handling
+/// of the signals.
+///
+/// @since  1.47.0, 18.10.2026
+void Logging::disableEmergencyFlush()
+{
+
+   detail::removeEmergencyFlushHandler();
+
+} // Logging::disableEmergencyFlush
+
+
+
 /// Dumps information about the logging framework.
 ///
 /// @param[in]  os
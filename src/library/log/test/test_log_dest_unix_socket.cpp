@@ -0,0 +1,250 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the log destination
+**    celma::log::detail::LogDestUnixSocket, using the Boost.Test framework.
+**
+--*/
+
+
+// include of the tested module's header file
+#include "celma/log/detail/log_dest_unix_socket.hpp"
+
+
+// OS/C lib includes
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cstring>
+
+
+// C++ Standard Library includes
+#include <string>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE LogDestUnixSocketTest
+#include <boost/test/unit_test.hpp>
+
+
+// project includes
+#include "celma/log/detail/i_format_stream.hpp"
+#include "celma/log/detail/log_msg.hpp"
+
+
+using celma::log::detail::LogDestUnixSocket;
+using celma::log::detail::LogMsg;
+
+
+namespace {
+
+
+/// Formatter that only writes the text of the log message, plus a newline.
+/// @since  1.47.0, 18.10.2026
+class TextFormatter final : public celma::log::detail::IFormatStream
+{
+private:
+   void format( std::ostream& out, const LogMsg& msg) const override
+   {
+      out << msg.getText() << '\n';
+   } // TextFormatter::format
+
+}; // TextFormatter
+
+
+/// Helper class to create a socket pair and close the reading end again.
+/// @since  1.47.0, 18.10.2026
+class SocketPair
+{
+public:
+   explicit SocketPair( int sock_type)
+   {
+      BOOST_REQUIRE_EQUAL( ::socketpair( AF_UNIX, sock_type, 0, mFds), 0);
+   }
+
+   ~SocketPair()
+   {
+      ::close( mFds[ 1]);
+   }
+
+   /// Returns the writing end, ownership is passed to the log destination.
+   int writer() const
+   {
+      return mFds[ 0];
+   }
+
+   /// Reads the next datagram or the next chunk of data.
+   std::string read() const
+   {
+      char  buffer[ 1024];
+      auto  len = ::recv( mFds[ 1], buffer, sizeof( buffer), MSG_DONTWAIT);
+      return (len > 0) ? std::string( buffer, len) : std::string();
+   }
+
+private:
+   int  mFds[ 2];
+
+}; // SocketPair
+
+
+/// Passes a log message with the given text to the log destination.
+/// @since  1.47.0, 18.10.2026
+void sendText( celma::log::detail::ILogDest& dest, const std::string& text)
+{
+   LogMsg  msg( LOG_MSG_OBJECT_INIT);
+
+   msg.setText( text);
+   dest.handleMessage( msg);
+} // sendText
+
+
+} // namespace
+
+
+
+/// Connecting to a socket that does not exist must fail.
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( connect_error)
+{
+
+   BOOST_REQUIRE_THROW( LogDestUnixSocket( ""), std::runtime_error);
+   BOOST_REQUIRE_THROW( LogDestUnixSocket( "/tmp/celma_no_such_socket"),
+                        std::runtime_error);
+   BOOST_REQUIRE_THROW( LogDestUnixSocket( -1, 4), std::invalid_argument);
+
+} // connect_error
+
+
+
+/// Check that the log messages are sent as datagrams when the batch is
+/// complete or when flush() is called.
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( datagram_batches)
+{
+
+   SocketPair         sp( SOCK_DGRAM);
+   LogDestUnixSocket  dest( sp.writer(), 3);
+
+
+   dest.setFormatter( new TextFormatter());
+
+   sendText( dest, "first");
+   sendText( dest, "second");
+   BOOST_REQUIRE( sp.read().empty());
+   BOOST_REQUIRE_EQUAL( dest.numSent(), 0);
+
+   sendText( dest, "third");
+   BOOST_REQUIRE_EQUAL( dest.numSent(), 3);
+   BOOST_REQUIRE_EQUAL( sp.read(), "first\n");
+   BOOST_REQUIRE_EQUAL( sp.read(), "second\n");
+   BOOST_REQUIRE_EQUAL( sp.read(), "third\n");
+   BOOST_REQUIRE( sp.read().empty());
+
+   sendText( dest, "fourth");
+   dest.flush();
+   BOOST_REQUIRE_EQUAL( sp.read(), "fourth\n");
+   BOOST_REQUIRE_EQUAL( dest.numSent(), 4);
+   BOOST_REQUIRE_EQUAL( dest.numDropped(), 0);
+   BOOST_REQUIRE_EQUAL( dest.numErrors(), 0);
+
+} // datagram_batches
+
+
+
+/// Check that log messages are dropped and counted when the peer does not
+/// read them.
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( datagram_drop)
+{
+
+   SocketPair         sp( SOCK_DGRAM);
+   LogDestUnixSocket  dest( sp.writer(), 8);
+   const int          num_messages = 20'000;
+
+
+   for (int i = 0; i < num_messages; ++i)
+      sendText( dest, "message number " + std::to_string( i));
+   dest.flush();
+
+   BOOST_REQUIRE_EQUAL( dest.numSent() + dest.numDropped(), num_messages);
+   BOOST_REQUIRE_GT( dest.numSent(), 0);
+   BOOST_REQUIRE_GT( dest.numDropped(), 0);
+   BOOST_REQUIRE_EQUAL( dest.numErrors(), 0);
+
+} // datagram_drop
+
+
+
+/// Check sending the log messages through a stream socket.
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( stream_socket)
+{
+
+   SocketPair  sp( SOCK_STREAM);
+
+
+   {
+      LogDestUnixSocket  dest( sp.writer(), 2);
+
+      dest.setFormatter( new TextFormatter());
+
+      sendText( dest, "one");
+      sendText( dest, "two");
+      sendText( dest, "three");
+      BOOST_REQUIRE_EQUAL( dest.numSent(), 2);
+   } // end scope
+
+   // the destructor sends the remaining log message
+   BOOST_REQUIRE_EQUAL( sp.read(), "one\ntwo\nthree\n");
+
+} // stream_socket
+
+
+
+/// Check sending log messages to a socket with a path.
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( socket_path)
+{
+
+   const std::string   path( "/tmp/celma_test_log_" + std::to_string( ::getpid()));
+   struct sockaddr_un  addr;
+
+
+   ::memset( &addr, 0, sizeof( addr));
+   addr.sun_family = AF_UNIX;
+   ::strncpy( addr.sun_path, path.c_str(), sizeof( addr.sun_path) - 1);
+
+   const int  server = ::socket( AF_UNIX, SOCK_DGRAM, 0);
+   BOOST_REQUIRE_NE( server, -1);
+   ::unlink( path.c_str());
+   BOOST_REQUIRE_EQUAL( ::bind( server, reinterpret_cast< struct sockaddr*>( &addr),
+                                sizeof( addr)), 0);
+
+   {
+      LogDestUnixSocket  dest( path, LogDestUnixSocket::SocketType::datagram, 1);
+
+      dest.setFormatter( new TextFormatter());
+      sendText( dest, "via path");
+   } // end scope
+
+   char  buffer[ 128];
+   auto  len = ::recv( server, buffer, sizeof( buffer), MSG_DONTWAIT);
+   BOOST_REQUIRE_EQUAL( std::string( buffer, len > 0 ? len : 0), "via path\n");
+
+   ::close( server);
+   ::unlink( path.c_str());
+
+} // socket_path
+
+
+
+// =====  END OF test_log_dest_unix_socket.cpp  =====
+
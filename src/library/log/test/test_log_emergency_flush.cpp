@@ -0,0 +1,449 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the emergency flush of buffered log messages when the
+**    process is terminated by a signal, using the Boost.Test framework.
+**
+--*/
+
+
+// include of the tested module's header file
+#include "celma/log/detail/emergency_flush.hpp"
+
+
+// OS/C lib includes
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <csignal>
+#include <cstdlib>
+#include <ctime>
+
+
+// C++ Standard Library includes
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE LogEmergencyFlushTest
+#include <boost/test/unit_test.hpp>
+
+
+// project includes
+#include "celma/log/detail/i_format_stream.hpp"
+#include "celma/log/detail/log_dest_unix_socket.hpp"
+#include "celma/log/detail/log.hpp"
+#include "celma/log/filename/creator.hpp"
+#include "celma/log/files/handler.hpp"
+#include "celma/log/files/policy_base.hpp"
+#include "celma/log/files/simple.hpp"
+#include "celma/log/log_macros.hpp"
+#include "celma/log/logging.hpp"
+
+
+using celma::log::detail::LogMsg;
+using celma::log::Logging;
+
+
+namespace {
+
+
+/// Formatter that only writes the text of the log message.
+/// @since  1.47.0, 18.10.2026
+class TextFormatter final : public celma::log::detail::IFormatStream
+{
+public:
+   explicit TextFormatter( bool add_newline):
+      mAddNewline( add_newline)
+   {
+   }
+
+private:
+   void format( std::ostream& out, const LogMsg& msg) const override
+   {
+      out << msg.getText();
+      if (mAddNewline)
+         out << '\n';
+   } // TextFormatter::format
+
+   const bool  mAddNewline;
+
+}; // TextFormatter
+
+
+/// File policy that blocks in writeCheck() when the text of the log message is
+/// "blocked", so that the messages of other threads stay pending.
+/// @since  1.47.0, 18.10.2026
+class BlockingPolicy final : public celma::log::files::PolicyBase
+{
+public:
+   explicit BlockingPolicy( const celma::log::filename::Definition& fname_def):
+      PolicyBase( fname_def)
+   {
+   }
+
+   /// Set when a thread blocks in writeCheck().
+   static std::atomic< bool>  blocking;
+
+private:
+   bool openCheck() override
+   {
+      return true;
+   } // BlockingPolicy::openCheck
+
+   bool writeCheck( const LogMsg&, const std::string& msg_text) override
+   {
+      if (msg_text == "blocked")
+      {
+         blocking = true;
+         for (;;)
+            ::pause();
+      } // end if
+      return true;
+   } // BlockingPolicy::writeCheck
+
+   void written( const LogMsg&, const std::string&) override
+   {
+   } // BlockingPolicy::written
+
+}; // BlockingPolicy
+
+
+std::atomic< bool>  BlockingPolicy::blocking( false);
+
+
+/// Emergency flush object that writes a line before and after it sleeps, so
+/// that another thread can crash while the flush is running.
+/// @since  1.47.0, 18.10.2026
+class SlowFlush final : public celma::log::detail::IEmergencyFlush
+{
+public:
+   explicit SlowFlush( int fd):
+      mFd( fd)
+   {
+   }
+
+   /// Set when the emergency flush started.
+   std::atomic< bool>  mStarted { false };
+
+private:
+   void emergencyFlush( int sig_nbr) noexcept override
+   {
+      const struct timespec  delay = { 0, 200'000'000 };
+
+      celma::log::detail::writeAll( mFd, "start\n", 6);
+      mStarted = true;
+      ::nanosleep( &delay, nullptr);
+      celma::log::detail::writeAll( mFd, "end\n", 4);
+      celma::log::detail::writeSignalMarker( mFd, sig_nbr);
+   } // SlowFlush::emergencyFlush
+
+   const int  mFd;
+
+}; // SlowFlush
+
+
+/// Runs the given function in a child process, which is expected to be
+/// terminated by the given signal.
+/// @since  1.47.0, 18.10.2026
+template< typename F> void runCrashingChild( int exp_signal, F&& fun)
+{
+
+   const pid_t  child_pid = ::fork();
+   BOOST_REQUIRE_NE( child_pid, -1);
+
+   if (child_pid == 0)
+   {
+      // no core files from the deliberate crashes
+      struct rlimit  no_core = { 0, 0 };
+      ::setrlimit( RLIMIT_CORE, &no_core);
+
+      fun();
+      // should not be reached
+      ::_exit( EXIT_SUCCESS);
+   } // end if
+
+   int  status = 0;
+   BOOST_REQUIRE_EQUAL( ::waitpid( child_pid, &status, 0), child_pid);
+   BOOST_REQUIRE( WIFSIGNALED( status));
+   BOOST_REQUIRE_EQUAL( WTERMSIG( status), exp_signal);
+
+} // runCrashingChild
+
+
+/// Returns the expected marker line for the given signal.
+/// @since  1.47.0, 18.10.2026
+std::string markerLine( int sig_nbr)
+{
+   return "*** emergency flush: terminated by signal " + std::to_string( sig_nbr)
+      + " ***";
+} // markerLine
+
+
+} // namespace
+
+
+
+/// The log messages of the current batch of a socket log destination must be
+/// sent when the process aborts.
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( socket_batch_on_abort)
+{
+
+   int  fds[ 2];
+
+
+   BOOST_REQUIRE_EQUAL( ::socketpair( AF_UNIX, SOCK_DGRAM, 0, fds), 0);
+
+   runCrashingChild( SIGABRT, [&]()
+   {
+      ::close( fds[ 1]);
+
+      // the object is intentionally never destroyed
+      auto  dest = new celma::log::detail::LogDestUnixSocket( fds[ 0], 10);
+      dest->setFormatter( new TextFormatter( true));
+
+      for (int i = 0; i < 3; ++i)
+      {
+         LogMsg  msg( LOG_MSG_OBJECT_INIT);
+         msg.setText( "pending " + std::to_string( i));
+         dest->handleMessage( msg);
+      } // end for
+
+      Logging::instance().enableEmergencyFlush();
+      std::abort();
+   });
+
+   ::close( fds[ 0]);
+
+   std::vector< std::string>  received;
+   char                       buffer[ 256];
+   ssize_t                    len;
+
+   while ((len = ::recv( fds[ 1], buffer, sizeof( buffer), MSG_DONTWAIT)) > 0)
+      received.emplace_back( buffer, len);
+   ::close( fds[ 1]);
+
+   BOOST_REQUIRE_EQUAL( received.size(), 4);
+   BOOST_REQUIRE_EQUAL( received[ 0], "pending 0\n");
+   BOOST_REQUIRE_EQUAL( received[ 2], "pending 2\n");
+   BOOST_REQUIRE_EQUAL( received[ 3], markerLine( SIGABRT) + "\n");
+
+} // socket_batch_on_abort
+
+
+
+/// A segmentation fault must append the marker line to the log file.
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( logfile_on_segv)
+{
+
+   namespace clfn = celma::log::filename;
+   namespace clf = celma::log::files;
+
+   const std::string  file_name( "/tmp/celma_emergency_flush_"
+                                 + std::to_string( ::getpid()) + ".txt");
+
+
+   ::unlink( file_name.c_str());
+
+   runCrashingChild( SIGSEGV, [&]()
+   {
+      clfn::Definition  my_def;
+      clfn::Creator     format_creator( my_def);
+
+      format_creator << file_name;
+
+      auto  handler = new clf::Handler< clf::Simple, clf::FlatCombiningLock>(
+         new clf::Simple( my_def));
+      handler->setFormatter( new TextFormatter( false));
+
+      auto  my_log = Logging::instance().findCreateLog( "crash");
+      Logging::instance().getLog( my_log)->addDestination( "file", handler);
+      Logging::instance().enableEmergencyFlush();
+
+      LOG( my_log) << "last message before the crash";
+
+      volatile int* volatile  null_ptr = nullptr;
+      *null_ptr = 42;
+   });
+
+   std::ifstream               log_file( file_name);
+   std::string                 line;
+   std::vector< std::string>   lines;
+
+   while (std::getline( log_file, line))
+      lines.push_back( line);
+   ::unlink( file_name.c_str());
+
+   BOOST_REQUIRE_EQUAL( lines.size(), 2);
+   BOOST_REQUIRE_EQUAL( lines[ 0], "last message before the crash");
+   BOOST_REQUIRE_EQUAL( lines[ 1], markerLine( SIGSEGV));
+
+} // logfile_on_segv
+
+
+
+/// Log messages that are still pending in the flat combining lock when the
+/// process crashes must be written into the log file.
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( logfile_pending_messages)
+{
+
+   namespace clfn = celma::log::filename;
+   namespace clf = celma::log::files;
+
+   const std::string  file_name( "/tmp/celma_emergency_pending_"
+                                 + std::to_string( ::getpid()) + ".txt");
+
+
+   ::unlink( file_name.c_str());
+
+   runCrashingChild( SIGSEGV, [&]()
+   {
+      clfn::Definition  my_def;
+      clfn::Creator     format_creator( my_def);
+
+      format_creator << file_name;
+
+      auto  handler = new clf::Handler< BlockingPolicy, clf::FlatCombiningLock>(
+         new BlockingPolicy( my_def));
+      handler->setFormatter( new TextFormatter( false));
+
+      auto  my_log = Logging::instance().findCreateLog( "pending");
+      Logging::instance().getLog( my_log)->addDestination( "file", handler);
+      Logging::instance().enableEmergencyFlush();
+
+      // this thread gets the write role and blocks, so the messages of the
+      // main thread stay pending
+      std::thread  writer( [my_log]()
+      {
+         LOG( my_log) << "blocked";
+      });
+
+      while (!BlockingPolicy::blocking)
+         std::this_thread::yield();
+
+      LOG( my_log) << "pending 1";
+      LOG( my_log) << "pending 2";
+
+      volatile int* volatile  null_ptr = nullptr;
+      *null_ptr = 42;
+   });
+
+   std::ifstream               log_file( file_name);
+   std::string                 line;
+   std::vector< std::string>   lines;
+
+   while (std::getline( log_file, line))
+      lines.push_back( line);
+   ::unlink( file_name.c_str());
+
+   BOOST_REQUIRE_EQUAL( lines.size(), 4);
+   BOOST_REQUIRE_EQUAL( lines[ 0], "blocked");
+   BOOST_REQUIRE_EQUAL( lines[ 1], "pending 1");
+   BOOST_REQUIRE_EQUAL( lines[ 2], "pending 2");
+   BOOST_REQUIRE_EQUAL( lines[ 3], markerLine( SIGSEGV));
+
+} // logfile_pending_messages
+
+
+
+/// When a second thread crashes while the first thread still writes the
+/// pending log messages, the flush must complete, and the process must be
+/// terminated with the signal of the first thread.
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( concurrent_crashes)
+{
+
+   int  fds[ 2];
+
+
+   BOOST_REQUIRE_EQUAL( ::pipe( fds), 0);
+
+   runCrashingChild( SIGABRT, [&]()
+   {
+      ::close( fds[ 0]);
+
+      // the object is intentionally never destroyed
+      auto  slow_flush = new SlowFlush( fds[ 1]);
+      celma::log::detail::registerEmergencyFlush( slow_flush);
+      Logging::instance().enableEmergencyFlush();
+
+      std::thread  second( [slow_flush]()
+      {
+         while (!slow_flush->mStarted)
+            std::this_thread::yield();
+         ::raise( SIGSEGV);
+      });
+
+      std::abort();
+   });
+
+   ::close( fds[ 1]);
+
+   std::string  output;
+   char         buffer[ 256];
+   ssize_t      len;
+
+   while ((len = ::read( fds[ 0], buffer, sizeof( buffer))) > 0)
+      output.append( buffer, len);
+   ::close( fds[ 0]);
+
+   BOOST_REQUIRE_EQUAL( output, "start\nend\n" + markerLine( SIGABRT) + "\n");
+
+} // concurrent_crashes
+
+
+
+/// Registering and unregistering emergency flush objects, and writing the
+/// marker line.
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( register_and_marker)
+{
+
+   class Dummy final : public celma::log::detail::IEmergencyFlush
+   {
+   public:
+      void emergencyFlush( int) noexcept override
+      {
+      }
+   };
+
+   Dummy  dummy;
+   int    fds[ 2];
+
+
+   BOOST_REQUIRE( celma::log::detail::registerEmergencyFlush( &dummy));
+   celma::log::detail::unregisterEmergencyFlush( &dummy);
+
+   BOOST_REQUIRE_EQUAL( ::pipe( fds), 0);
+   celma::log::detail::writeSignalMarker( fds[ 1], 15);
+   ::close( fds[ 1]);
+
+   char  buffer[ 128];
+   auto  len = ::read( fds[ 0], buffer, sizeof( buffer));
+   ::close( fds[ 0]);
+
+   BOOST_REQUIRE_EQUAL( std::string( buffer, len > 0 ? len : 0),
+                        markerLine( 15) + "\n");
+
+} // register_and_marker
+
+
+
+// =====  END OF test_log_emergency_flush.cpp  =====
+
@@ -0,0 +1,393 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the lock policy celma::log::files::FlatCombiningLock,
+**    using the Boost.Test framework.
+**
+--*/
+
+
+// include of the tested module's header file
+#include "celma/log/files/flat_combining_lock.hpp"
+
+
+// OS/C lib includes
+#include <unistd.h>
+
+
+// C++ Standard Library includes
+#include <fstream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE LogFlatCombiningLockTest
+#include <boost/test/unit_test.hpp>
+
+
+// project includes
+#include "celma/log/detail/i_format_stream.hpp"
+#include "celma/log/filename/creator.hpp"
+#include "celma/log/files/handler.hpp"
+#include "celma/log/files/policy_base.hpp"
+#include "celma/log/files/simple.hpp"
+
+
+using celma::log::detail::LogMsg;
+using celma::log::files::FlatCombiningLock;
+
+
+namespace {
+
+
+/// Formatter that only writes the text of the log message.
+/// @since  1.47.0, 18.10.2026
+class TextFormatter final : public celma::log::detail::IFormatStream
+{
+private:
+   void format( std::ostream& out, const LogMsg& msg) const override
+   {
+      out << msg.getText();
+   } // TextFormatter::format
+
+}; // TextFormatter
+
+
+/// Stream buffer that passes all data to another stream buffer and counts how
+/// often it is flushed.
+/// @since  1.47.0, 18.10.2026
+class SyncCounter final : public std::streambuf
+{
+public:
+   /// Sets the stream buffer to pass the data to.
+   void attach( std::streambuf* dest)
+   {
+      mpDest = dest;
+   } // SyncCounter::attach
+
+   /// Returns how often sync() was called.
+   int numSyncs() const
+   {
+      return mNumSyncs;
+   } // SyncCounter::numSyncs
+
+protected:
+   int_type overflow( int_type ch) override
+   {
+      if (traits_type::eq_int_type( ch, traits_type::eof()))
+         return traits_type::not_eof( ch);
+      return mpDest->sputc( traits_type::to_char_type( ch));
+   } // SyncCounter::overflow
+
+   std::streamsize xsputn( const char* s, std::streamsize n) override
+   {
+      return mpDest->sputn( s, n);
+   } // SyncCounter::xsputn
+
+   int sync() override
+   {
+      ++mNumSyncs;
+      return mpDest->pubsync();
+   } // SyncCounter::sync
+
+private:
+   std::streambuf*  mpDest = nullptr;
+   int              mNumSyncs = 0;
+
+}; // SyncCounter
+
+
+/// File policy that counts how often the log file is flushed.<br>
+/// When the message "first" is written, two more messages are logged through
+/// the handler, which are then written as the next batch.
+/// @since  1.47.0, 18.10.2026
+class FlushCountingPolicy final : public celma::log::files::PolicyBase
+{
+public:
+   explicit FlushCountingPolicy( const celma::log::filename::Definition& fname_def):
+      PolicyBase( fname_def)
+   {
+   }
+
+   /// Returns how often the log file was flushed.
+   int numFlushes() const
+   {
+      return mSyncCounter.numSyncs();
+   } // FlushCountingPolicy::numFlushes
+
+   /// The handler to pass the additional log messages to.
+   celma::log::detail::ILogDest*  mpHandler = nullptr;
+
+private:
+   bool openCheck() override
+   {
+      mSyncCounter.attach( mFile.rdbuf());
+      static_cast< std::ostream&>( mFile).rdbuf( &mSyncCounter);
+      return true;
+   } // FlushCountingPolicy::openCheck
+
+   bool writeCheck( const LogMsg&, const std::string&) override
+   {
+      return true;
+   } // FlushCountingPolicy::writeCheck
+
+   void written( const LogMsg&, const std::string& msg_text) override
+   {
+      if (msg_text == "first")
+      {
+         for (auto const& text : { "second", "third" })
+         {
+            LogMsg  msg( LOG_MSG_OBJECT_INIT);
+            msg.setText( text);
+            mpHandler->handleMessage( msg);
+         } // end for
+      } // end if
+   } // FlushCountingPolicy::written
+
+   SyncCounter  mSyncCounter;
+
+}; // FlushCountingPolicy
+
+
+} // namespace
+
+
+
+/// Single thread: Each message is written immediately.
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( single_thread)
+{
+
+   FlatCombiningLock           fcl;
+   std::vector< std::string>   written;
+   LogMsg                      msg( LOG_MSG_OBJECT_INIT);
+   auto                        writer = [&]( const LogMsg&, const std::string& text)
+   {
+      written.push_back( text);
+   };
+
+
+   fcl.write( msg, "one", writer);
+   BOOST_REQUIRE_EQUAL( written.size(), 1);
+   fcl.write( msg, "two", writer);
+   BOOST_REQUIRE_EQUAL( written.size(), 2);
+   BOOST_REQUIRE_EQUAL( written[ 1], "two");
+   BOOST_REQUIRE_EQUAL( fcl.numBatches(), 2);
+   BOOST_REQUIRE_EQUAL( fcl.numCombined(), 0);
+
+} // single_thread
+
+
+
+/// When the writer throws, the write role must be released again.
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( writer_exception)
+{
+
+   FlatCombiningLock  fcl;
+   LogMsg             msg( LOG_MSG_OBJECT_INIT);
+   int                num_written = 0;
+
+
+   BOOST_REQUIRE_THROW( fcl.write( msg, "bad",
+      []( const LogMsg&, const std::string&)
+      {
+         throw std::runtime_error( "write failed");
+      }), std::runtime_error);
+
+   fcl.write( msg, "good", [&]( const LogMsg&, const std::string&)
+      {
+         ++num_written;
+      });
+   BOOST_REQUIRE_EQUAL( num_written, 1);
+   BOOST_REQUIRE_EQUAL( fcl.numDropped(), 1);
+
+} // writer_exception
+
+
+
+/// When the writer throws, the other messages of the batch must not be lost:
+/// The failed message is dropped, the others are written with the next
+/// message.
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( writer_exception_keeps_batch)
+{
+
+   FlatCombiningLock           fcl;
+   LogMsg                      msg( LOG_MSG_OBJECT_INIT);
+   std::vector< std::string>   written;
+   auto                        writer = [&]( const LogMsg&, const std::string& text)
+   {
+      written.push_back( text);
+   };
+
+
+   // while the first message is written, two more messages are added, as if
+   // by other threads, and writing the first of these fails
+   BOOST_REQUIRE_THROW( fcl.write( msg, "first",
+      [&]( const LogMsg&, const std::string& text)
+      {
+         if (text == "first")
+         {
+            written.push_back( text);
+            fcl.write( msg, "bad", writer);
+            fcl.write( msg, "kept", writer);
+         } else if (text == "bad")
+         {
+            throw std::runtime_error( "write failed");
+         } else
+         {
+            written.push_back( text);
+         } // end if
+      }), std::runtime_error);
+
+   BOOST_REQUIRE_EQUAL( fcl.numDropped(), 1);
+   BOOST_REQUIRE_EQUAL( written.size(), 1);
+
+   fcl.write( msg, "next", writer);
+   BOOST_REQUIRE_EQUAL( written.size(), 3);
+   BOOST_REQUIRE_EQUAL( written[ 1], "kept");
+   BOOST_REQUIRE_EQUAL( written[ 2], "next");
+
+} // writer_exception_keeps_batch
+
+
+
+/// The handler must flush the log file once per batch, not once per message.
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( flush_per_batch)
+{
+
+   namespace clfn = celma::log::filename;
+   namespace clf = celma::log::files;
+
+   const std::string  file_name( "/tmp/celma_flat_combining_flush_"
+                                 + std::to_string( ::getpid()) + ".txt");
+
+   {
+      clfn::Definition  my_def;
+      clfn::Creator     format_creator( my_def);
+
+      format_creator << file_name;
+
+      auto  policy = new FlushCountingPolicy( my_def);
+      clf::Handler< FlushCountingPolicy, FlatCombiningLock>  handler( policy);
+      LogMsg                                                  msg( LOG_MSG_OBJECT_INIT);
+
+      handler.setFormatter( new TextFormatter());
+      policy->mpHandler = &handler;
+
+      msg.setText( "first");
+      handler.handleMessage( msg);
+
+      BOOST_REQUIRE_EQUAL( handler.lockObject().numBatches(), 2);
+      BOOST_REQUIRE_EQUAL( handler.lockObject().numCombined(), 1);
+      BOOST_REQUIRE_EQUAL( policy->numFlushes(), 2);
+   } // end scope
+
+   std::ifstream               log_file( file_name);
+   std::string                 line;
+   std::vector< std::string>   lines;
+
+   while (std::getline( log_file, line))
+      lines.push_back( line);
+   ::unlink( file_name.c_str());
+
+   BOOST_REQUIRE_EQUAL( lines.size(), 3);
+   BOOST_REQUIRE_EQUAL( lines[ 0], "first");
+   BOOST_REQUIRE_EQUAL( lines[ 1], "second");
+   BOOST_REQUIRE_EQUAL( lines[ 2], "third");
+
+} // flush_per_batch
+
+
+
+/// Multiple threads writing into the same log file: All messages must be
+/// written, the messages of each thread in the order in which they were
+/// created.
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( multiple_threads)
+{
+
+   namespace clfn = celma::log::filename;
+   namespace clf = celma::log::files;
+
+   const std::string  file_name( "/tmp/celma_flat_combining_"
+                                 + std::to_string( ::getpid()) + ".txt");
+   const int          num_threads = 8;
+   const int          num_messages = 2'000;
+
+   {
+      clfn::Definition  my_def;
+      clfn::Creator     format_creator( my_def);
+
+      format_creator << file_name;
+
+      clf::Handler< clf::Simple, FlatCombiningLock>
+         handler( new clf::Simple( my_def));
+      std::vector< std::thread>  threads;
+
+      handler.setFormatter( new TextFormatter());
+
+      for (int t = 0; t < num_threads; ++t)
+      {
+         threads.emplace_back( [&handler, t]()
+         {
+            for (int i = 0; i < num_messages; ++i)
+            {
+               LogMsg  msg( LOG_MSG_OBJECT_INIT);
+               msg.setText( std::to_string( t) + " " + std::to_string( i));
+               handler.handleMessage( msg);
+            } // end for
+         });
+      } // end for
+
+      for (auto& thr : threads)
+         thr.join();
+
+      BOOST_REQUIRE_GE( handler.lockObject().numBatches(), 1);
+      BOOST_REQUIRE_EQUAL( handler.lockObject().numBatches()
+                           + handler.lockObject().numCombined(),
+                           num_threads * num_messages);
+   } // end scope
+
+   std::ifstream       log_file( file_name);
+   std::string         line;
+   std::vector< int >  next_seq( num_threads, 0);
+   int                 num_lines = 0;
+
+   while (std::getline( log_file, line))
+   {
+      std::istringstream  iss( line);
+      int                 t = -1;
+      int                 seq = -1;
+
+      iss >> t >> seq;
+      BOOST_REQUIRE( (t >= 0) && (t < num_threads));
+      BOOST_REQUIRE_EQUAL( seq, next_seq[ t]);
+      ++next_seq[ t];
+      ++num_lines;
+   } // end while
+
+   BOOST_REQUIRE_EQUAL( num_lines, num_threads * num_messages);
+
+   ::unlink( file_name.c_str());
+
+} // multiple_threads
+
+
+
+// =====  END OF test_log_flat_combining_lock.cpp  =====
+
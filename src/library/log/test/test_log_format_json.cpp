@@ -0,0 +1,154 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the module celma::log::detail::FormatStreamJson, using
+**    the Boost.Test framework.
+**
+--*/
+
+
+// include of the tested module's header file
+#include "celma/log/detail/format_stream_json.hpp"
+
+
+// C++ Standard Library includes
+#include <sstream>
+#include <string>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE LogFormatJsonTest
+#include <boost/test/unit_test.hpp>
+
+
+// project includes
+#include "celma/log/log_attributes.hpp"
+#include "celma/log/logging.hpp"
+
+
+using celma::log::detail::FormatStreamJson;
+using celma::log::detail::LogMsg;
+using celma::log::LogAttributes;
+using celma::log::Logging;
+
+
+
+/// Test escaping strings with and without special characters, including
+/// strings that are longer than one SIMD block.
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( test_escape)
+{
+
+   auto  escaped = []( const std::string& str)
+   {
+      std::string  result;
+      FormatStreamJson::appendEscaped( result, str);
+      return result;
+   };
+
+
+   BOOST_REQUIRE( escaped( "").empty());
+   BOOST_REQUIRE_EQUAL( escaped( "hello"), "hello");
+   BOOST_REQUIRE_EQUAL( escaped( "say \"hello\""), "say \\\"hello\\\"");
+   BOOST_REQUIRE_EQUAL( escaped( "C:\\temp"), "C:\\\\temp");
+   BOOST_REQUIRE_EQUAL( escaped( "a\tb\nc\r"), "a\\tb\\nc\\r");
+   BOOST_REQUIRE_EQUAL( escaped( std::string( "\x01\x1f", 2)), "\\u0001\\u001f");
+   BOOST_REQUIRE_EQUAL( escaped( "gr\xc3\xbc\xc3\x9f"), "gr\xc3\xbc\xc3\x9f");
+
+   const std::string  clean_block( 40, 'x');
+   BOOST_REQUIRE_EQUAL( escaped( clean_block), clean_block);
+   BOOST_REQUIRE_EQUAL( escaped( clean_block + "\"" + clean_block + "\n"),
+                        clean_block + "\\\"" + clean_block + "\\n");
+
+   std::string  all_quotes_escaped;
+   for (int i = 0; i < 17; ++i)
+      all_quotes_escaped.append( "\\\"");
+   BOOST_REQUIRE_EQUAL( escaped( std::string( 17, '"')), all_quotes_escaped);
+
+} // test_escape
+
+
+
+/// Test the formatting of a log message without attributes.
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( test_message)
+{
+
+   LogMsg              msg( "file \"1\".cpp", "test_message", 42);
+   std::ostringstream  oss;
+   FormatStreamJson    fmt( false);
+
+
+   msg.setTimestamp( 1'600'000'000);
+   msg.setClass( celma::log::LogClass::data);
+   msg.setLevel( celma::log::LogLevel::warning);
+   msg.setErrorNumber( -13);
+   msg.setText( "value \"x\" is\tinvalid");
+
+   fmt.formatMsg( oss, msg);
+
+   const std::string  expected( "{\"timestamp_us\":1600000000000000,\"pid\":"
+      + std::to_string( ::getpid()) + ",\"thread\":"
+      + std::to_string( static_cast< uint64_t>( msg.getThreadId()))
+      + ",\"file\":\"file \\\"1\\\".cpp\",\"function\":\"test_message\","
+        "\"line\":42,\"class\":\"Data\",\"level\":\"Warning\","
+        "\"error\":-13,\"text\":\"value \\\"x\\\" is\\tinvalid\"}\n");
+
+   BOOST_REQUIRE_EQUAL( oss.str(), expected);
+
+} // test_message
+
+
+
+/// Test the formatting of the attributes of a log message.
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( test_attributes)
+{
+
+   LogMsg            msg( "file.cpp", "test_attributes", 7);
+   FormatStreamJson  fmt;
+
+
+   msg.setText( "text");
+
+   {
+      std::ostringstream  oss;
+      fmt.formatMsg( oss, msg);
+      BOOST_REQUIRE( oss.str().find( ",\"text\":\"text\",\"attributes\":{}}\n")
+                     != std::string::npos);
+   } // end scope
+
+   LogAttributes  outer( "region", "north");
+   LogAttributes  inner( &outer);
+
+   inner.addAttribute( "job", "import");
+   inner.addAttribute( "region", "s\"outh");
+   msg.setAttributes( inner);
+   Logging::instance().addAttribute( "host", "box");
+   Logging::instance().addAttribute( "job", "ignored");
+
+   {
+      std::ostringstream  oss;
+      fmt.formatMsg( oss, msg);
+      BOOST_REQUIRE_EQUAL( oss.str().substr( oss.str().find( ",\"attributes\"")),
+         ",\"attributes\":{\"region\":\"s\\\"outh\",\"job\":\"import\","
+         "\"host\":\"box\"}}\n");
+   } // end scope
+
+   Logging::instance().removeAttribute( "job");
+   Logging::instance().removeAttribute( "host");
+
+} // test_attributes
+
+
+
+// =====  END OF test_log_format_json.cpp  =====
+
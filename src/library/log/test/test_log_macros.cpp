@@ -32,6 +32,7 @@
 // project includes
 #include "celma/log/detail/log_dest_stream.hpp"
 #include "celma/log/log_macros.hpp"
+#include "celma/test/allocation_counter.hpp"
 
 
 using celma::log::Logging;
@@ -309,4 +310,50 @@ BOOST_FIXTURE_TEST_CASE( log_every, TestCaseLogDestStream)
 
 
 
+/// Log messages that are discarded must not allocate memory.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_FIXTURE_TEST_CASE( discarded_no_allocations, TestCaseLogDestStream)
+{
+
+   const std::string  silent_name( "silent");
+   const auto         silent = Logging::instance().findCreateLog( silent_name);
+
+
+   GET_LOG( silent)->maxLevel( celma::log::LogLevel::error);
+
+   // steady state: the log level does not pass the filter
+   CHECK_NO_ALLOCATIONS(
+      for (int i = 0; i < 100; ++i)
+      {
+         LOG_LEVEL( silent, debug) << "discarded message " << i;
+         LOG_LEVEL( silent_name, info) << "discarded message " << i;
+         LOG_LEVEL_MAX( silent, debug, 5) << "discarded message " << i;
+         LOG_LEVEL_AFTER( silent, debug, 5) << "discarded message " << i;
+      } // end for
+   );
+
+   auto  log_sometimes = [ this]()
+   {
+      LOG_LEVEL_ONCE( mMyLog, info) << "message created only once";
+      LOG_LEVEL_EVERY( mMyLog, info, 100) << "message created every 100th time";
+   };
+
+   // the first call creates the message
+   log_sometimes();
+
+   // steady state: the message was already created once, and the counter
+   // does not reach 100
+   CHECK_NO_ALLOCATIONS(
+      for (int i = 0; i < 10; ++i)
+         log_sometimes()
+   );
+
+   BOOST_REQUIRE( !mDest.str().empty());
+   mDest.str( "");
+
+} // discarded_no_allocations
+
+
+
 // =====  END OF test_log_macros.cpp  =====
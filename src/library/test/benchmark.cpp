@@ -0,0 +1,795 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// See documentation of classes celma::test::BenchmarkRegistry and
+/// celma::test::BenchmarkRunner.
+
+
+// module headerfile include
+#include "celma/test/benchmark.hpp"
+
+
+// OS/C lib includes
+#include <sched.h>
+
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <ostream>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+
+// project includes
+#include "celma/common/csv_reader.hpp"
+#include "celma/common/nano_timer.hpp"
+#include "celma/common/perf_counters.hpp"
+#include "celma/format/ascii_table.hpp"
+#include "celma/prog_args.hpp"
+
+
+namespace celma { namespace test {
+
+
+namespace {
+
+
+/// Runs a benchmark the given number of times and returns the time needed.
+///
+/// @param[in]  bench       The benchmark to run.
+/// @param[in]  iterations  The number of iterations.
+/// @return  The time needed for all iterations.
+/// @since  1.47.0, 18.10.2026
+std::chrono::nanoseconds timedRun( const Benchmark& bench, uint64_t iterations)
+{
+
+   common::NanoTimer<>  nt;
+
+
+   nt.start();
+   bench.mFunction( iterations);
+   nt.stop();
+
+   return nt.timed();
+} // timedRun
+
+
+/// Writes a string as JSON string, with quotes and escaped characters.
+///
+/// @param[in]  os   The stream to write into.
+/// @param[in]  str  The string to write.
+/// @since  1.47.0, 18.10.2026
+void writeJsonString( std::ostream& os, const std::string& str)
+{
+
+   os << '"';
+
+   for (auto ch : str)
+   {
+      if ((ch == '"') || (ch == '\\'))
+      {
+         os << '\\' << ch;
+      } else if (static_cast< unsigned char>( ch) < 0x20)
+      {
+         char  buffer[ 8];
+         std::snprintf( buffer, sizeof( buffer), "\\u%04x", ch);
+         os << buffer;
+      } else
+      {
+         os << ch;
+      } // end if
+   } // end for
+
+   os << '"';
+
+} // writeJsonString
+
+
+/// Formats a performance counter value for the table, "n/a" when the value
+/// is not available.
+///
+/// @param[in]  value  The value to format, negative if not available.
+/// @return  The formatted value.
+/// @since  1.47.0, 18.10.2026
+std::string perfValue( double value)
+{
+
+   char  buffer[ 32];
+
+
+   if (value < 0.0)
+      return "n/a";
+
+   std::snprintf( buffer, sizeof( buffer), "%.2f", value);
+
+   return buffer;
+} // perfValue
+
+
+/// Binds the calling thread to a CPU.
+///
+/// @param[in]  cpu  The number of the CPU to run on.
+/// @throw  std::system_error if the thread could not be bound to the CPU.
+/// @since  1.47.0, 18.10.2026
+void pinToCpu( int cpu)
+{
+
+   cpu_set_t  cpu_set;
+
+
+   CPU_ZERO( &cpu_set);
+   CPU_SET( cpu, &cpu_set);
+
+   if (::sched_setaffinity( 0, sizeof( cpu_set), &cpu_set) != 0)
+      throw std::system_error( errno, std::system_category(),
+                               "could not bind to CPU " + std::to_string( cpu));
+
+} // pinToCpu
+
+
+} // namespace
+
+
+
+/// Returns the registry.
+///
+/// @return  The one and only registry object.
+/// @since  1.47.0, 18.10.2026
+BenchmarkRegistry& BenchmarkRegistry::instance()
+{
+
+   static BenchmarkRegistry  registry;
+
+
+   return registry;
+} // BenchmarkRegistry::instance
+
+
+
+/// Adds a benchmark.
+///
+/// @param[in]  name  The name of the benchmark.
+/// @param[in]  fun   The function that runs the benchmark code the given
+///                   number of times.
+/// @throw  std::invalid_argument if the name is empty or already used.
+/// @since  1.47.0, 18.10.2026
+void BenchmarkRegistry::add( const std::string& name,
+                             Benchmark::function_t fun)
+{
+
+   if (name.empty())
+      throw std::invalid_argument( "benchmark name must not be empty");
+
+   if (std::any_of( mBenchmarks.begin(), mBenchmarks.end(),
+                    [ &]( const Benchmark& bench)
+                    {
+                       return bench.mName == name;
+                    }))
+      throw std::invalid_argument( "benchmark '" + name
+                                   + "' is already registered");
+
+   mBenchmarks.push_back( Benchmark{ name, std::move( fun) });
+
+} // BenchmarkRegistry::add
+
+
+
+/// Returns the registered benchmarks, sorted by name.
+///
+/// @return  The benchmarks.
+/// @since  1.47.0, 18.10.2026
+std::vector< Benchmark> BenchmarkRegistry::benchmarks() const
+{
+
+   auto  result = mBenchmarks;
+
+
+   std::sort( result.begin(), result.end(),
+              []( const Benchmark& lhs, const Benchmark& rhs)
+              {
+                 return lhs.mName < rhs.mName;
+              });
+
+   return result;
+} // BenchmarkRegistry::benchmarks
+
+
+
+/// Computes the statistics of the samples.<br>
+/// The confidence interval of the median is determined from the order
+/// statistics: With n samples, the ranks n/2 -/+ 1.96 * sqrt( n)/2 of the
+/// sorted samples are the bounds of the 95 % confidence interval.
+///
+/// @param[in]  samples  The samples, in nanoseconds per iteration.
+/// @return  The statistics, all 0 if \a samples is empty.
+/// @since  1.47.0, 18.10.2026
+BenchmarkStatistics computeStatistics( std::vector< double> samples)
+{
+
+   BenchmarkStatistics  result;
+
+
+   if (samples.empty())
+      return result;
+
+   std::sort( samples.begin(), samples.end());
+
+   const auto  num = samples.size();
+
+   result.mNumSamples = num;
+   result.mMin = samples.front();
+   result.mMax = samples.back();
+   result.mMedian = ((num % 2) == 1) ? samples[ num / 2]
+      : (samples[ num / 2 - 1] + samples[ num / 2]) / 2.0;
+
+   double  sum = 0.0;
+   for (auto value : samples)
+      sum += value;
+   result.mMean = sum / static_cast< double>( num);
+
+   if (num > 1)
+   {
+      double  sum_sq = 0.0;
+      for (auto value : samples)
+         sum_sq += (value - result.mMean) * (value - result.mMean);
+      result.mStdDev = std::sqrt( sum_sq / static_cast< double>( num - 1));
+   } // end if
+
+   if (num < 6)
+   {
+      result.mCiLow = result.mMin;
+      result.mCiHigh = result.mMax;
+   } else
+   {
+      const double  half_width = 1.96 * std::sqrt( static_cast< double>( num))
+                                 / 2.0;
+      const auto    low_rank = static_cast< size_t>( std::max( 0.0,
+         std::floor( static_cast< double>( num) / 2.0 - half_width)));
+      const auto    high_rank = std::min( num - 1, static_cast< size_t>(
+         std::ceil( static_cast< double>( num) / 2.0 + half_width)));
+
+      result.mCiLow = samples[ low_rank];
+      result.mCiHigh = samples[ high_rank];
+   } // end if
+
+   return result;
+} // computeStatistics
+
+
+
+/// Constructor.
+///
+/// @param[in]  options  The options to use.
+/// @throw  std::invalid_argument if the number of samples or the sample time
+///         is 0.
+/// @since  1.47.0, 18.10.2026
+BenchmarkRunner::BenchmarkRunner( const BenchmarkOptions& options):
+   mOptions( options)
+{
+
+   if (mOptions.mNumSamples == 0)
+      throw std::invalid_argument( "number of samples must not be 0");
+   if (mOptions.mSampleTime.count() <= 0)
+      throw std::invalid_argument( "sample time must be positive");
+
+} // BenchmarkRunner::BenchmarkRunner
+
+
+
+/// Determines the number of iterations that take about the sample time:
+/// Increases the number of iterations by a factor of 10 until a run takes at
+/// least a tenth of the sample time, then scales the number of iterations to
+/// the sample time.
+///
+/// @param[in]  bench  The benchmark to determine the iterations of.
+/// @return  The number of iterations per sample, at least 1.
+/// @since  1.47.0, 18.10.2026
+uint64_t BenchmarkRunner::calibrate( const Benchmark& bench) const
+{
+
+   const auto  min_time = mOptions.mSampleTime / 10;
+   uint64_t    iterations = 1;
+
+
+   for (;;)
+   {
+      const auto  needed = timedRun( bench, iterations);
+
+      if ((needed >= min_time) || (iterations >= UINT64_MAX / 10))
+      {
+         const double  factor = static_cast< double>( mOptions.mSampleTime.count())
+            / static_cast< double>( std::max< int64_t>( needed.count(), 1));
+         return std::max< uint64_t>( 1, static_cast< uint64_t>(
+            std::llround( static_cast< double>( iterations) * factor)));
+      } // end if
+
+      iterations *= 10;
+   } // end for
+
+} // BenchmarkRunner::calibrate
+
+
+
+/// Runs a benchmark: Warm-up, calibration and the samples.
+///
+/// @param[in]  bench  The benchmark to run.
+/// @return  The result of the benchmark.
+/// @since  1.47.0, 18.10.2026
+BenchmarkResult BenchmarkRunner::run( const Benchmark& bench) const
+{
+
+   BenchmarkResult  result;
+
+
+   result.mName = bench.mName;
+
+   // warm-up: run with increasing numbers of iterations
+   std::chrono::nanoseconds  warm_up{ 0};
+   for (uint64_t iterations = 1; warm_up < mOptions.mWarmUpTime;
+        iterations *= 2)
+   {
+      warm_up += timedRun( bench, iterations);
+   } // end for
+
+   result.mIterations = calibrate( bench);
+
+   std::vector< double>  samples;
+   samples.reserve( mOptions.mNumSamples);
+
+   auto  run_samples = [ &]()
+   {
+      for (size_t idx = 0; idx < mOptions.mNumSamples; ++idx)
+      {
+         const auto  needed = timedRun( bench, result.mIterations);
+         samples.push_back( static_cast< double>( needed.count())
+                            / static_cast< double>( result.mIterations));
+      } // end for
+   };
+
+   if (mOptions.mPerfCounters)
+   {
+      const common::PerfCounters  counters;
+      common::PerfCounterValues   perf_values;
+
+      {
+         const common::PerfScope  ps( counters, perf_values);
+         run_samples();
+      } // end scope
+
+      result.mPerfMeasured = true;
+      result.mIpc = perf_values.ipc();
+      result.mCacheMissRate = perf_values.cacheMissRate();
+   } else
+   {
+      run_samples();
+   } // end if
+
+   result.mStatistics = computeStatistics( std::move( samples));
+
+   return result;
+} // BenchmarkRunner::run
+
+
+
+/// Prints the results as table, using AsciiTable.
+///
+/// @param[in]  os       The stream to print into.
+/// @param[in]  results  The results to print.
+/// @since  1.47.0, 18.10.2026
+void printTable( std::ostream& os, const std::vector< BenchmarkResult>& results)
+{
+
+   const format::AsciiTable  at( "-Benchmark[-40]  Iterations[12,lu]  "
+                                 "Median (ns)[13.2,f]  CI low[13.2,f]  "
+                                 "CI high[13.2,f]  Mean (ns)[13.2,f]  "
+                                 "Std dev[11.2,f]");
+   const format::AsciiTable  perf_at( "IPC[6]  Cache miss (%)[14]");
+   const bool                with_perf = std::any_of( results.begin(),
+      results.end(), []( const BenchmarkResult& res)
+      {
+         return res.mPerfMeasured;
+      });
+   char                      line[ 256];
+
+
+   os << at.titleLine();
+   if (with_perf)
+      os << "  " << perf_at.titleLine();
+   os << '\n' << at.dashesLine();
+   if (with_perf)
+      os << "  " << perf_at.dashesLine();
+   os << '\n';
+
+   for (const auto& res : results)
+   {
+      const auto&  stat = res.mStatistics;
+      std::snprintf( line, sizeof( line), at.format(), res.mName.c_str(),
+                     static_cast< unsigned long>( res.mIterations),
+                     stat.mMedian, stat.mCiLow, stat.mCiHigh, stat.mMean,
+                     stat.mStdDev);
+      os << line;
+      if (with_perf)
+      {
+         std::snprintf( line, sizeof( line), perf_at.format(),
+                        perfValue( res.mIpc).c_str(),
+                        perfValue( res.mCacheMissRate).c_str());
+         os << "  " << line;
+      } // end if
+      os << '\n';
+   } // end for
+
+   os.flush();
+
+} // printTable
+
+
+
+/// Writes the results in CSV format, with a header line. This format is also
+/// used for the baseline files.
+///
+/// @param[in]  os       The stream to write into.
+/// @param[in]  results  The results to write.
+/// @since  1.47.0, 18.10.2026
+void writeCsv( std::ostream& os, const std::vector< BenchmarkResult>& results)
+{
+
+   char  line[ 256];
+
+
+   os << "name,iterations,samples,median_ns,ci_low_ns,ci_high_ns,mean_ns,"
+         "stddev_ns,min_ns,max_ns,ipc,cache_miss_pct\n";
+
+   for (const auto& res : results)
+   {
+      const auto&  stat = res.mStatistics;
+      std::snprintf( line, sizeof( line),
+                     ",%lu,%lu,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f",
+                     static_cast< unsigned long>( res.mIterations),
+                     static_cast< unsigned long>( stat.mNumSamples),
+                     stat.mMedian, stat.mCiLow, stat.mCiHigh, stat.mMean,
+                     stat.mStdDev, stat.mMin, stat.mMax);
+      // quotes in the name are doubled
+      os << '"';
+      for (auto ch : res.mName)
+      {
+         if (ch == '"')
+            os << ch;
+         os << ch;
+      } // end for
+      os << '"' << line << ',';
+      if (res.mIpc >= 0.0)
+      {
+         std::snprintf( line, sizeof( line), "%.3f", res.mIpc);
+         os << line;
+      } // end if
+      os << ',';
+      if (res.mCacheMissRate >= 0.0)
+      {
+         std::snprintf( line, sizeof( line), "%.3f", res.mCacheMissRate);
+         os << line;
+      } // end if
+      os << '\n';
+   } // end for
+
+   os.flush();
+
+} // writeCsv
+
+
+
+/// Writes the results in JSON format.
+///
+/// @param[in]  os       The stream to write into.
+/// @param[in]  results  The results to write.
+/// @since  1.47.0, 18.10.2026
+void writeJson( std::ostream& os, const std::vector< BenchmarkResult>& results)
+{
+
+   char  line[ 256];
+
+
+   os << "{\"benchmarks\":[";
+
+   for (size_t idx = 0; idx < results.size(); ++idx)
+   {
+      const auto&  res = results[ idx];
+      const auto&  stat = res.mStatistics;
+
+      os << ((idx == 0) ? "\n" : ",\n") << "  {\"name\":";
+      writeJsonString( os, res.mName);
+      std::snprintf( line, sizeof( line),
+                     ",\"iterations\":%lu,\"samples\":%lu,\"median_ns\":%.3f,"
+                     "\"ci_low_ns\":%.3f,\"ci_high_ns\":%.3f,\"mean_ns\":%.3f,"
+                     "\"stddev_ns\":%.3f,\"min_ns\":%.3f,\"max_ns\":%.3f",
+                     static_cast< unsigned long>( res.mIterations),
+                     static_cast< unsigned long>( stat.mNumSamples),
+                     stat.mMedian, stat.mCiLow, stat.mCiHigh, stat.mMean,
+                     stat.mStdDev, stat.mMin, stat.mMax);
+      os << line;
+
+      for (const auto& perf : { std::make_pair( "ipc", res.mIpc),
+                                std::make_pair( "cache_miss_pct",
+                                                res.mCacheMissRate) })
+      {
+         os << ",\"" << perf.first << "\":";
+         if (perf.second >= 0.0)
+         {
+            std::snprintf( line, sizeof( line), "%.3f", perf.second);
+            os << line;
+         } else
+         {
+            os << "null";
+         } // end if
+      } // end for
+      os << '}';
+   } // end for
+
+   os << "\n]}\n";
+   os.flush();
+
+} // writeJson
+
+
+
+/// Compares results with a baseline file, which was written by writeCsv().
+///
+/// @param[in]  results    The current results.
+/// @param[in]  fname      The (path and) name of the baseline file.
+/// @param[in]  threshold  The tolerated slowdown, in percent.
+/// @return  The comparisons, in the order of the results.
+/// @throw  std::runtime_error if the baseline file cannot be read.
+/// @since  1.47.0, 18.10.2026
+std::vector< BenchmarkComparison>
+   compareBaseline( const std::vector< BenchmarkResult>& results,
+                    const std::string& fname, double threshold)
+{
+
+   using common::CsvColumnType;
+
+   const common::CsvReader  reader( {
+      { "name",           CsvColumnType::string },
+      { "iterations",     CsvColumnType::ignore },
+      { "samples",        CsvColumnType::ignore },
+      { "median_ns",      CsvColumnType::float64 },
+      { "ci_low_ns",      CsvColumnType::ignore },
+      { "ci_high_ns",     CsvColumnType::ignore },
+      { "mean_ns",        CsvColumnType::ignore },
+      { "stddev_ns",      CsvColumnType::ignore },
+      { "min_ns",         CsvColumnType::ignore },
+      { "max_ns",         CsvColumnType::ignore },
+      { "ipc",            CsvColumnType::ignore },
+      { "cache_miss_pct", CsvColumnType::ignore }
+   }, ',', true);
+   const auto   baseline = reader.readFile( fname);
+   const auto&  names = baseline.stringColumn( "name");
+   const auto&  medians = baseline.float64Column( "median_ns");
+   std::vector< BenchmarkComparison>  comparisons;
+
+
+   for (const auto& res : results)
+   {
+      for (size_t row = 0; row < baseline.numRows(); ++row)
+      {
+         if (names[ row] != res.mName)
+            continue;   // for
+
+         BenchmarkComparison  comp;
+
+         comp.mName = res.mName;
+         comp.mBaseline = medians[ row];
+         comp.mCurrent = res.mStatistics.mMedian;
+         comp.mChange = (comp.mBaseline > 0.0)
+            ? (comp.mCurrent - comp.mBaseline) * 100.0 / comp.mBaseline : 0.0;
+         comp.mRegression = res.mStatistics.mCiLow
+                            > comp.mBaseline * (1.0 + threshold / 100.0);
+
+         comparisons.push_back( comp);
+         break;   // for
+      } // end for
+   } // end for
+
+   return comparisons;
+} // compareBaseline
+
+
+
+/// Prints the comparisons with the baseline as table.
+///
+/// @param[in]  os           The stream to print into.
+/// @param[in]  comparisons  The comparisons to print.
+/// @since  1.47.0, 18.10.2026
+void printComparison( std::ostream& os,
+                      const std::vector< BenchmarkComparison>& comparisons)
+{
+
+   const format::AsciiTable  at( "-Benchmark[-40]  Baseline (ns)[13.2,f]  "
+                                 "Current (ns)[13.2,f]  Change (%)[10.1,f]  "
+                                 "Result[10]");
+   char                      line[ 256];
+
+
+   os << at.titleLine() << '\n' << at.dashesLine() << '\n';
+
+   for (const auto& comp : comparisons)
+   {
+      std::snprintf( line, sizeof( line), at.format(), comp.mName.c_str(),
+                     comp.mBaseline, comp.mCurrent, comp.mChange,
+                     comp.mRegression ? "REGRESSED" : "ok");
+      os << line << '\n';
+   } // end for
+
+   os.flush();
+
+} // printComparison
+
+
+
+/// Main function of a benchmark program: Evaluates the program arguments,
+/// runs the selected benchmarks and prints the results.
+///
+/// @param[in]  argc  Number of arguments passed to the program.
+/// @param[in]  argv  List of argument strings.
+/// @return  EXIT_SUCCESS if all benchmarks were run and no regression was
+///          found, EXIT_FAILURE otherwise.
+/// @since  1.47.0, 18.10.2026
+int benchmarkMain( int argc, char* argv[])
+{
+
+   namespace cpa = celma::prog_args;
+
+   BenchmarkOptions           options;
+   std::vector< std::string>  filters;
+   int64_t                    warm_up_ms = 100;
+   int64_t                    sample_time_ms = 10;
+   int                        cpu = -1;
+   bool                       list_only = false;
+   bool                       csv_output = false;
+   bool                       json_output = false;
+   bool                       quick = false;
+   std::string                save_baseline;
+   std::string                baseline;
+   double                     threshold = 5.0;
+
+
+   try
+   {
+      cpa::Handler  ah( cpa::Handler::hfHelpShort | cpa::Handler::hfHelpLong);
+
+      ah.addArgument( "f,filter", DEST_VAR( filters),
+                      "Run only the benchmarks whose name contains one of "
+                      "these strings.");
+      ah.addArgument( "l,list", DEST_VAR( list_only),
+                      "Only print the names of the benchmarks.");
+      ah.addArgument( "s,samples", DEST_VAR( options.mNumSamples),
+                      "Number of samples per benchmark.");
+      ah.addArgument( "sample-time", DEST_VAR( sample_time_ms),
+                      "Target time of one sample in milliseconds.");
+      ah.addArgument( "warm-up", DEST_VAR( warm_up_ms),
+                      "Warm-up time per benchmark in milliseconds.");
+      ah.addArgument( "cpu", DEST_VAR( cpu),
+                      "Bind the program to this CPU.");
+      ah.addArgument( "perf", DEST_VAR( options.mPerfCounters),
+                      "Measure the hardware performance counters during the "
+                      "samples, print the IPC and the cache miss rate.");
+      ah.addArgument( "csv", DEST_VAR( csv_output), "Print results as CSV.");
+      ah.addArgument( "json", DEST_VAR( json_output), "Print results as JSON.");
+      ah.addArgument( "save-baseline", DEST_VAR( save_baseline),
+                      "Store the results in this file, to be used as "
+                      "baseline later.");
+      ah.addArgument( "baseline", DEST_VAR( baseline),
+                      "Compare the results with this baseline file.");
+      ah.addArgument( "threshold", DEST_VAR( threshold),
+                      "Slowdown in percent that is reported as regression.");
+      ah.addArgument( "quick", DEST_VAR( quick),
+                      "Quick run with few and short samples, e.g. to check "
+                      "that the benchmarks work.");
+
+      ah.evalArguments( argc, argv);
+
+      if (quick)
+      {
+         warm_up_ms = 1;
+         sample_time_ms = 1;
+         options.mNumSamples = 3;
+      } // end if
+
+      options.mWarmUpTime = std::chrono::milliseconds( warm_up_ms);
+      options.mSampleTime = std::chrono::milliseconds( sample_time_ms);
+
+      if (cpu >= 0)
+         pinToCpu( cpu);
+
+      const BenchmarkRunner          runner( options);
+      std::vector< BenchmarkResult>  results;
+
+      for (const auto& bench : BenchmarkRegistry::instance().benchmarks())
+      {
+         if (!filters.empty()
+             && std::none_of( filters.begin(), filters.end(),
+                              [ &]( const std::string& filter)
+                              {
+                                 return bench.mName.find( filter)
+                                        != std::string::npos;
+                              }))
+            continue;   // for
+
+         if (list_only)
+         {
+            std::cout << bench.mName << std::endl;
+            continue;   // for
+         } // end if
+
+         results.push_back( runner.run( bench));
+      } // end for
+
+      if (list_only)
+         return EXIT_SUCCESS;
+
+      if (json_output)
+         writeJson( std::cout, results);
+      else if (csv_output)
+         writeCsv( std::cout, results);
+      else
+         printTable( std::cout, results);
+
+      if (!save_baseline.empty())
+      {
+         std::ofstream  ofs( save_baseline);
+         writeCsv( ofs, results);
+         if (!ofs)
+            throw std::runtime_error( "could not write baseline file '"
+                                      + save_baseline + "'");
+      } // end if
+
+      if (!baseline.empty())
+      {
+         // don't mix the comparison into CSV or JSON output
+         auto&       info_os = (csv_output || json_output) ? std::cerr
+                                                           : std::cout;
+         const auto  comparisons = compareBaseline( results, baseline,
+                                                    threshold);
+
+         info_os << std::endl;
+         printComparison( info_os, comparisons);
+
+         if (std::any_of( comparisons.begin(), comparisons.end(),
+                          []( const BenchmarkComparison& comp)
+                          {
+                             return comp.mRegression;
+                          }))
+            return EXIT_FAILURE;
+      } // end if
+   } catch (const std::exception& e)
+   {
+      std::cerr << "*** ERROR: " << e.what() << std::endl;
+      return EXIT_FAILURE;
+   } // end try
+
+   return EXIT_SUCCESS;
+} // benchmarkMain
+
+
+
+} // namespace test
+} // namespace celma
+
+
+// =====  END OF benchmark.cpp  =====
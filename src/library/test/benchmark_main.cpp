@@ -0,0 +1,37 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+--*/
+
+
+/// @file
+/// Main function for benchmark programs, see celma::test::benchmarkMain().
+
+
+// project includes
+#include "celma/test/benchmark.hpp"
+
+
+
+/// Main function of a benchmark program.
+///
+/// @param[in]  argc  Number of arguments passed to the program.
+/// @param[in]  argv  List of argument strings.
+/// @return  EXIT_SUCCESS if all benchmarks were run and no regression was
+///          found, EXIT_FAILURE otherwise.
+/// @since  1.47.0, 18.10.2026
+int main( int argc, char* argv[])
+{
+   return celma::test::benchmarkMain( argc, argv);
+} // main
+
+
+
+// =====  END OF benchmark_main.cpp  =====
@@ -0,0 +1,366 @@
+
+/*==
+**
+**    ####   ######  #       #    #   ####
+**   #    #  #       #       ##  ##  #    #
+**   #       ###     #       # ## #  ######    (C) 2026 Rene Eng
+**   #    #  #       #       #    #  #    #        LGPL
+**    ####   ######  ######  #    #  #    #
+**
+**
+**  Description:
+**    Test program for the benchmark framework, using the Boost.Test module.
+**
+--*/
+
+
+// module to test header file include
+#include "celma/test/benchmark.hpp"
+
+
+// OS/C lib includes
+#include <unistd.h>
+
+
+// C++ Standard Library includes
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+
+// Boost includes
+#define BOOST_TEST_MODULE TestBenchmark
+#include <boost/test/unit_test.hpp>
+
+
+using celma::test::Benchmark;
+using celma::test::BenchmarkOptions;
+using celma::test::BenchmarkRegistry;
+using celma::test::BenchmarkResult;
+using celma::test::BenchmarkRunner;
+using celma::test::computeStatistics;
+
+
+namespace {
+
+
+/// Number of times the registered benchmark was called.
+uint64_t  num_calls = 0;
+
+
+/// Returns a result with the given name and median.
+///
+/// @param[in]  name    The name of the benchmark.
+/// @param[in]  median  The median, also used for the confidence interval.
+/// @return  The result object.
+/// @since  1.47.0, 18.10.2026
+BenchmarkResult makeResult( const std::string& name, double median)
+{
+
+   BenchmarkResult  result;
+
+
+   result.mName = name;
+   result.mIterations = 1000;
+   result.mStatistics = computeStatistics( { median * 0.99, median,
+                                             median * 1.01 });
+
+   return result;
+} // makeResult
+
+
+} // namespace
+
+
+BENCHMARK( test, counted)
+{
+   ++num_calls;
+} // counted
+
+
+
+/// Check the statistics computed from samples.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( statistics)
+{
+
+   {
+      const auto  stat = computeStatistics( {});
+      BOOST_REQUIRE_EQUAL( stat.mNumSamples, 0);
+      BOOST_REQUIRE_EQUAL( stat.mMedian, 0.0);
+   } // end scope
+
+   {
+      const auto  stat = computeStatistics( { 4.0, 1.0, 3.0, 2.0 });
+      BOOST_REQUIRE_EQUAL( stat.mNumSamples, 4);
+      BOOST_REQUIRE_CLOSE( stat.mMedian, 2.5, 0.001);
+      BOOST_REQUIRE_CLOSE( stat.mMean, 2.5, 0.001);
+      BOOST_REQUIRE_CLOSE( stat.mStdDev, 1.290994, 0.001);
+      BOOST_REQUIRE_EQUAL( stat.mMin, 1.0);
+      BOOST_REQUIRE_EQUAL( stat.mMax, 4.0);
+      BOOST_REQUIRE_EQUAL( stat.mCiLow, 1.0);
+      BOOST_REQUIRE_EQUAL( stat.mCiHigh, 4.0);
+   } // end scope
+
+   {
+      std::vector< double>  samples;
+      for (int i = 100; i > 0; --i)
+         samples.push_back( i);
+
+      // ranks 50 -/+ 9.8 -> 40 and 60
+      const auto  stat = computeStatistics( samples);
+      BOOST_REQUIRE_CLOSE( stat.mMedian, 50.5, 0.001);
+      BOOST_REQUIRE_EQUAL( stat.mCiLow, 41.0);
+      BOOST_REQUIRE_EQUAL( stat.mCiHigh, 61.0);
+      BOOST_REQUIRE( stat.mCiLow <= stat.mMedian);
+      BOOST_REQUIRE( stat.mCiHigh >= stat.mMedian);
+   } // end scope
+
+} // statistics
+
+
+
+/// Benchmarks registered with the macro must be in the registry, names must
+/// be unique.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( registry)
+{
+
+   auto&  bench_registry = BenchmarkRegistry::instance();
+
+
+   BOOST_REQUIRE_THROW( bench_registry.add( "", []( uint64_t) {}),
+                        std::invalid_argument);
+   BOOST_REQUIRE_THROW( bench_registry.add( "test/counted", []( uint64_t) {}),
+                        std::invalid_argument);
+
+   bench_registry.add( "a/first", []( uint64_t) {});
+
+   const auto  benchmarks = bench_registry.benchmarks();
+   BOOST_REQUIRE_EQUAL( benchmarks.size(), 2);
+   BOOST_REQUIRE_EQUAL( benchmarks[ 0].mName, "a/first");
+   BOOST_REQUIRE_EQUAL( benchmarks[ 1].mName, "test/counted");
+
+   num_calls = 0;
+   benchmarks[ 1].mFunction( 42);
+   BOOST_REQUIRE_EQUAL( num_calls, 42);
+
+} // registry
+
+
+
+/// Run a benchmark that sleeps, so the expected time per iteration is known.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( run_benchmark)
+{
+
+   BenchmarkOptions  options;
+
+
+   options.mNumSamples = 0;
+   BOOST_REQUIRE_THROW( BenchmarkRunner{ options}, std::invalid_argument);
+
+   options.mNumSamples = 5;
+   options.mWarmUpTime = std::chrono::milliseconds( 2);
+   options.mSampleTime = std::chrono::milliseconds( 20);
+
+   const BenchmarkRunner  runner( options);
+   const Benchmark        sleeper{ "test/sleep", []( uint64_t iterations)
+   {
+      for (uint64_t i = 0; i < iterations; ++i)
+         std::this_thread::sleep_for( std::chrono::milliseconds( 1));
+   }};
+
+   const auto  iterations = runner.calibrate( sleeper);
+   BOOST_REQUIRE_GE( iterations, 5);
+   BOOST_REQUIRE_LE( iterations, 20);
+
+   const auto  result = runner.run( sleeper);
+   BOOST_REQUIRE( !result.mPerfMeasured);
+   BOOST_REQUIRE_EQUAL( result.mName, "test/sleep");
+   BOOST_REQUIRE_EQUAL( result.mStatistics.mNumSamples, 5);
+   BOOST_REQUIRE_GE( result.mStatistics.mMin, 1'000'000.0);
+   BOOST_REQUIRE_LE( result.mStatistics.mMin, result.mStatistics.mMedian);
+   BOOST_REQUIRE_LE( result.mStatistics.mMedian, result.mStatistics.mMax);
+
+} // run_benchmark
+
+
+
+/// Run a benchmark with the performance counters. The hardware counters may
+/// not be available, e.g. in a virtual machine.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( run_with_perf_counters)
+{
+
+   BenchmarkOptions  options;
+
+
+   options.mNumSamples = 3;
+   options.mWarmUpTime = std::chrono::milliseconds( 1);
+   options.mSampleTime = std::chrono::milliseconds( 1);
+   options.mPerfCounters = true;
+
+   const BenchmarkRunner  runner( options);
+   const Benchmark        counter{ "test/count", []( uint64_t iterations)
+   {
+      for (uint64_t i = 0; i < iterations; ++i)
+         celma::test::doNotOptimize( i);
+   }};
+
+   const auto  result = runner.run( counter);
+   BOOST_REQUIRE( result.mPerfMeasured);
+   BOOST_REQUIRE_EQUAL( result.mStatistics.mNumSamples, 3);
+   BOOST_REQUIRE( (result.mIpc < 0.0) || (result.mIpc > 0.0));
+   BOOST_REQUIRE( result.mCacheMissRate <= 100.0);
+
+} // run_with_perf_counters
+
+
+
+/// Check the output formats.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( output)
+{
+
+   const std::vector< BenchmarkResult>  results = {
+      makeResult( "module/\"quoted\"", 100.0)
+   };
+
+
+   {
+      std::ostringstream  oss;
+      celma::test::writeCsv( oss, results);
+      BOOST_REQUIRE_EQUAL( oss.str(),
+         "name,iterations,samples,median_ns,ci_low_ns,ci_high_ns,mean_ns,"
+         "stddev_ns,min_ns,max_ns,ipc,cache_miss_pct\n"
+         "\"module/\"\"quoted\"\"\",1000,3,100.000,99.000,101.000,100.000,1.000,"
+         "99.000,101.000,,\n");
+   } // end scope
+
+   {
+      std::ostringstream  oss;
+      celma::test::writeJson( oss, results);
+      BOOST_REQUIRE_EQUAL( oss.str(),
+         "{\"benchmarks\":[\n"
+         "  {\"name\":\"module/\\\"quoted\\\"\",\"iterations\":1000,"
+         "\"samples\":3,\"median_ns\":100.000,\"ci_low_ns\":99.000,"
+         "\"ci_high_ns\":101.000,\"mean_ns\":100.000,\"stddev_ns\":1.000,"
+         "\"min_ns\":99.000,\"max_ns\":101.000,\"ipc\":null,"
+         "\"cache_miss_pct\":null}\n"
+         "]}\n");
+   } // end scope
+
+   {
+      std::ostringstream  oss;
+      celma::test::printTable( oss, results);
+      BOOST_TEST_MESSAGE( oss.str());
+      BOOST_REQUIRE( oss.str().find( "module/\"quoted\"") != std::string::npos);
+      BOOST_REQUIRE( oss.str().find( "IPC") == std::string::npos);
+   } // end scope
+
+   auto  perf_results = results;
+   perf_results[ 0].mPerfMeasured = true;
+   perf_results[ 0].mIpc = 2.5;
+
+   {
+      std::ostringstream  oss;
+      celma::test::writeCsv( oss, perf_results);
+      BOOST_REQUIRE( oss.str().find( "101.000,2.500,\n") != std::string::npos);
+   } // end scope
+
+   {
+      std::ostringstream  oss;
+      celma::test::writeJson( oss, perf_results);
+      BOOST_REQUIRE( oss.str().find( "\"ipc\":2.500,\"cache_miss_pct\":null}")
+                     != std::string::npos);
+   } // end scope
+
+   {
+      std::ostringstream  oss;
+      celma::test::printTable( oss, perf_results);
+      BOOST_TEST_MESSAGE( oss.str());
+      BOOST_REQUIRE( oss.str().find( "IPC") != std::string::npos);
+      BOOST_REQUIRE( oss.str().find( "2.50") != std::string::npos);
+      BOOST_REQUIRE( oss.str().find( "n/a") != std::string::npos);
+   } // end scope
+
+} // output
+
+
+
+/// Compare results with a baseline.
+///
+/// @since  1.47.0, 18.10.2026
+BOOST_AUTO_TEST_CASE( compare_baseline)
+{
+
+   const std::string  fname( "/tmp/celma_benchmark_baseline_"
+                             + std::to_string( ::getpid()) + ".csv");
+
+
+   BOOST_REQUIRE_THROW( celma::test::compareBaseline( {}, fname, 5.0),
+                        std::runtime_error);
+
+   {
+      std::ofstream  ofs( fname);
+      auto  with_perf = makeResult( "a/\"x\"", 1.0);
+      with_perf.mPerfMeasured = true;
+      with_perf.mIpc = 1.5;
+      with_perf.mCacheMissRate = 3.0;
+      celma::test::writeCsv( ofs, { with_perf,
+                                    makeResult( "a/same", 100.0),
+                                    makeResult( "a/slower", 100.0),
+                                    makeResult( "a/faster", 100.0),
+                                    makeResult( "a/noise", 100.0) });
+   } // end scope
+
+   const auto  comparisons = celma::test::compareBaseline( {
+      makeResult( "a/faster", 50.0), makeResult( "a/new", 10.0),
+      makeResult( "a/\"x\"", 1.0),
+      makeResult( "a/noise", 105.0), makeResult( "a/same", 100.0),
+      makeResult( "a/slower", 120.0) }, fname, 5.0);
+
+   std::remove( fname.c_str());
+
+   BOOST_REQUIRE_EQUAL( comparisons.size(), 5);
+
+   BOOST_REQUIRE_EQUAL( comparisons[ 0].mName, "a/faster");
+   BOOST_REQUIRE_CLOSE( comparisons[ 0].mChange, -50.0, 0.001);
+   BOOST_REQUIRE( !comparisons[ 0].mRegression);
+
+   BOOST_REQUIRE_EQUAL( comparisons[ 1].mName, "a/\"x\"");
+   BOOST_REQUIRE_CLOSE( comparisons[ 1].mBaseline, 1.0, 0.001);
+
+   // the confidence interval starts at 103.95
+   BOOST_REQUIRE_EQUAL( comparisons[ 2].mName, "a/noise");
+   BOOST_REQUIRE( !comparisons[ 2].mRegression);
+
+   BOOST_REQUIRE_EQUAL( comparisons[ 3].mName, "a/same");
+   BOOST_REQUIRE_CLOSE( comparisons[ 3].mCurrent, 100.0, 0.001);
+   BOOST_REQUIRE( !comparisons[ 3].mRegression);
+
+   BOOST_REQUIRE_EQUAL( comparisons[ 4].mName, "a/slower");
+   BOOST_REQUIRE_CLOSE( comparisons[ 4].mBaseline, 100.0, 0.001);
+   BOOST_REQUIRE_CLOSE( comparisons[ 4].mChange, 20.0, 0.001);
+   BOOST_REQUIRE( comparisons[ 4].mRegression);
+
+   std::ostringstream  oss;
+   celma::test::printComparison( oss, comparisons);
+   BOOST_TEST_MESSAGE( oss.str());
+   BOOST_REQUIRE( oss.str().find( "REGRESSED") != std::string::npos);
+
+} // compare_baseline
+
+
+
+// =====  END OF test_benchmark.cpp  =====